@@ -73,6 +73,58 @@ int32_t lagrangian_hessian_max_positive_sign(int32_t /*number_variables*/, int32
 	return 0;
 }
 
+// number of calls of the evaluation callbacks, passed as user data
+typedef struct {
+	int32_t objective;
+	int32_t constraints;
+	int32_t objective_gradient;
+	int32_t jacobian;
+	int32_t fused;
+} EvaluationCounts;
+
+int32_t counted_objective_function(int32_t number_variables, const double* x, double* objective_value, void* user_data) {
+	++((EvaluationCounts*)user_data)->objective;
+	return objective_function(number_variables, x, objective_value, user_data);
+}
+
+int32_t counted_constraint_functions(int32_t number_variables, int32_t number_constraints, const double* x,
+		double* constraint_values, void* user_data) {
+	++((EvaluationCounts*)user_data)->constraints;
+	return constraint_functions(number_variables, number_constraints, x, constraint_values, user_data);
+}
+
+int32_t counted_objective_gradient(int32_t number_variables, const double* x, double* gradient, void* user_data) {
+	++((EvaluationCounts*)user_data)->objective_gradient;
+	return objective_gradient(number_variables, x, gradient, user_data);
+}
+
+int32_t counted_constraint_jacobian(int32_t number_variables, int32_t number_jacobian_nonzeros, const double* x,
+		double* jacobian, void* user_data) {
+	++((EvaluationCounts*)user_data)->jacobian;
+	return constraint_jacobian(number_variables, number_jacobian_nonzeros, x, jacobian, user_data);
+}
+
+// calls the separate callbacks for the requested quantities. Each quantity is counted, as well as the fused call
+int32_t fused_evaluation(int32_t number_variables, int32_t number_constraints, int32_t number_jacobian_nonzeros,
+		const double* x, int32_t request, double* objective_value, double* constraint_values, double* gradient, double* jacobian,
+		void* user_data) {
+	EvaluationCounts* counts = (EvaluationCounts*)user_data;
+	++counts->fused;
+	if (request & UNO_REQUEST_OBJECTIVE) {
+		counted_objective_function(number_variables, x, objective_value, user_data);
+	}
+	if (request & UNO_REQUEST_CONSTRAINTS) {
+		counted_constraint_functions(number_variables, number_constraints, x, constraint_values, user_data);
+	}
+	if (request & UNO_REQUEST_OBJECTIVE_GRADIENT) {
+		counted_objective_gradient(number_variables, x, gradient, user_data);
+	}
+	if (request & UNO_REQUEST_JACOBIAN) {
+		counted_constraint_jacobian(number_variables, number_jacobian_nonzeros, x, jacobian, user_data);
+	}
+	return 0;
+}
+
 void print_vector(const double* vector, int32_t size) {
 	for (size_t index = 0; index < size; ++index) {
 		printf("%g ", vector[index]);
@@ -187,6 +239,88 @@ void solve_instance(int32_t optimization_sense, double lagrangian_sign_conventio
 	uno_destroy_model(model);
 }
 
+// solves hs015 with the separate callbacks or the fused callback and returns the solution and the callback counts
+void solve_hs015(bool fused, double* solution_objective, double primal_solution[], double constraint_dual_solution[],
+		EvaluationCounts* counts) {
+	const int32_t base_indexing = UNO_ZERO_BASED_INDEXING;
+	const int32_t number_variables = 2;
+	double variables_lower_bounds[] = {-INFINITY, -INFINITY};
+	double variables_upper_bounds[] = {0.5, INFINITY};
+	const int32_t number_constraints = 2;
+	double constraints_lower_bounds[] = {1., 0.};
+	double constraints_upper_bounds[] = {INFINITY, INFINITY};
+	const int32_t number_jacobian_nonzeros = 4;
+	int32_t jacobian_row_indices[] = {0, 1, 0, 1};
+	int32_t jacobian_column_indices[] = {0, 0, 1, 1};
+	const int32_t number_hessian_nonzeros = 3;
+	int32_t hessian_row_indices[] = {0, 1, 1};
+	int32_t hessian_column_indices[] = {0, 0, 1};
+	double x0[] = {-2., 1.};
+
+	void* model = uno_create_model(UNO_PROBLEM_NONLINEAR, number_variables, variables_lower_bounds,
+		variables_upper_bounds, base_indexing);
+	if (fused) {
+		// the function callbacks are replaced by the fused callback
+		assert(uno_set_objective(model, UNO_MINIMIZE, NULL, NULL));
+		assert(uno_set_constraints(model, number_constraints, NULL, constraints_lower_bounds, constraints_upper_bounds,
+			number_jacobian_nonzeros, jacobian_row_indices, jacobian_column_indices, NULL));
+		assert(uno_set_fused_evaluation(model, fused_evaluation));
+	}
+	else {
+		assert(uno_set_objective(model, UNO_MINIMIZE, counted_objective_function, counted_objective_gradient));
+		assert(uno_set_constraints(model, number_constraints, counted_constraint_functions, constraints_lower_bounds,
+			constraints_upper_bounds, number_jacobian_nonzeros, jacobian_row_indices, jacobian_column_indices,
+			counted_constraint_jacobian));
+	}
+	assert(uno_set_lagrangian_hessian(model, number_hessian_nonzeros, UNO_LOWER_TRIANGLE, hessian_row_indices,
+		hessian_column_indices, lagrangian_hessian_negative_sign, UNO_MULTIPLIER_NEGATIVE));
+	assert(uno_set_initial_primal_iterate(model, x0));
+	assert(uno_set_user_data(model, counts));
+
+	void* solver = uno_create_solver();
+	uno_set_solver_preset(solver, "ipopt");
+	uno_set_solver_option(solver, "logger", "SILENT");
+	uno_optimize(solver, model);
+
+	assert(uno_get_optimization_status(solver) == UNO_SUCCESS);
+	*solution_objective = uno_get_solution_objective(solver);
+	uno_get_primal_solution(solver, primal_solution);
+	uno_get_constraint_dual_solution(solver, constraint_dual_solution);
+
+	uno_destroy_solver(solver);
+	uno_destroy_model(model);
+}
+
+// the fused callback evaluates the same quantities at the same points as the separate callbacks: the solutions are
+// identical. The function values (and the derivatives) at a given point are computed in a single call
+void test_fused_evaluation() {
+	double objective, fused_objective;
+	double primal_solution[2], fused_primal_solution[2];
+	double constraint_dual_solution[2], fused_constraint_dual_solution[2];
+	EvaluationCounts counts = {0, 0, 0, 0, 0};
+	EvaluationCounts fused_counts = {0, 0, 0, 0, 0};
+	solve_hs015(false, &objective, primal_solution, constraint_dual_solution, &counts);
+	solve_hs015(true, &fused_objective, fused_primal_solution, fused_constraint_dual_solution, &fused_counts);
+
+	assert(fused_objective == objective);
+	for (size_t index = 0; index < 2; ++index) {
+		assert(fused_primal_solution[index] == primal_solution[index]);
+		assert(fused_constraint_dual_solution[index] == constraint_dual_solution[index]);
+	}
+	// the objective and the constraints (resp. the gradient and the Jacobian) are computed in the same call, except for
+	// the first call of each kind, before Uno has needed the companion quantity
+	assert(counts.fused == 0);
+	const int32_t function_calls = (counts.objective < counts.constraints) ? counts.constraints : counts.objective;
+	const int32_t derivative_calls = (counts.objective_gradient < counts.jacobian) ? counts.jacobian : counts.objective_gradient;
+	assert(fused_counts.fused <= function_calls + derivative_calls + 2);
+	assert(fused_counts.fused < counts.objective + counts.constraints + counts.objective_gradient + counts.jacobian);
+	assert(fused_counts.objective + fused_counts.constraints + fused_counts.objective_gradient + fused_counts.jacobian <=
+		2 * fused_counts.fused);
+	printf("separate callbacks: %d objective, %d constraints, %d gradient, %d Jacobian calls\n", counts.objective,
+		counts.constraints, counts.objective_gradient, counts.jacobian);
+	printf("fused callback: %d calls\n", fused_counts.fused);
+}
+
 int main() {
 	const double reference_objective = 306.5;
 	const double reference_primal_solution[] = {0.5, 2};
@@ -212,6 +346,8 @@ int main() {
 		reference_primal_solution, reference_constraint_dual_solution_negative,
 		reference_lower_bound_dual_solution, reference_upper_bound_dual_solution_negative);
 	printf("(UNO_MAXIMIZE, UNO_MULTIPLIER_POSITIVE) passed.\n");
+	test_fused_evaluation();
+	printf("Fused evaluation passed.\n");
 	
 	return 0;
 }
\ No newline at end of file
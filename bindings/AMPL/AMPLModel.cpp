@@ -1,6 +1,7 @@
 // Copyright (c) 2018-2024 Charlie Vanaret
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <stdexcept>
@@ -38,17 +39,25 @@ namespace uno {
    }
 
    // generate the ASL object and call the private constructor
-   AMPLModel::AMPLModel(const std::string& file_name) : AMPLModel(file_name, generate_asl(file_name)) {
+   AMPLModel::AMPLModel(const std::string& file_name, bool provide_linear_operators) :
+         AMPLModel(file_name, generate_asl(file_name), provide_linear_operators) {
    }
 
-   AMPLModel::AMPLModel(const std::string& file_name, ASL* asl) :
+   AMPLModel::AMPLModel(const std::string& file_name, ASL* asl, bool provide_linear_operators) :
          Model(file_name, static_cast<size_t>(asl->i.n_var_), static_cast<size_t>(asl->i.n_con_),
             (asl->i.objtype_[0] == 1) ? -1. : 1. /* optimization sense */),
          asl(asl),
+         provide_linear_operators(provide_linear_operators),
          // AMPL orders the constraints based on the function type: nonlinear first (nlc of them), then linear
          linear_constraints(static_cast<size_t>(this->asl->i.nlc_), this->number_constraints),
          equality_constraints_collection(this->equality_constraints),
-         inequality_constraints_collection(this->inequality_constraints) {
+         inequality_constraints_collection(this->inequality_constraints),
+         objective_evaluation_point(this->number_variables),
+         constraints_evaluation_point(this->number_variables),
+         hessian_operator_multipliers(this->number_constraints),
+         jacobian_operator_point(this->number_variables),
+         jacobian_operator_values(static_cast<size_t>(this->asl->i.nzc_)),
+         scratch_constraints(this->number_constraints) {
       // Jacobian storage: use goff fields of struct cgrad
       this->asl->i.congrd_mode = 2;
 
@@ -66,19 +75,20 @@ namespace uno {
       ASL_free(&this->asl);
    }
    
+   // the linear operators are opt-in (option AMPL_linear_operators, see DefaultOptions)
+   // the Jacobian operators are built from the Jacobian values (Jacval)
    bool AMPLModel::has_jacobian_operator() const {
-      return false;
+      return this->provide_linear_operators;
    }
 
    bool AMPLModel::has_jacobian_transposed_operator() const {
-      return false;
+      return this->provide_linear_operators;
    }
 
+   // the ASL Hessian representation changes as soon as trial iterates are evaluated. The functions are reevaluated at the
+   // linearization point when needed (see set_hessian_point), which makes the Hessian-vector products point-safe
    bool AMPLModel::has_hessian_operator() const {
-      // As long as we use the ASL library ("solvers"), we need to form the explicit Hessian
-      // The reason is that the ASL Hessian representation changes as soon as trial
-      // iterates are evaluated. The variant "solvers2" should address the issue.
-      return false;
+      return this->provide_linear_operators;
    }
 
    bool AMPLModel::has_hessian_matrix() const {
@@ -88,6 +98,7 @@ namespace uno {
    double AMPLModel::evaluate_objective(const Vector<double>& x) const {
       fint error_flag = 0;
       const double result = this->optimization_sense * (*(this->asl)->p.Objval)(this->asl, 0, const_cast<double*>(x.data()), &error_flag);
+      this->track_evaluation(this->objective_evaluation_point, x.data(), error_flag == 0);
       if (0 < error_flag) {
          throw FunctionEvaluationError();
       }
@@ -108,6 +119,7 @@ namespace uno {
    void AMPLModel::evaluate_constraints(const Vector<double>& x, Vector<double>& constraints) const {
       fint error_flag = 0;
       (*(this->asl)->p.Conval)(this->asl, const_cast<double*>(x.data()), constraints.data(), &error_flag);
+      this->track_evaluation(this->constraints_evaluation_point, x.data(), error_flag == 0);
       if (0 < error_flag) {
          throw FunctionEvaluationError();
       }
@@ -117,6 +129,7 @@ namespace uno {
    void AMPLModel::evaluate_objective_gradient(const Vector<double>& x, Vector<double>& gradient) const {
       fint error_flag = 0;
       (*(this->asl)->p.Objgrd)(this->asl, 0, const_cast<double*>(x.data()), gradient.data(), &error_flag);
+      this->track_evaluation(this->objective_evaluation_point, x.data(), error_flag == 0);
       if (0 < error_flag) {
          throw GradientEvaluationError();
       }
@@ -137,6 +150,8 @@ namespace uno {
                constraint_gradient = constraint_gradient->next;
             }
          }
+         // the Jacobian values of the operators are stored in the previous order
+         this->jacobian_operator_point.is_valid = false;
       }
 
       for (size_t constraint_index: Range(this->number_constraints)) {
@@ -168,6 +183,7 @@ namespace uno {
    void AMPLModel::evaluate_constraint_jacobian(const Vector<double>& x, double* jacobian_values) const {
       fint error_flag = 0;
       (*(this->asl)->p.Jacval)(this->asl, const_cast<double*>(x.data()), jacobian_values, &error_flag);
+      this->track_evaluation(this->constraints_evaluation_point, x.data(), error_flag == 0);
       if (0 < error_flag) {
          throw GradientEvaluationError();
       }
@@ -178,29 +194,59 @@ namespace uno {
    // unregister the vector of variables
    //this->asl->i.x_known = 0;
 
-   void AMPLModel::evaluate_lagrangian_hessian(const Vector<double>& /*x*/, double objective_multiplier, const Vector<double>& multipliers,
+   void AMPLModel::evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
          double* hessian_values) const {
       objective_multiplier *= this->optimization_sense;
+      this->set_hessian_point(x.data());
       (*(this->asl)->p.Sphes)(this->asl, nullptr, hessian_values, -1, &objective_multiplier,
          const_cast<double*>(multipliers.data()));
+      // Sphes shares its workspace with the Hessian-vector products
+      this->is_hessian_operator_initialized = false;
    }
 
-   void AMPLModel::compute_jacobian_vector_product(const double* /*x*/, const double* /*vector*/, double* /*result*/) const {
-      throw std::runtime_error("AMPLModel::compute_jacobian_vector_product not implemented");
+   void AMPLModel::compute_jacobian_vector_product(const double* x, const double* vector, double* result) const {
+      this->evaluate_jacobian_operator(x);
+      for (size_t constraint_index: Range(this->number_constraints)) {
+         result[constraint_index] = 0.;
+         for (cgrad* constraint_gradient = this->asl->i.Cgrad_[constraint_index]; constraint_gradient != nullptr;
+               constraint_gradient = constraint_gradient->next) {
+            result[constraint_index] += this->jacobian_operator_values[static_cast<size_t>(constraint_gradient->goff)] *
+               vector[constraint_gradient->varno];
+         }
+      }
    }
 
-   void AMPLModel::compute_jacobian_transposed_vector_product(const double* /*x*/, const double* /*vector*/, double* /*result*/) const {
-      throw std::runtime_error("AMPLModel::compute_jacobian_transposed_vector_product not implemented");
+   void AMPLModel::compute_jacobian_transposed_vector_product(const double* x, const double* vector, double* result) const {
+      this->evaluate_jacobian_operator(x);
+      std::fill_n(result, this->number_variables, 0.);
+      for (size_t constraint_index: Range(this->number_constraints)) {
+         for (cgrad* constraint_gradient = this->asl->i.Cgrad_[constraint_index]; constraint_gradient != nullptr;
+               constraint_gradient = constraint_gradient->next) {
+            result[constraint_gradient->varno] += this->jacobian_operator_values[static_cast<size_t>(constraint_gradient->goff)] *
+               vector[constraint_index];
+         }
+      }
    }
 
-   void AMPLModel::compute_hessian_vector_product(const double* /*x*/, const double* vector, double objective_multiplier,
+   void AMPLModel::compute_hessian_vector_product(const double* x, const double* vector, double objective_multiplier,
          const Vector<double>& multipliers, double* result) const {
       // scale by the objective sign
       objective_multiplier *= this->optimization_sense;
+      this->set_hessian_point(x);
+
+      // (re)initialize the Hessian-vector products if the point or the multipliers changed
+      if (!this->is_hessian_operator_initialized || objective_multiplier != this->hessian_operator_objective_multiplier ||
+            !std::equal(this->hessian_operator_multipliers.begin(), this->hessian_operator_multipliers.end(), multipliers.data())) {
+         this->hessian_operator_objective_multiplier = objective_multiplier;
+         std::copy_n(multipliers.data(), this->number_constraints, this->hessian_operator_multipliers.data());
+         (*(this->asl)->p.Hvinit)(this->asl, this->asl->p.ihd_limit_, -1, &this->hessian_operator_objective_multiplier,
+            this->hessian_operator_multipliers.data());
+         this->is_hessian_operator_initialized = true;
+      }
 
       // compute the Hessian-vector product
-      (this->asl->p.Hvcomp)(this->asl, result, const_cast<double*>(vector), -1, &objective_multiplier,
-         const_cast<double*>(multipliers.data()));
+      (this->asl->p.Hvcomp)(this->asl, result, const_cast<double*>(vector), -1, &this->hessian_operator_objective_multiplier,
+         this->hessian_operator_multipliers.data());
    }
 
    double AMPLModel::variable_lower_bound(size_t variable_index) const {
@@ -316,4 +362,56 @@ namespace uno {
       constexpr int triangular = 2;
       this->number_asl_hessian_nonzeros = static_cast<size_t>((*(this->asl)->p.Sphset)(this->asl, nullptr, -1, 1, 1, triangular));
    }
-} // namespace
\ No newline at end of file
+
+   bool AMPLModel::EvaluationPoint::equals(const double* point) const {
+      return this->is_valid && std::equal(this->x.begin(), this->x.end(), point);
+   }
+
+   // record the point at which the ASL evaluated a group of functions. The Hessian-vector products must be reinitialized
+   // when the derivative information of the ASL changes
+   void AMPLModel::track_evaluation(EvaluationPoint& evaluation_point, const double* x, bool success) const {
+      if (!success) {
+         evaluation_point.is_valid = false;
+         this->is_hessian_operator_initialized = false;
+      }
+      else if (!evaluation_point.equals(x)) {
+         std::copy_n(x, this->number_variables, evaluation_point.x.data());
+         evaluation_point.is_valid = true;
+         this->is_hessian_operator_initialized = false;
+      }
+   }
+
+   // make sure that the derivative information of the ASL is that of the point x by reevaluating the functions if needed
+   void AMPLModel::set_hessian_point(const double* x) const {
+      fint error_flag = 0;
+      if (!this->objective_evaluation_point.equals(x)) {
+         (*(this->asl)->p.Objval)(this->asl, 0, const_cast<double*>(x), &error_flag);
+         this->track_evaluation(this->objective_evaluation_point, x, error_flag == 0);
+         if (0 < error_flag) {
+            throw HessianEvaluationError();
+         }
+      }
+      if (0 < this->number_constraints && !this->constraints_evaluation_point.equals(x)) {
+         (*(this->asl)->p.Conval)(this->asl, const_cast<double*>(x), this->scratch_constraints.data(), &error_flag);
+         this->track_evaluation(this->constraints_evaluation_point, x, error_flag == 0);
+         if (0 < error_flag) {
+            throw HessianEvaluationError();
+         }
+      }
+   }
+
+   // evaluate the Jacobian values of the operators at x, unless they are already available
+   void AMPLModel::evaluate_jacobian_operator(const double* x) const {
+      if (!this->jacobian_operator_point.equals(x)) {
+         fint error_flag = 0;
+         (*(this->asl)->p.Jacval)(this->asl, const_cast<double*>(x), this->jacobian_operator_values.data(), &error_flag);
+         this->track_evaluation(this->constraints_evaluation_point, x, error_flag == 0);
+         if (0 < error_flag) {
+            this->jacobian_operator_point.is_valid = false;
+            throw GradientEvaluationError();
+         }
+         std::copy_n(x, this->number_variables, this->jacobian_operator_point.x.data());
+         this->jacobian_operator_point.is_valid = true;
+      }
+   }
+} // namespace
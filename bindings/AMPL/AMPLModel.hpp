@@ -21,7 +21,8 @@ namespace uno {
 
    class AMPLModel: public Model {
    public:
-      explicit AMPLModel(const std::string& file_name);
+      // the linear operators (Jacobian- and Hessian-vector products) are only exposed if provide_linear_operators is set
+      AMPLModel(const std::string& file_name, bool provide_linear_operators);
 
       static constexpr double lagrangian_sign_convention{-1.};
 
@@ -78,10 +79,11 @@ namespace uno {
 
    private:
       // private constructor to pass the dimensions to the Model base constructor
-      AMPLModel(const std::string& file_name, ASL* asl);
+      AMPLModel(const std::string& file_name, ASL* asl, bool provide_linear_operators);
 
       // mutable: can be modified by const methods (internal state not seen by user)
       mutable ASL* asl; /*!< Instance of the AMPL Solver Library class */
+      const bool provide_linear_operators;
       size_t number_asl_hessian_nonzeros{0}; /*!< Number of nonzero elements in the Hessian */
 
       // lists of variables and constraints + corresponding collection objects
@@ -93,7 +95,34 @@ namespace uno {
       SparseVector<size_t> slacks{};
       Vector<size_t> fixed_variables;
 
+      // point at which the ASL last evaluated a group of functions (objective or constraints)
+      struct EvaluationPoint {
+         Vector<double> x;
+         bool is_valid{false};
+
+         explicit EvaluationPoint(size_t number_variables): x(number_variables) { }
+         [[nodiscard]] bool equals(const double* point) const;
+      };
+
+      // the derivative information of the ASL (used by Sphes, Hvinit and Hvcomp) is that of the last points at which the
+      // objective and the constraints were evaluated. They are tracked so that the Hessian can be formed at the linearization
+      // point, even after trial iterates were evaluated
+      mutable EvaluationPoint objective_evaluation_point;
+      mutable EvaluationPoint constraints_evaluation_point;
+      // multipliers with which the Hessian-vector products were initialized (Hvinit)
+      mutable bool is_hessian_operator_initialized{false};
+      mutable double hessian_operator_objective_multiplier{0.};
+      mutable Vector<double> hessian_operator_multipliers;
+      // constraint Jacobian used by the Jacobian operators, and point at which it was evaluated
+      mutable EvaluationPoint jacobian_operator_point;
+      mutable Vector<double> jacobian_operator_values;
+      // scratch space of size number_constraints
+      mutable Vector<double> scratch_constraints;
+
       void compute_lagrangian_hessian_sparsity();
+      void track_evaluation(EvaluationPoint& evaluation_point, const double* x, bool success) const;
+      void set_hessian_point(const double* x) const;
+      void evaluate_jacobian_operator(const double* x) const;
    };
 
    // check that an array of integers is in increasing order (x[i] <= x[i+1])
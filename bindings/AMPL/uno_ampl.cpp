@@ -9,6 +9,10 @@
 #include "options/Presets.hpp"
 #include "tools/Logger.hpp"
 #include "Uno.hpp"
+#if defined(HAS_MUMPS) && defined(HAS_MPI) && defined(MUMPS_PARALLEL)
+#include "mpi.h"
+#include "ingredients/subproblem_solvers/MUMPS/MUMPSSolver.hpp"
+#endif
 
 /*
 size_t memory_allocation_amount = 0;
@@ -23,7 +27,7 @@ void* operator new(size_t size) {
 namespace uno {
    void run_uno_ampl(const std::string& model_name, const Options& options) {
       try {
-         const AMPLModel model(model_name);
+         const AMPLModel model(model_name, options.get_bool("AMPL_linear_operators"));
          Uno uno{};
          Result result = uno.solve(model, options);
          if (result.optimization_status == OptimizationStatus::SUCCESS) {
@@ -46,6 +50,18 @@ namespace uno {
 int main(int argc, char* argv[]) {
    using namespace uno;
 
+#if defined(HAS_MUMPS) && defined(HAS_MPI) && defined(MUMPS_PARALLEL)
+   // mpirun -np 4 ./uno_ampl model.nl linear_solver=MUMPS: the processes other than the host only take part in MUMPS
+   MPI_Init(&argc, &argv);
+   int rank;
+   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+   if (rank != 0) {
+      MUMPSSolver::run_worker_loop();
+      MPI_Finalize();
+      return EXIT_SUCCESS;
+   }
+#endif
+
    try {
       if (argc == 1 || (argc == 2 && std::string(argv[1]) == "--v")) {
          std::cout << "Uno " << Uno::current_version() << '\n';
@@ -93,5 +109,9 @@ int main(int argc, char* argv[]) {
    catch (std::exception& exception) {
       DISCRETE << exception.what() << '\n';
    }
+#if defined(HAS_MUMPS) && defined(HAS_MPI) && defined(MUMPS_PARALLEL)
+   MUMPSSolver::release_workers();
+   MPI_Finalize();
+#endif
    return EXIT_SUCCESS;
 }
\ No newline at end of file
@@ -9,11 +9,14 @@
 #include "Uno.hpp"
 #include "linear_algebra/SparseVector.hpp"
 #include "linear_algebra/Vector.hpp"
+#include "model/BlockPartition.hpp"
 #include "model/Model.hpp"
 #include "options/DefaultOptions.hpp"
 #include "options/Presets.hpp"
 #include "optimization/EvaluationErrors.hpp"
 #include "optimization/Iterate.hpp"
+#include "optimization/Multipliers.hpp"
+#include "optimization/SensitivityAnalysis.hpp"
 #include "symbolic/CollectionAdapter.hpp"
 #include "symbolic/Range.hpp"
 #include "tools/Infinity.hpp"
@@ -21,8 +24,15 @@
 
 using namespace uno;
 
-using CUserModel = UserModel<Objective, ObjectiveGradient, Constraints, Jacobian, JacobianOperator, JacobianTransposedOperator,
-   Hessian, HessianOperator, const double*, void*>;
+// the C user model may additionally provide a fused evaluation callback
+class CUserModel: public UserModel<Objective, ObjectiveGradient, Constraints, Jacobian, JacobianOperator,
+      JacobianTransposedOperator, Hessian, HessianOperator, const double*, void*> {
+public:
+   using UserModel::UserModel;
+
+   FusedEvaluation fused_evaluation{nullptr};
+   BlockPartition block_partition{};
+};
 
 // UnoModel contains an instance of UserModel and complies with the Model interface
 class UnoModel: public Model {
@@ -35,6 +45,12 @@ public:
          inequality_constraints_collection(this->inequality_constraints) {
       this->find_fixed_variables(this->fixed_variables);
       this->partition_constraints(this->equality_constraints, this->inequality_constraints);
+      if (this->user_model.fused_evaluation != nullptr) {
+         this->fused_point.resize(this->number_variables);
+         this->fused_constraints.resize(this->number_constraints);
+         this->fused_gradient.resize(this->number_variables);
+         this->fused_jacobian.resize(this->number_jacobian_nonzeros());
+      }
    }
 
    // availability of linear operators
@@ -57,7 +73,11 @@ public:
    // function evaluations
    [[nodiscard]] double evaluate_objective(const Vector<double>& x) const override {
       double objective_value{0.};
-      if (this->user_model.objective_function != nullptr) {
+      if (this->user_model.fused_evaluation != nullptr) {
+         this->fused_evaluate(x, UNO_REQUEST_OBJECTIVE);
+         objective_value = this->optimization_sense * this->fused_objective;
+      }
+      else if (this->user_model.objective_function != nullptr) {
          const int32_t return_code = this->user_model.objective_function(this->user_model.number_variables, x.data(),
             &objective_value, this->user_model.user_data);
          if (0 < return_code) {
@@ -69,7 +89,11 @@ public:
    }
 
    void evaluate_constraints(const Vector<double>& x, Vector<double>& constraints) const override {
-      if (this->user_model.constraint_functions != nullptr) {
+      if (this->user_model.fused_evaluation != nullptr) {
+         this->fused_evaluate(x, UNO_REQUEST_CONSTRAINTS);
+         std::copy_n(this->fused_constraints.data(), this->number_constraints, constraints.data());
+      }
+      else if (this->user_model.constraint_functions != nullptr) {
          const int32_t return_code = this->user_model.constraint_functions(this->user_model.number_variables,
             this->user_model.number_constraints, x.data(), constraints.data(), this->user_model.user_data);
          if (0 < return_code) {
@@ -80,7 +104,13 @@ public:
 
    // dense objective gradient
    void evaluate_objective_gradient(const Vector<double>& x, Vector<double>& gradient) const override {
-      if (this->user_model.objective_gradient != nullptr) {
+      if (this->user_model.fused_evaluation != nullptr) {
+         this->fused_evaluate(x, UNO_REQUEST_OBJECTIVE_GRADIENT);
+         for (size_t variable_index: Range(this->number_variables)) {
+            gradient[variable_index] = this->optimization_sense * this->fused_gradient[variable_index];
+         }
+      }
+      else if (this->user_model.objective_gradient != nullptr) {
          const int32_t return_code = this->user_model.objective_gradient(this->user_model.number_variables, x.data(),
             gradient.data(), this->user_model.user_data);
          if (0 < return_code) {
@@ -127,7 +157,11 @@ public:
 
    // numerical evaluations of Jacobian and Hessian
    void evaluate_constraint_jacobian(const Vector<double>& x, double* jacobian_values) const override {
-      if (this->user_model.constraint_jacobian != nullptr) {
+      if (this->user_model.fused_evaluation != nullptr) {
+         this->fused_evaluate(x, UNO_REQUEST_JACOBIAN);
+         std::copy_n(this->fused_jacobian.data(), this->fused_jacobian.size(), jacobian_values);
+      }
+      else if (this->user_model.constraint_jacobian != nullptr) {
          const int32_t return_code = this->user_model.constraint_jacobian(this->user_model.number_variables,
             this->user_model.number_jacobian_nonzeros, x.data(), jacobian_values, this->user_model.user_data);
          if (0 < return_code) {
@@ -295,6 +329,10 @@ public:
       return static_cast<size_t>(this->user_model.number_hessian_nonzeros);
    }
 
+   [[nodiscard]] const BlockPartition& get_block_partition() const override {
+      return this->user_model.block_partition;
+   }
+
 protected:
    const CUserModel& user_model;
    const SparseVector<size_t> slacks{};
@@ -304,6 +342,43 @@ protected:
    CollectionAdapter<std::vector<size_t>> equality_constraints_collection;
    std::vector<size_t> inequality_constraints;
    CollectionAdapter<std::vector<size_t>> inequality_constraints_collection;
+   // quantities computed by the fused evaluation callback at "fused_point"
+   mutable Vector<double> fused_point{};
+   mutable int32_t fused_computed_quantities{0};
+   mutable int32_t fused_needed_quantities{0};
+   mutable double fused_objective{0.};
+   mutable Vector<double> fused_constraints{};
+   mutable Vector<double> fused_gradient{};
+   mutable Vector<double> fused_jacobian{};
+
+   // make sure that the requested quantity is available at x. The function values (objective and constraints) are
+   // requested together, and so are the derivatives (objective gradient and Jacobian), provided that Uno already needed
+   // the companion quantity at some point (e.g. the Jacobian is never evaluated with matrix-free linear solvers)
+   void fused_evaluate(const Vector<double>& x, int32_t requested_quantity) const {
+      this->fused_needed_quantities |= requested_quantity;
+      if (!std::equal(this->fused_point.begin(), this->fused_point.end(), x.data())) {
+         std::copy_n(x.data(), this->number_variables, this->fused_point.data());
+         this->fused_computed_quantities = 0;
+      }
+      if ((this->fused_computed_quantities & requested_quantity) == 0) {
+         const bool function_values = (requested_quantity == UNO_REQUEST_OBJECTIVE || requested_quantity == UNO_REQUEST_CONSTRAINTS);
+         const int32_t companion_quantities = function_values ? (UNO_REQUEST_OBJECTIVE | UNO_REQUEST_CONSTRAINTS) :
+            (UNO_REQUEST_OBJECTIVE_GRADIENT | UNO_REQUEST_JACOBIAN);
+         const int32_t request = (requested_quantity | (companion_quantities & this->fused_needed_quantities)) &
+            ~this->fused_computed_quantities;
+         const int32_t return_code = this->user_model.fused_evaluation(this->user_model.number_variables,
+            this->user_model.number_constraints, this->user_model.number_jacobian_nonzeros, x.data(), request,
+            &this->fused_objective, this->fused_constraints.data(), this->fused_gradient.data(), this->fused_jacobian.data(),
+            this->user_model.user_data);
+         if (0 < return_code) {
+            if (function_values) {
+               throw FunctionEvaluationError();
+            }
+            throw GradientEvaluationError();
+         }
+         this->fused_computed_quantities |= request;
+      }
+   }
 };
 
 struct Solver {
@@ -376,6 +451,13 @@ bool uno_set_constraints(void* model, int32_t number_constraints, Constraints co
    return true;
 }
 
+bool uno_set_fused_evaluation(void* model, FusedEvaluation fused_evaluation) {
+   assert(model != nullptr);
+   CUserModel* user_model = static_cast<CUserModel*>(model);
+   user_model->fused_evaluation = fused_evaluation;
+   return true;
+}
+
 bool uno_set_jacobian_operator(void* model, JacobianOperator jacobian_operator) {
    assert(model != nullptr);
    CUserModel* user_model = static_cast<CUserModel*>(model);
@@ -456,6 +538,47 @@ bool uno_set_lagrangian_hessian_operator(void* model, int32_t number_hessian_non
    return true;
 }
 
+bool uno_set_block_partition(void* model, int32_t number_blocks, const int32_t* variable_blocks,
+      const int32_t* constraint_blocks) {
+   if (number_blocks <= 0) {
+      std::cout << "Please specify a positive number of blocks.\n";
+      return false;
+   }
+
+   assert(model != nullptr);
+   CUserModel* user_model = static_cast<CUserModel*>(model);
+   // converts a user block (in the base indexing of the model) into a block of the partition
+   const auto convert_block = [&](int32_t block, size_t& converted_block) {
+      if (block == UNO_LINKING_BLOCK) {
+         converted_block = BlockPartition::linking;
+         return true;
+      }
+      const int32_t block_index = block - user_model->base_indexing;
+      if (block_index < 0 || number_blocks <= block_index) {
+         std::cout << "The block " << block << " is not a valid block.\n";
+         return false;
+      }
+      converted_block = static_cast<size_t>(block_index);
+      return true;
+   };
+   BlockPartition block_partition;
+   block_partition.number_blocks = static_cast<size_t>(number_blocks);
+   block_partition.variable_blocks.resize(static_cast<size_t>(user_model->number_variables));
+   for (size_t variable_index: Range(static_cast<size_t>(user_model->number_variables))) {
+      if (!convert_block(variable_blocks[variable_index], block_partition.variable_blocks[variable_index])) {
+         return false;
+      }
+   }
+   block_partition.constraint_blocks.resize(static_cast<size_t>(user_model->number_constraints));
+   for (size_t constraint_index: Range(static_cast<size_t>(user_model->number_constraints))) {
+      if (!convert_block(constraint_blocks[constraint_index], block_partition.constraint_blocks[constraint_index])) {
+         return false;
+      }
+   }
+   user_model->block_partition = std::move(block_partition);
+   return true;
+}
+
 bool uno_set_user_data(void* model, void* user_data) {
    assert(model != nullptr);
    CUserModel* user_model = static_cast<CUserModel*>(model);
@@ -508,7 +631,7 @@ void uno_optimize(void* solver, void* model) {
    // check the model
    assert(model != nullptr);
    CUserModel* user_model = static_cast<CUserModel*>(model);
-   if (!user_model->objective_function && !user_model->constraint_functions) {
+   if (!user_model->objective_function && !user_model->constraint_functions && !user_model->fused_evaluation) {
       std::cout << "Please specify at least an objective or constraints.\n";
       return;
    }
@@ -584,6 +707,62 @@ double uno_get_solution_complementarity(void* solver) {
    return result->solution_complementarity;
 }
 
+double uno_get_wall_time(void* solver) {
+   Result* result = uno_get_result(solver);
+   return result->wall_time;
+}
+
+double uno_get_cpu_time(void* solver) {
+   Result* result = uno_get_result(solver);
+   return result->cpu_time;
+}
+
+bool uno_compute_sensitivity(void* solver, void* model, const double* variables_lower_bounds_perturbation,
+      const double* variables_upper_bounds_perturbation, const double* constraints_lower_bounds_perturbation,
+      const double* constraints_upper_bounds_perturbation, double* primal_sensitivity, double* constraint_dual_sensitivity,
+      double* lower_bound_dual_sensitivity, double* upper_bound_dual_sensitivity) {
+   assert(solver != nullptr);
+   assert(model != nullptr);
+   Solver* uno_solver = static_cast<Solver*>(solver);
+   const CUserModel* user_model = static_cast<const CUserModel*>(model);
+   const size_t number_variables = static_cast<size_t>(user_model->number_variables);
+   const size_t number_constraints = static_cast<size_t>(user_model->number_constraints);
+
+   // a null array is a zero perturbation
+   const auto copy_perturbation = [](const double* user_perturbation, Vector<double>& perturbation) {
+      if (user_perturbation != nullptr) {
+         std::copy_n(user_perturbation, perturbation.size(), perturbation.begin());
+      }
+   };
+   BoundPerturbation perturbation{Vector<double>(number_variables, 0.), Vector<double>(number_variables, 0.),
+      Vector<double>(number_constraints, 0.), Vector<double>(number_constraints, 0.)};
+   copy_perturbation(variables_lower_bounds_perturbation, perturbation.variables_lower_bounds);
+   copy_perturbation(variables_upper_bounds_perturbation, perturbation.variables_upper_bounds);
+   copy_perturbation(constraints_lower_bounds_perturbation, perturbation.constraints_lower_bounds);
+   copy_perturbation(constraints_upper_bounds_perturbation, perturbation.constraints_upper_bounds);
+
+   Vector<double> primal_direction(number_variables);
+   Multipliers dual_direction(number_variables, number_constraints);
+   try {
+      uno_solver->solver->compute_sensitivity(perturbation, primal_direction, dual_direction);
+   }
+   catch (const std::exception& exception) {
+      std::cout << exception.what() << '\n';
+      return false;
+   }
+   // the multipliers follow the sign convention of the user (see UnoModel::postprocess_solution)
+   const double sign = -user_model->lagrangian_sign_convention * static_cast<double>(user_model->optimization_sense);
+   std::copy_n(primal_direction.data(), number_variables, primal_sensitivity);
+   for (size_t constraint_index: Range(number_constraints)) {
+      constraint_dual_sensitivity[constraint_index] = sign * dual_direction.constraints[constraint_index];
+   }
+   for (size_t variable_index: Range(number_variables)) {
+      lower_bound_dual_sensitivity[variable_index] = sign * dual_direction.lower_bounds[variable_index];
+      upper_bound_dual_sensitivity[variable_index] = sign * dual_direction.upper_bounds[variable_index];
+   }
+   return true;
+}
+
 void uno_destroy_model(void* model) {
    assert(model != nullptr);
    delete static_cast<CUserModel*>(model);
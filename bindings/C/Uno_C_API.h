@@ -47,6 +47,15 @@ extern "C" {
    const int32_t UNO_INFEASIBLE_SMALL_STEP = 5;
    const int32_t UNO_UNBOUNDED = 6;
 
+   // Quantities requested from a fused evaluation callback (bitmask)
+   const int32_t UNO_REQUEST_OBJECTIVE = 1;
+   const int32_t UNO_REQUEST_CONSTRAINTS = 2;
+   const int32_t UNO_REQUEST_OBJECTIVE_GRADIENT = 4;
+   const int32_t UNO_REQUEST_JACOBIAN = 8;
+
+   // Block of the linking variables and constraints of a block partition
+   const int32_t UNO_LINKING_BLOCK = -1;
+
    // current Uno version is 2.2.0
    const int32_t UNO_VERSION_MAJOR = 2;
    const int32_t UNO_VERSION_MINOR = 2;
@@ -113,6 +122,16 @@ extern "C" {
       bool evaluate_at_x, double objective_multiplier, const double* multipliers, const double* vector,
       double* result, void* user_data);
 
+   // - takes as inputs a vector "x" of size "number_variables", a bitmask "request" (a combination of UNO_REQUEST_OBJECTIVE,
+   // UNO_REQUEST_CONSTRAINTS, UNO_REQUEST_OBJECTIVE_GRADIENT and UNO_REQUEST_JACOBIAN) and an object "user_data", and
+   // stores the requested quantities at "x" in "objective_value", "constraint_values" (size "number_constraints"),
+   // "gradient" (size "number_variables") and "jacobian" (size "number_jacobian_nonzeros"). The arrays of the quantities
+   // that are not requested should not be accessed.
+   // - returns an integer that is 0 if the evaluations succeeded, and positive otherwise.
+   typedef int32_t (*FusedEvaluation)(int32_t number_variables, int32_t number_constraints, int32_t number_jacobian_nonzeros,
+      const double* x, int32_t request, double* objective_value, double* constraint_values, double* gradient, double* jacobian,
+      void* user_data);
+
    // creates an optimization model that can be solved by Uno.
    // initially, the model contains "number_variables" variables, no objective function, and no constraints.
    // takes as inputs the type of problem ('L' for linear, 'Q' for quadratic, 'N' for nonlinear), the number of
@@ -139,6 +158,16 @@ extern "C" {
       const double* constraints_lower_bounds, const double* constraints_upper_bounds, int32_t number_jacobian_nonzeros,
       const int32_t* jacobian_row_indices, const int32_t* jacobian_column_indices, Jacobian constraint_jacobian);
 
+   // [optional]
+   // sets a fused evaluation callback that computes several quantities (objective, constraints, objective gradient,
+   // constraint Jacobian) in a single call. It replaces the objective, constraint, gradient and Jacobian callbacks, which
+   // can then be null. The optimization sense, the constraint bounds and the Jacobian sparsity are still set with
+   // "uno_set_objective" and "uno_set_constraints".
+   // Uno requests the objective and the constraints together, and the objective gradient and the Jacobian together (once
+   // it has needed both), and reuses the results as long as the point does not change.
+   // returns true if it succeeded, false otherwise.
+   bool uno_set_fused_evaluation(void* model, FusedEvaluation fused_evaluation);
+
    // [optional]
    // sets the Jacobian operator (computes Jacobian-vector products) of a given model.
    // returns true if it succeeded, false otherwise.
@@ -173,6 +202,16 @@ extern "C" {
    bool uno_set_lagrangian_hessian_operator(void* model, int32_t number_hessian_nonzeros,
       HessianOperator lagrangian_hessian_operator, double lagrangian_sign_convention);
 
+   // [optional]
+   // sets a partition of the variables and constraints of a given model into independent blocks (e.g. the scenarios of a
+   // two-stage stochastic model or the periods of a multiperiod model), exploited by the "SchurComplement" linear solver.
+   // takes as inputs the number of blocks and two arrays of size "number_variables" and "number_constraints" that contain
+   // the block of each variable and constraint (following the base indexing of the model), or UNO_LINKING_BLOCK for the
+   // variables and constraints that couple the blocks. Must be called after "uno_set_constraints".
+   // returns true if it succeeded, false otherwise.
+   bool uno_set_block_partition(void* model, int32_t number_blocks, const int32_t* variable_blocks,
+      const int32_t* constraint_blocks);
+
    // [optional]
    // sets the user data of a given model.
    // returns true if it succeeded, false otherwise.
@@ -231,6 +270,27 @@ extern "C" {
    // gets the complementarity at the solution (once the model was solved)
    double uno_get_solution_complementarity(void* solver);
 
+   // gets the wall-clock time (in seconds) spent in the last solve (once the model was solved)
+   double uno_get_wall_time(void* solver);
+
+   // gets the CPU time (in seconds) spent in the last solve, summed over all threads (once the model was solved)
+   double uno_get_cpu_time(void* solver);
+
+   // [optional]
+   // computes the first-order sensitivity of the primal-dual solution with respect to a perturbation of the bounds (once
+   // the model was solved with the option "sensitivity_analysis" set to "yes" and the interior-point method). Each call
+   // is a single solve with the factorization of the KKT matrix at the solution (e.g. in a model predictive control loop).
+   // takes as inputs the solved model, four arrays of perturbations of the variable and constraint bounds (a NULL array
+   // is a zero perturbation; a fixed variable, e.g. a parameter, or an equality constraint is perturbed with its lower
+   // bound), and four arrays of sizes "number_variables", "number_constraints", "number_variables" and
+   // "number_variables" into which the sensitivities of the primal solution, the constraint dual solution, and the lower
+   // and upper bound dual solutions are written.
+   // returns true if it succeeded, false otherwise.
+   bool uno_compute_sensitivity(void* solver, void* model, const double* variables_lower_bounds_perturbation,
+      const double* variables_upper_bounds_perturbation, const double* constraints_lower_bounds_perturbation,
+      const double* constraints_upper_bounds_perturbation, double* primal_sensitivity, double* constraint_dual_sensitivity,
+      double* lower_bound_dual_sensitivity, double* upper_bound_dual_sensitivity);
+
    // destroys a given Uno model. Once destroyed, the model cannot be used anymore.
    void uno_destroy_model(void* model);
 
@@ -39,9 +39,11 @@ namespace uno {
    double PythonModel::evaluate_objective(const Vector<double>& x) const {
       double objective_value = 0.;
       if (this->user_model.objective_function.has_value()) {
-         const py::object user_data = this->user_model.user_data.has_value() ? *this->user_model.user_data : py::cast(nullptr);
+         // Uno runs without the GIL: acquire it for the duration of the callback
+         py::gil_scoped_acquire acquire;
          const int32_t return_code = (*this->user_model.objective_function)(static_cast<int32_t>(this->number_variables),
-            x, &objective_value, user_data);
+            PythonModel::read_only_view(x.data(), this->number_variables), PythonModel::view(&objective_value, 1),
+            this->user_data());
          if (0 < return_code) {
             throw FunctionEvaluationError();
          }
@@ -52,9 +54,10 @@ namespace uno {
 
    void PythonModel::evaluate_constraints(const Vector<double>& x, Vector<double>& constraints) const {
       if (this->user_model.constraint_functions.has_value()) {
-         const py::object user_data = this->user_model.user_data.has_value() ? *this->user_model.user_data : py::cast(nullptr);
+         py::gil_scoped_acquire acquire;
          const int32_t return_code = (*this->user_model.constraint_functions)(static_cast<int32_t>(this->number_variables),
-            static_cast<int32_t>(this->number_constraints), x, constraints.data(), user_data);
+            static_cast<int32_t>(this->number_constraints), PythonModel::read_only_view(x.data(), this->number_variables),
+            PythonModel::view(constraints.data(), this->number_constraints), this->user_data());
          if (0 < return_code) {
             throw FunctionEvaluationError();
          }
@@ -63,11 +66,14 @@ namespace uno {
 
    void PythonModel::evaluate_objective_gradient(const Vector<double>& x, Vector<double>& gradient) const {
       if (this->user_model.objective_gradient.has_value()) {
-         const py::object user_data = this->user_model.user_data.has_value() ? *this->user_model.user_data : py::cast(nullptr);
-         const int32_t return_code = (*this->user_model.objective_gradient)(static_cast<int32_t>(this->number_variables),
-            x, gradient.data(), user_data);
-         if (0 < return_code) {
-            throw GradientEvaluationError();
+         {
+            py::gil_scoped_acquire acquire;
+            const int32_t return_code = (*this->user_model.objective_gradient)(static_cast<int32_t>(this->number_variables),
+               PythonModel::read_only_view(x.data(), this->number_variables), PythonModel::view(gradient.data(), this->number_variables),
+               this->user_data());
+            if (0 < return_code) {
+               throw GradientEvaluationError();
+            }
          }
          for (size_t variable_index: Range(this->number_variables)) {
             gradient[variable_index] *= this->optimization_sense;
@@ -109,9 +115,10 @@ namespace uno {
 
    void PythonModel::evaluate_constraint_jacobian(const Vector<double>& x, double* jacobian_values) const {
       if (this->user_model.constraint_jacobian.has_value()) {
-         const py::object user_data = this->user_model.user_data.has_value() ? *this->user_model.user_data : py::cast(nullptr);
+         py::gil_scoped_acquire acquire;
          const int32_t return_code = (*this->user_model.constraint_jacobian)(static_cast<int32_t>(this->number_variables),
-            static_cast<int32_t>(this->number_jacobian_nonzeros()), x, jacobian_values, user_data);
+            static_cast<int32_t>(this->number_jacobian_nonzeros()), PythonModel::read_only_view(x.data(), this->number_variables),
+            PythonModel::view(jacobian_values, this->number_jacobian_nonzeros()), this->user_data());
          if (0 < return_code) {
             throw GradientEvaluationError();
          }
@@ -126,10 +133,15 @@ namespace uno {
          if (this->user_model.lagrangian_sign_convention == UNO_MULTIPLIER_POSITIVE) {
             const_cast<Vector<double>&>(multipliers).scale(-1.);
          }
-         const py::object user_data = this->user_model.user_data.has_value() ? *this->user_model.user_data : py::cast(nullptr);
-         const int32_t return_code = (*this->user_model.lagrangian_hessian)(static_cast<int32_t>(this->number_variables),
-            static_cast<int32_t>(this->number_constraints), static_cast<int32_t>(this->number_hessian_nonzeros()), x,
-            objective_multiplier, multipliers, hessian_values, user_data);
+         int32_t return_code;
+         {
+            py::gil_scoped_acquire acquire;
+            return_code = (*this->user_model.lagrangian_hessian)(static_cast<int32_t>(this->number_variables),
+               static_cast<int32_t>(this->number_constraints), static_cast<int32_t>(this->number_hessian_nonzeros()),
+               PythonModel::read_only_view(x.data(), this->number_variables), objective_multiplier,
+               PythonModel::read_only_view(multipliers.data(), this->number_constraints),
+               PythonModel::view(hessian_values, this->number_hessian_nonzeros()), this->user_data());
+         }
          // flip the signs of the multipliers back
          if (this->user_model.lagrangian_sign_convention == UNO_MULTIPLIER_POSITIVE) {
             const_cast<Vector<double>&>(multipliers).scale(-1.);
@@ -145,9 +157,11 @@ namespace uno {
 
    void PythonModel::compute_jacobian_vector_product(const double* x, const double* vector, double* result) const {
       if (this->user_model.jacobian_operator.has_value()) {
-         const py::object user_data = this->user_model.user_data.has_value() ? *this->user_model.user_data : py::cast(nullptr);
+         py::gil_scoped_acquire acquire;
          const int32_t return_code = (*this->user_model.jacobian_operator)(static_cast<int32_t>(this->number_variables),
-            static_cast<int32_t>(this->number_constraints), x, true, vector, result, user_data);
+            static_cast<int32_t>(this->number_constraints), PythonModel::read_only_view(x, this->number_variables), true,
+            PythonModel::read_only_view(vector, this->number_variables), PythonModel::view(result, this->number_constraints),
+            this->user_data());
          if (0 < return_code) {
             throw GradientEvaluationError();
          }
@@ -159,9 +173,11 @@ namespace uno {
 
    void PythonModel::compute_jacobian_transposed_vector_product(const double* x, const double* vector, double* result) const {
       if (this->user_model.jacobian_transposed_operator.has_value()) {
-         const py::object user_data = this->user_model.user_data.has_value() ? *this->user_model.user_data : py::cast(nullptr);
+         py::gil_scoped_acquire acquire;
          const int32_t return_code = (*this->user_model.jacobian_transposed_operator)(static_cast<int32_t>(this->number_variables),
-            static_cast<int32_t>(this->number_constraints), x, true, vector, result, user_data);
+            static_cast<int32_t>(this->number_constraints), PythonModel::read_only_view(x, this->number_variables), true,
+            PythonModel::read_only_view(vector, this->number_constraints), PythonModel::view(result, this->number_variables),
+            this->user_data());
          if (0 < return_code) {
             throw GradientEvaluationError();
          }
@@ -179,9 +195,15 @@ namespace uno {
          if (this->user_model.lagrangian_sign_convention == UNO_MULTIPLIER_POSITIVE) {
             const_cast<Vector<double>&>(multipliers).scale(-1.);
          }
-         const py::object user_data = this->user_model.user_data.has_value() ? *this->user_model.user_data : py::cast(nullptr);
-         const int32_t return_code = (*this->user_model.lagrangian_hessian_operator)(static_cast<int32_t>(this->number_variables),
-            static_cast<int32_t>(this->number_constraints), x, true, objective_multiplier, multipliers, vector, result, user_data);
+         int32_t return_code;
+         {
+            py::gil_scoped_acquire acquire;
+            return_code = (*this->user_model.lagrangian_hessian_operator)(static_cast<int32_t>(this->number_variables),
+               static_cast<int32_t>(this->number_constraints), PythonModel::read_only_view(x, this->number_variables), true,
+               objective_multiplier, PythonModel::read_only_view(multipliers.data(), this->number_constraints),
+               PythonModel::read_only_view(vector, this->number_variables), PythonModel::view(result, this->number_variables),
+               this->user_data());
+         }
          // flip the signs of the multipliers back
          if (this->user_model.lagrangian_sign_convention == UNO_MULTIPLIER_POSITIVE) {
             const_cast<Vector<double>&>(multipliers).scale(-1.);
@@ -280,4 +302,22 @@ namespace uno {
    size_t PythonModel::number_hessian_nonzeros() const {
       return static_cast<size_t>(this->user_model.number_hessian_nonzeros);
    }
-} // namespace
\ No newline at end of file
+
+   // protected member functions
+
+   // the GIL must be held
+   py::object PythonModel::user_data() const {
+      return this->user_model.user_data.has_value() ? *this->user_model.user_data : py::none();
+   }
+
+   // NumPy view over a buffer of Uno. Passing a base object prevents pybind11 from copying the data. The GIL must be held
+   NumPyVector PythonModel::view(double* data, size_t size) {
+      return NumPyVector(static_cast<py::ssize_t>(size), data, py::none());
+   }
+
+   NumPyVector PythonModel::read_only_view(const double* data, size_t size) {
+      NumPyVector view(static_cast<py::ssize_t>(size), data, py::none());
+      py::detail::array_proxy(view.ptr())->flags &= ~py::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+      return view;
+   }
+} // namespace
@@ -74,6 +74,10 @@ namespace uno {
       CollectionAdapter<std::vector<size_t>> equality_constraints_collection;
       std::vector<size_t> inequality_constraints;
       CollectionAdapter<std::vector<size_t>> inequality_constraints_collection;
+
+      [[nodiscard]] py::object user_data() const;
+      [[nodiscard]] static NumPyVector view(double* data, size_t size);
+      [[nodiscard]] static NumPyVector read_only_view(const double* data, size_t size);
    };
 } // namespace
 
@@ -2,7 +2,12 @@
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
 #include "UnoSolverWrapper.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
 #include "model/Model.hpp"
+#include "optimization/Multipliers.hpp"
+#include "optimization/SensitivityAnalysis.hpp"
 #include "options/DefaultOptions.hpp"
 #include "tools/Logger.hpp"
 
@@ -14,6 +19,44 @@ namespace uno {
    Result UnoSolverWrapper::optimize(const PythonUserModel& user_model) {
       const PythonModel model{user_model};
       Logger::set_logger(this->options.get_string("logger"));
+      // release the GIL while Uno is running, so that other Python threads can make progress (e.g. solve other models).
+      // The callbacks of the model acquire it when they call Python
+      py::gil_scoped_release release;
       return this->uno_solver.solve(model, this->options);
    }
+
+   std::tuple<Vector<double>, Vector<double>, Vector<double>, Vector<double>> UnoSolverWrapper::compute_sensitivity(
+         const PythonUserModel& user_model, const std::vector<double>& variables_lower_bounds_perturbation,
+         const std::vector<double>& variables_upper_bounds_perturbation,
+         const std::vector<double>& constraints_lower_bounds_perturbation,
+         const std::vector<double>& constraints_upper_bounds_perturbation) {
+      const size_t number_variables = static_cast<size_t>(user_model.number_variables);
+      const size_t number_constraints = static_cast<size_t>(user_model.number_constraints);
+      // an empty perturbation is zero
+      const auto copy_perturbation = [](const std::vector<double>& user_perturbation, Vector<double>& perturbation) {
+         if (!user_perturbation.empty()) {
+            if (user_perturbation.size() != perturbation.size()) {
+               throw std::invalid_argument("The dimension of the perturbation does not match that of the model");
+            }
+            std::copy(user_perturbation.begin(), user_perturbation.end(), perturbation.begin());
+         }
+      };
+      BoundPerturbation perturbation{Vector<double>(number_variables, 0.), Vector<double>(number_variables, 0.),
+         Vector<double>(number_constraints, 0.), Vector<double>(number_constraints, 0.)};
+      copy_perturbation(variables_lower_bounds_perturbation, perturbation.variables_lower_bounds);
+      copy_perturbation(variables_upper_bounds_perturbation, perturbation.variables_upper_bounds);
+      copy_perturbation(constraints_lower_bounds_perturbation, perturbation.constraints_lower_bounds);
+      copy_perturbation(constraints_upper_bounds_perturbation, perturbation.constraints_upper_bounds);
+
+      Vector<double> primal_sensitivity(number_variables);
+      Multipliers dual_sensitivity(number_variables, number_constraints);
+      this->uno_solver.compute_sensitivity(perturbation, primal_sensitivity, dual_sensitivity);
+      // the multipliers follow the sign convention of the user (see PythonModel::postprocess_solution)
+      const double sign = -user_model.lagrangian_sign_convention * static_cast<double>(user_model.optimization_sense);
+      dual_sensitivity.constraints *= sign;
+      dual_sensitivity.lower_bounds *= sign;
+      dual_sensitivity.upper_bounds *= sign;
+      return {std::move(primal_sensitivity), std::move(dual_sensitivity.constraints),
+         std::move(dual_sensitivity.lower_bounds), std::move(dual_sensitivity.upper_bounds)};
+   }
 } // namespace
\ No newline at end of file
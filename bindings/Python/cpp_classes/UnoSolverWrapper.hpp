@@ -4,6 +4,8 @@
 #ifndef UNO_UNOSOLVERWRAPPER_H
 #define UNO_UNOSOLVERWRAPPER_H
 
+#include <tuple>
+#include <vector>
 #include "Uno.hpp"
 #include "options/Options.hpp"
 #include "PythonModel.hpp"
@@ -17,6 +19,13 @@ namespace uno {
       UnoSolverWrapper();
 
       [[nodiscard]] Result optimize(const PythonUserModel& user_model);
+      // sensitivities of the primal solution, the constraint dual solution, and the lower and upper bound dual solutions
+      // with respect to a perturbation of the bounds (an empty perturbation is zero)
+      [[nodiscard]] std::tuple<Vector<double>, Vector<double>, Vector<double>, Vector<double>> compute_sensitivity(
+         const PythonUserModel& user_model, const std::vector<double>& variables_lower_bounds_perturbation,
+         const std::vector<double>& variables_upper_bounds_perturbation,
+         const std::vector<double>& constraints_lower_bounds_perturbation,
+         const std::vector<double>& constraints_upper_bounds_perturbation);
    };
 } // namespace
 
@@ -103,6 +103,7 @@ if __name__ == '__main__':
 	print("Lower bound dual solution:", result.lower_bound_dual_solution)
 	print("Upper bound dual solution:", result.upper_bound_dual_solution)
 	print("Number of iterations:", result.number_iterations)
+	print("Wall-clock time:", result.wall_time)
 	print("CPU time:", result.cpu_time)
 	print("Number of objective evaluations:", result.number_objective_evaluations)
 	print("Number of constraint evaluations:", result.number_constraint_evaluations)
@@ -21,6 +21,7 @@ namespace uno {
       .def_readonly("lower_bound_dual_solution", &Result::lower_bound_dual_solution)
       .def_readonly("upper_bound_dual_solution", &Result::upper_bound_dual_solution)
       .def_readonly("number_iterations", &Result::number_iterations)
+      .def_readonly("wall_time", &Result::wall_time)
       .def_readonly("cpu_time", &Result::cpu_time)
       .def_readonly("number_objective_evaluations", &Result::number_objective_evaluations)
       .def_readonly("number_constraint_evaluations", &Result::number_constraint_evaluations)
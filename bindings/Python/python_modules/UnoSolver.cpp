@@ -4,6 +4,7 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <string>
+#include <vector>
 #include "../cpp_classes/PythonModel.hpp"
 #include "../cpp_classes/UnoSolverWrapper.hpp"
 #include "options/Presets.hpp"
@@ -27,6 +28,19 @@ namespace uno {
 
          .def("optimize", [](UnoSolverWrapper& solver, const PythonUserModel& user_model) {
             return solver.optimize(user_model);
-         }, py::arg("model"), "Optimize an optimization model with the Uno solver");
+         }, py::arg("model"), "Optimize an optimization model with the Uno solver")
+
+         .def("compute_sensitivity", [](UnoSolverWrapper& solver, const PythonUserModel& user_model,
+               const std::vector<double>& variables_lower_bounds_perturbation,
+               const std::vector<double>& variables_upper_bounds_perturbation,
+               const std::vector<double>& constraints_lower_bounds_perturbation,
+               const std::vector<double>& constraints_upper_bounds_perturbation) {
+            return solver.compute_sensitivity(user_model, variables_lower_bounds_perturbation, variables_upper_bounds_perturbation,
+               constraints_lower_bounds_perturbation, constraints_upper_bounds_perturbation);
+         }, py::arg("model"), py::arg("variables_lower_bounds_perturbation") = std::vector<double>{},
+            py::arg("variables_upper_bounds_perturbation") = std::vector<double>{},
+            py::arg("constraints_lower_bounds_perturbation") = std::vector<double>{},
+            py::arg("constraints_upper_bounds_perturbation") = std::vector<double>{},
+            "Compute the first-order sensitivity of the solution with respect to a perturbation of the bounds");
    }
 } // namespace
\ No newline at end of file
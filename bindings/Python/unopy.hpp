@@ -8,32 +8,35 @@
 #include <optional>
 #include <vector>
 #include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
 #include "../UserModel.hpp"
-#include "linear_algebra/Vector.hpp"
-#include "tools/PointerWrapper.hpp"
 
 namespace py = pybind11;
 
 namespace uno {
-   using Objective = std::function<int(int32_t, const Vector<double>&, PointerWrapper<double>, const py::object&)>;
+   // the vectors are passed to the callbacks as NumPy views over the buffers of Uno (no copy). The inputs are read-only, the
+   // outputs are filled in place. The views are only valid during the call
+   using NumPyVector = py::array_t<double>;
 
-   using Constraints = std::function<int(int32_t, int32_t, const Vector<double>&, PointerWrapper<double>, const py::object&)>;
+   using Objective = std::function<int(int32_t, const NumPyVector&, const NumPyVector&, const py::object&)>;
 
-   using ObjectiveGradient = std::function<int(int32_t, const Vector<double>&, PointerWrapper<double>, const py::object&)>;
+   using Constraints = std::function<int(int32_t, int32_t, const NumPyVector&, const NumPyVector&, const py::object&)>;
 
-   using Jacobian = std::function<int(int32_t, int32_t, const Vector<double>&, PointerWrapper<double>, const py::object&)>;
+   using ObjectiveGradient = std::function<int(int32_t, const NumPyVector&, const NumPyVector&, const py::object&)>;
 
-   using Hessian = std::function<int(int32_t, int32_t, int32_t, const Vector<double>&, double, const Vector<double>&,
-      PointerWrapper<double>, const py::object&)>;
+   using Jacobian = std::function<int(int32_t, int32_t, const NumPyVector&, const NumPyVector&, const py::object&)>;
 
-   using JacobianOperator = std::function<int(int32_t, int32_t, PointerWrapper<const double>, bool, PointerWrapper<const double>,
-      PointerWrapper<double>, const py::object&)>;
+   using Hessian = std::function<int(int32_t, int32_t, int32_t, const NumPyVector&, double, const NumPyVector&,
+      const NumPyVector&, const py::object&)>;
 
-   using JacobianTransposedOperator = std::function<int(int32_t, int32_t, PointerWrapper<const double>, bool,
-      PointerWrapper<const double>, PointerWrapper<double>, const py::object&)>;
+   using JacobianOperator = std::function<int(int32_t, int32_t, const NumPyVector&, bool, const NumPyVector&,
+      const NumPyVector&, const py::object&)>;
 
-   using HessianOperator = std::function<int(int32_t, int32_t, PointerWrapper<const double>, bool, double,
-      const Vector<double>&, PointerWrapper<const double>, PointerWrapper<double>, const py::object&)>;
+   using JacobianTransposedOperator = std::function<int(int32_t, int32_t, const NumPyVector&, bool, const NumPyVector&,
+      const NumPyVector&, const py::object&)>;
+
+   using HessianOperator = std::function<int(int32_t, int32_t, const NumPyVector&, bool, double, const NumPyVector&,
+      const NumPyVector&, const NumPyVector&, const py::object&)>;
 
    using PythonUserModel = UserModel<std::optional<Objective>, std::optional<ObjectiveGradient>, std::optional<Constraints>,
       std::optional<Jacobian>, std::optional<JacobianOperator>, std::optional<JacobianTransposedOperator>,
@@ -1,6 +1,7 @@
 // Copyright (c) 2018-2024 Charlie Vanaret
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
+#include <stdexcept>
 #include "Uno.hpp"
 #include "ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategy.hpp"
 #include "ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategyFactory.hpp"
@@ -12,11 +13,15 @@
 #include "ingredients/subproblem_solvers/SymmetricIndefiniteLinearSolverFactory.hpp"
 #include "linear_algebra/Vector.hpp"
 #include "model/BoundRelaxedModel.hpp"
+#include "model/CachedModel.hpp"
 #include "model/FixedBoundsConstraintsModel.hpp"
 #include "model/HomogeneousEqualityConstrainedModel.hpp"
 #include "model/Model.hpp"
 #include "optimization/Iterate.hpp"
+#include "optimization/Multipliers.hpp"
 #include "optimization/WarmstartInformation.hpp"
+#include "tools/BufferedLogger.hpp"
+#include "tools/IterationSink.hpp"
 #include "tools/Logger.hpp"
 #include "optimization/OptimizationStatus.hpp"
 #include "options/Options.hpp"
@@ -25,7 +30,7 @@
 #include "tools/UserCallbacks.hpp"
 
 namespace uno {
-   Level Logger::level = INFO;
+   thread_local Level Logger::level = INFO;
 
    // solve without user callbacks
    Result Uno::solve(const Model& model, const Options& options) {
@@ -36,10 +41,25 @@ namespace uno {
 
    // solve with user callbacks
    Result Uno::solve(const Model& model, const Options& options, UserCallbacks& user_callbacks) {
+      // the messages of this solve are buffered and written into the sink by a separate thread
+      BufferedLogger logger(this->create_log_sink(options));
       DISCRETE << "Original model " << model.name << '\n' << model.number_variables << " variables, " <<
          model.number_constraints << " constraints (" << model.get_equality_constraints().size() <<
          " equality, " << model.get_inequality_constraints().size() << " inequality)\n";
 
+      // remember the evaluations at the last few points
+      const size_t evaluation_cache_size = options.get_unsigned_int("evaluation_cache_size");
+      if (0 < evaluation_cache_size) {
+         const CachedModel cached_model(model, evaluation_cache_size);
+         Result result = this->reformulate_and_solve(cached_model, options, user_callbacks);
+         DISCRETE << "Evaluation cache: " << cached_model.get_number_hits() << " hits, " << cached_model.get_number_misses() <<
+            " misses\n";
+         return result;
+      }
+      return this->reformulate_and_solve(model, options, user_callbacks);
+   }
+
+   Result Uno::reformulate_and_solve(const Model& model, const Options& options, UserCallbacks& user_callbacks) {
       // reformulate the model if it is to be solved with an interior-point method
       if (options.get_string("inequality_handling_method") == "primal_dual_interior_point") {
          // move the fixed variables to the set of general constraints
@@ -52,7 +72,11 @@ namespace uno {
          DISCRETE << "Reformulated model " << bound_relaxed_model.name << '\n' << bound_relaxed_model.number_variables << " variables, " <<
             bound_relaxed_model.number_constraints << " constraints (" << bound_relaxed_model.get_equality_constraints().size() <<
             " equality, " << bound_relaxed_model.get_inequality_constraints().size() << " inequality)\n";
-         return uno_solve(bound_relaxed_model, options, user_callbacks);
+         Result result = uno_solve(bound_relaxed_model, options, user_callbacks);
+         if (this->sensitivity_analysis.is_available()) {
+            this->sensitivity_analysis.set_original_model(model);
+         }
+         return result;
       }
       else {
          return uno_solve(model, options, user_callbacks);
@@ -62,6 +86,7 @@ namespace uno {
    // protected solve function
    Result Uno::uno_solve(const Model& model, const Options& options, UserCallbacks& user_callbacks) {
       const Timer timer{};
+      this->sensitivity_analysis.reset();
       // pick the ingredients based on the user-defined options
       Uno::pick_ingredients(model, options);
       Statistics statistics = Uno::create_statistics(model, options);
@@ -76,7 +101,8 @@ namespace uno {
       size_t major_iterations = 0;
       OptimizationStatus optimization_status = OptimizationStatus::SUCCESS;
       const size_t max_iterations = options.get_unsigned_int("max_iterations"); // maximum number of iterations
-      const double time_limit = options.get_double("time_limit"); // CPU time limit (can be inf)
+      const double time_limit = options.get_double("time_limit"); // wall-clock time limit (can be inf)
+      const double cpu_time_limit = options.get_double("cpu_time_limit"); // CPU time limit (can be inf)
       try {
          // use the initial primal-dual point to initialize the strategies and generate the initial iterate
          this->initialize(statistics, model, current_iterate, options);
@@ -98,8 +124,8 @@ namespace uno {
                   *this->globalization_strategy, model, current_iterate, trial_iterate, this->direction, warmstart_information,
                   user_callbacks);
                GlobalizationMechanism::set_dual_residuals_statistics(statistics, trial_iterate);
-               termination = Uno::termination_criteria(trial_iterate.status, major_iterations, max_iterations,
-                  timer.get_duration(), time_limit, optimization_status);
+               termination = Uno::termination_criteria(trial_iterate.status, major_iterations, max_iterations, timer,
+                  time_limit, cpu_time_limit, optimization_status);
                user_callbacks.notify_new_primals(trial_iterate.primals);
                user_callbacks.notify_new_multipliers(trial_iterate.multipliers);
 
@@ -110,12 +136,15 @@ namespace uno {
          catch (std::exception& exception) {
             statistics.start_new_line();
             statistics.set("status", exception.what());
-            if (Logger::level == INFO) statistics.print_current_line();
+            statistics.print_current_line();
             DEBUG << exception.what() << '\n';
             optimization_status = OptimizationStatus::ALGORITHMIC_ERROR;
          }
-         if (Logger::level == INFO) statistics.print_footer();
+         statistics.print_footer();
 
+         if (optimization_status == OptimizationStatus::SUCCESS && options.get_bool("sensitivity_analysis")) {
+            this->prepare_sensitivity_analysis(statistics, model, current_iterate, warmstart_information, options);
+         }
          Uno::postprocess_iterate(model, current_iterate);
       }
       catch (const std::exception& e) {
@@ -127,6 +156,18 @@ namespace uno {
       return result;
    }
    
+   void Uno::compute_sensitivity(const BoundPerturbation& perturbation, Vector<double>& primal_sensitivity,
+         Multipliers& dual_sensitivity) {
+      if (this->constraint_relaxation_strategy == nullptr) {
+         throw std::runtime_error("The sensitivity analysis is not available: no model was solved");
+      }
+      this->sensitivity_analysis.compute(*this->constraint_relaxation_strategy, perturbation, primal_sensitivity, dual_sensitivity);
+   }
+
+   void Uno::set_log_callback(std::function<void(std::string_view)> callback) {
+      this->log_callback = std::move(callback);
+   }
+
    std::string Uno::current_version() {
       return "2.2.0";
    }
@@ -143,6 +184,17 @@ namespace uno {
       std::cout << "- Presets: filtersqp, ipopt\n";
    }
 
+   std::unique_ptr<LogSink> Uno::create_log_sink(const Options& options) const {
+      if (this->log_callback) {
+         return std::make_unique<CallbackLogSink>(this->log_callback);
+      }
+      const std::string& log_file = options.get_string("log_file");
+      if (log_file.empty()) {
+         return std::make_unique<StandardOutputLogSink>();
+      }
+      return std::make_unique<FileLogSink>(log_file);
+   }
+
    void Uno::pick_ingredients(const Model& model, const Options& options) {
       const bool unconstrained_model = (model.number_constraints == 0);
       this->constraint_relaxation_strategy = ConstraintRelaxationStrategyFactory::create(unconstrained_model, options);
@@ -164,15 +216,15 @@ namespace uno {
       this->globalization_mechanism->initialize(statistics, options);
 
       options.print_used_overwritten();
-      if (Logger::level == INFO) {
-         statistics.print_header();
-         statistics.print_current_line();
-      }
+      statistics.print_header();
+      statistics.print_current_line();
       current_iterate.status = SolutionStatus::NOT_OPTIMAL;
    }
 
    Statistics Uno::create_statistics(const Model& model, const Options& options) {
-      Statistics statistics{};
+      // the iteration table is only filled when it is printed or logged into a sink
+      Statistics statistics(Logger::level == INFO);
+      statistics.set_sink(IterationSink::create(options));
       statistics.add_column("iter", Statistics::int_width, options.get_int("statistics_major_column_order"));
       statistics.add_column("step norm", Statistics::double_width - 5, options.get_int("statistics_step_norm_column_order"));
       statistics.add_column("objective", Statistics::double_width - 5, options.get_int("statistics_objective_column_order"));
@@ -185,8 +237,8 @@ namespace uno {
       return statistics;
    }
 
-   bool Uno::termination_criteria(SolutionStatus solution_status, size_t iteration, size_t max_iterations, double current_time,
-         double time_limit, OptimizationStatus& optimization_status) {
+   bool Uno::termination_criteria(SolutionStatus solution_status, size_t iteration, size_t max_iterations, const Timer& timer,
+         double time_limit, double cpu_time_limit, OptimizationStatus& optimization_status) {
       if (solution_status != SolutionStatus::NOT_OPTIMAL) {
          return true;
       }
@@ -194,29 +246,55 @@ namespace uno {
          optimization_status = OptimizationStatus::ITERATION_LIMIT;
          return true;
       }
-      else if (time_limit <= current_time) {
+      else if (time_limit <= timer.get_duration() || cpu_time_limit <= timer.get_cpu_duration()) {
          optimization_status = OptimizationStatus::TIME_LIMIT;
          return true;
       }
       return false;
    }
 
+   // the last factorization of the KKT matrix was performed at the previous iterate: factorize it at the solution, where
+   // the barrier terms may differ by orders of magnitude
+   void Uno::prepare_sensitivity_analysis(Statistics& statistics, const Model& model, Iterate& solution,
+         WarmstartInformation& warmstart_information, const Options& options) {
+      if (options.get_string("inequality_handling_method") != "primal_dual_interior_point") {
+         WARNING << "The sensitivity analysis requires the primal-dual interior-point method\n";
+         return;
+      }
+      try {
+         warmstart_information.iterate_changed();
+         this->constraint_relaxation_strategy->compute_feasible_direction(statistics, *this->globalization_strategy, model,
+            solution, this->direction, INF<double>, warmstart_information);
+         if (!this->constraint_relaxation_strategy->solving_feasibility_problem() &&
+               this->direction.status != SubproblemStatus::INFEASIBLE) {
+            this->sensitivity_analysis.initialize(model, solution);
+         }
+         else {
+            WARNING << "The sensitivity analysis is not available: the KKT matrix at the solution could not be factorized\n";
+         }
+      }
+      catch (const std::exception& exception) {
+         WARNING << "The sensitivity analysis is not available: " << exception.what() << '\n';
+      }
+   }
+
    void Uno::postprocess_iterate(const Model& model, Iterate& iterate) {
       // in case the objective was not yet evaluated, evaluate it
       iterate.evaluate_objective(model);
       model.postprocess_solution(iterate);
-      DEBUG2 << "Final iterate:\n" << iterate;
+      UNO_LOG(DEBUG2) << "Final iterate:\n" << iterate;
    }
 
-   Result Uno::create_result(const Model& model, OptimizationStatus optimization_status, Iterate& solution, size_t major_iterations,
+   Result Uno::create_result(const Model& /*model*/, OptimizationStatus optimization_status, Iterate& solution, size_t major_iterations,
          const Timer& timer) const {
       const size_t number_subproblems_solved = this->constraint_relaxation_strategy->get_number_subproblems_solved();
       const size_t number_hessian_evaluations = this->constraint_relaxation_strategy->get_hessian_evaluation_count();
-      return {model.number_variables, model.number_constraints, optimization_status, solution.status,
+      // the dimensions of the solution are those of the original model (see postprocess_iterate)
+      return {solution.number_variables, solution.number_constraints, optimization_status, solution.status,
          solution.evaluations.objective, solution.progress.infeasibility, solution.residuals.stationarity,
          solution.residuals.complementarity, solution.primals, solution.multipliers.constraints,
          solution.multipliers.lower_bounds, solution.multipliers.upper_bounds, major_iterations, timer.get_duration(),
-         Iterate::number_eval_objective, Iterate::number_eval_constraints, Iterate::number_eval_objective_gradient,
+         timer.get_cpu_duration(), Iterate::number_eval_objective, Iterate::number_eval_constraints, Iterate::number_eval_objective_gradient,
          Iterate::number_eval_jacobian, number_hessian_evaluations, number_subproblems_solved};
    }
 
@@ -4,21 +4,27 @@
 #ifndef UNO_H
 #define UNO_H
 
+#include <functional>
 #include <memory>
+#include <string_view>
 #include "ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategy.hpp"
 #include "ingredients/globalization_mechanisms/GlobalizationMechanism.hpp"
 #include "ingredients/globalization_strategies/GlobalizationStrategy.hpp"
 #include "optimization/Direction.hpp"
 #include "optimization/Result.hpp"
+#include "optimization/SensitivityAnalysis.hpp"
 #include "optimization/SolutionStatus.hpp"
 
 namespace uno {
    // forward declarations
+   class LogSink;
    class Model;
+   class Multipliers;
    class Options;
    class Statistics;
    class Timer;
    class UserCallbacks;
+   class WarmstartInformation;
 
    class Uno {
    public:
@@ -27,6 +33,12 @@ namespace uno {
       // solve with or without user callbacks
       Result solve(const Model& model, const Options& options);
       Result solve(const Model& model, const Options& options, UserCallbacks& user_callbacks);
+      // redirect the log messages of the solves to a callback (called from a writer thread) instead of the option "log_file"
+      void set_log_callback(std::function<void(std::string_view)> callback);
+      // first-order sensitivity of the solution of the last solve with respect to a perturbation of the bounds (requires
+      // the option "sensitivity_analysis" and the interior-point method)
+      void compute_sensitivity(const BoundPerturbation& perturbation, Vector<double>& primal_sensitivity,
+         Multipliers& dual_sensitivity);
 
       static std::string current_version();
       static void print_available_strategies();
@@ -36,13 +48,19 @@ namespace uno {
       std::unique_ptr<GlobalizationStrategy> globalization_strategy{};
       std::unique_ptr<GlobalizationMechanism> globalization_mechanism{};
       Direction direction{};
+      std::function<void(std::string_view)> log_callback{};
+      SensitivityAnalysis sensitivity_analysis{};
 
+      [[nodiscard]] std::unique_ptr<LogSink> create_log_sink(const Options& options) const;
       void pick_ingredients(const Model& model, const Options& options);
       void initialize(Statistics& statistics, const Model& model, Iterate& current_iterate, const Options& options);
       [[nodiscard]] static Statistics create_statistics(const Model& model, const Options& options);
       [[nodiscard]] static bool termination_criteria(SolutionStatus solution_status, size_t iteration, size_t max_iterations,
-         double current_time, double time_limit, OptimizationStatus& optimization_status);
+         const Timer& timer, double time_limit, double cpu_time_limit, OptimizationStatus& optimization_status);
+      [[nodiscard]] Result reformulate_and_solve(const Model& model, const Options& options, UserCallbacks& user_callbacks);
       [[nodiscard]] Result uno_solve(const Model& model, const Options& options, UserCallbacks& user_callbacks);
+      void prepare_sensitivity_analysis(Statistics& statistics, const Model& model, Iterate& solution,
+         WarmstartInformation& warmstart_information, const Options& options);
       static void postprocess_iterate(const Model& model, Iterate& iterate);
       [[nodiscard]] Result create_result(const Model& model, OptimizationStatus optimization_status, Iterate& solution,
          size_t major_iterations, const Timer& timer) const;
@@ -52,32 +52,26 @@ namespace uno {
    // objective measure: scaled objective
    void ConstraintRelaxationStrategy::set_objective_measure(const Model& model, Iterate& iterate) const {
       iterate.evaluate_objective(model);
-      const double objective = iterate.evaluations.objective;
-      iterate.progress.objective = [=](double objective_multiplier) {
-         return objective_multiplier * objective;
-      };
+      iterate.progress.objective = {iterate.evaluations.objective, 0.};
    }
 
    double ConstraintRelaxationStrategy::compute_predicted_infeasibility_reduction(InequalityHandlingMethod& inequality_handling_method,
          const Model& model, const Iterate& current_iterate, const Vector<double>& primal_direction, double step_length) const {
       // predicted infeasibility reduction: "‖c(x)‖ - ‖c(x) + ∇c(x)^T (αd)‖"
       const double current_constraint_violation = model.constraint_violation(current_iterate.evaluations.constraints, this->progress_norm);
-      Vector<double> result(model.number_constraints);
-      inequality_handling_method.compute_constraint_jacobian_vector_product(primal_direction, result);
+      inequality_handling_method.compute_constraint_jacobian_vector_product(primal_direction, this->scratch_constraints);
       const double trial_linearized_constraint_violation = model.constraint_violation(current_iterate.evaluations.constraints +
-         step_length * result, this->progress_norm);
+         step_length * this->scratch_constraints, this->progress_norm);
       return current_constraint_violation - trial_linearized_constraint_violation;
    }
 
-   std::function<double(double)> ConstraintRelaxationStrategy::compute_predicted_objective_reduction(InequalityHandlingMethod& inequality_handling_method,
+   ObjectiveMeasure ConstraintRelaxationStrategy::compute_predicted_objective_reduction(InequalityHandlingMethod& inequality_handling_method,
          const Iterate& current_iterate, const Vector<double>& primal_direction, double step_length) const {
       // predicted objective reduction: "-∇f(x)^T (αd) - α^2/2 d^T H d"
       const double directional_derivative = dot(primal_direction, current_iterate.evaluations.objective_gradient);
       const double quadratic_term = this->first_order_predicted_reduction ? 0. :
          inequality_handling_method.compute_hessian_quadratic_product(primal_direction);
-      return [=](double objective_multiplier) {
-         return step_length * (-objective_multiplier*directional_derivative) - step_length*step_length/2. * quadratic_term;
-      };
+      return {-step_length * directional_derivative, -step_length*step_length/2. * quadratic_term};
    }
 
    void ConstraintRelaxationStrategy::compute_progress_measures(InequalityHandlingMethod& inequality_handling_method,
@@ -142,10 +136,8 @@ namespace uno {
 
       // complementarity error
       constexpr double shift_value = 0.;
-      // TODO preallocate constraints
-      Vector<double> constraints(problem.number_constraints);
-      problem.evaluate_constraints(iterate, constraints);
-      iterate.residuals.complementarity = problem.complementarity_error(iterate.primals, constraints,
+      problem.evaluate_constraints(iterate, this->scratch_constraints);
+      iterate.residuals.complementarity = problem.complementarity_error(iterate.primals, this->scratch_constraints,
          iterate.multipliers, shift_value, this->residual_norm);
 
       // scaling factors
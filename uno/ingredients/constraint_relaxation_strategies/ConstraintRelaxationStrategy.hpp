@@ -5,9 +5,9 @@
 #define UNO_CONSTRAINTRELAXATIONSTRATEGY_H
 
 #include <cstddef>
-#include <functional>
 #include "ingredients/globalization_strategies/ProgressMeasures.hpp"
 #include "linear_algebra/Norm.hpp"
+#include "linear_algebra/Vector.hpp"
 #include "optimization/Iterate.hpp"
 #include "optimization/SolutionStatus.hpp"
 
@@ -22,8 +22,6 @@ namespace uno {
    class Options;
    class Statistics;
    class UserCallbacks;
-   template <typename ElementType>
-   class Vector;
    class WarmstartInformation;
 
    class ConstraintRelaxationStrategy {
@@ -48,6 +46,9 @@ namespace uno {
          WarmstartInformation& warmstart_information, UserCallbacks& user_callbacks) = 0;
       [[nodiscard]] virtual SolutionStatus check_termination(const Model& model, Iterate& iterate) = 0;
 
+      // solve the last factorized KKT system of the optimality problem with another right-hand side (sensitivity analysis)
+      virtual void solve_optimality_kkt_system(const Vector<double>& rhs, Vector<double>& solution) = 0;
+
       [[nodiscard]] virtual std::string get_name() const = 0;
       [[nodiscard]] virtual size_t get_hessian_evaluation_count() const = 0;
       [[nodiscard]] virtual size_t get_number_subproblems_solved() const = 0;
@@ -64,12 +65,14 @@ namespace uno {
       const double unbounded_objective_threshold;
       // first_order_predicted_reduction is true when the predicted reduction can be taken as first-order (e.g. in line-search methods)
       const bool first_order_predicted_reduction;
+      // scratch space of size number_constraints, allocated once in initialize() so that the major iterations do not allocate
+      mutable Vector<double> scratch_constraints{};
 
       void set_objective_measure(const Model& model, Iterate& iterate) const;
       void set_infeasibility_measure(const Model& model, Iterate& iterate) const;
       [[nodiscard]] double compute_predicted_infeasibility_reduction(InequalityHandlingMethod& inequality_handling_method,
          const Model& model, const Iterate& current_iterate, const Vector<double>& primal_direction, double step_length) const;
-      [[nodiscard]] std::function<double(double)> compute_predicted_objective_reduction(InequalityHandlingMethod& inequality_handling_method,
+      [[nodiscard]] ObjectiveMeasure compute_predicted_objective_reduction(InequalityHandlingMethod& inequality_handling_method,
          const Iterate& current_iterate, const Vector<double>& primal_direction, double step_length) const;
       void compute_progress_measures(InequalityHandlingMethod& inequality_handling_method, const OptimizationProblem& problem,
          GlobalizationStrategy& globalization_strategy, Iterate& current_iterate, Iterate& trial_iterate) const;
@@ -25,12 +25,10 @@ namespace uno {
    FeasibilityRestoration::FeasibilityRestoration(const Options& options) :
          ConstraintRelaxationStrategy(options),
          constraint_violation_coefficient(options.get_double("l1_constraint_violation_coefficient")),
+         options(options),
          optimality_hessian_model(HessianModelFactory::create(options)),
-         feasibility_hessian_model(HessianModelFactory::create(options)),
          optimality_regularization_strategy(RegularizationStrategyFactory::create(options)),
-         feasibility_regularization_strategy(RegularizationStrategyFactory::create(options)),
          optimality_inequality_handling_method(InequalityHandlingMethodFactory::create(options)),
-         feasibility_inequality_handling_method(InequalityHandlingMethodFactory::create(options)),
          linear_feasibility_tolerance(options.get_double("primal_tolerance")),
          switch_to_optimality_requires_linearized_feasibility(options.get_bool("switch_to_optimality_requires_linearized_feasibility")) {
    }
@@ -50,14 +48,13 @@ namespace uno {
          std::max(optimality_problem.number_variables, feasibility_problem.number_variables),
          std::max(optimality_problem.number_constraints, feasibility_problem.number_constraints)
       );
+      this->scratch_constraints.resize(model.number_constraints);
 
       // statistics
       this->optimality_regularization_strategy->initialize_statistics(statistics, options);
       this->optimality_inequality_handling_method->initialize_statistics(statistics, options);
-      this->feasibility_regularization_strategy->initialize_statistics(statistics, options);
-      this->feasibility_inequality_handling_method->initialize_statistics(statistics, options);
-      statistics.add_column("phase", Statistics::int_width, options.get_int("statistics_restoration_phase_column_order"));
-      statistics.set("phase", "OPT");
+      this->phase_column = statistics.add_column("phase", Statistics::int_width, options.get_int("statistics_restoration_phase_column_order"));
+      statistics.set(this->phase_column, "OPT");
 
       // initial iterate
       this->optimality_inequality_handling_method->generate_initial_iterate(optimality_problem, initial_iterate);
@@ -76,7 +73,7 @@ namespace uno {
       direction.reset();
       // if we are in the optimality phase, solve the optimality problem
       if (this->current_phase == Phase::OPTIMALITY) {
-         statistics.set("phase", "OPT");
+         statistics.set(this->phase_column, "OPT");
          try {
             DEBUG << "Solving the optimality subproblem\n";
             const OptimizationProblem optimality_problem{model};
@@ -85,7 +82,7 @@ namespace uno {
                warmstart_information);
             if (direction.status == SubproblemStatus::INFEASIBLE) {
                // switch to the feasibility problem, starting from the current direction
-               statistics.set("status", std::string("infeasible subproblem"));
+               statistics.set("status", "infeasible subproblem");
                DEBUG << "/!\\ The subproblem is infeasible\n";
                this->switch_to_feasibility_problem(statistics, globalization_strategy, model, current_iterate,
                   trust_region_radius, warmstart_information);
@@ -104,7 +101,7 @@ namespace uno {
 
       // solve the feasibility problem (minimize the constraint violation)
       DEBUG << "Solving the feasibility subproblem\n";
-      statistics.set("phase", "FEAS");
+      statistics.set(this->phase_column, "FEAS");
       // note: failure of regularization should not happen here, since the feasibility Jacobian has full rank
       l1RelaxedProblem feasibility_problem{model, 0., this->constraint_violation_coefficient,
          this->optimality_inequality_handling_method->proximal_coefficient(), this->reference_optimality_primals.data()};
@@ -128,6 +125,11 @@ namespace uno {
       this->reference_optimality_progress = current_iterate.progress;
       this->reference_optimality_primals = current_iterate.primals;
 
+      const bool first_switch_to_feasibility = (this->feasibility_inequality_handling_method == nullptr);
+      if (first_switch_to_feasibility) {
+         this->create_feasibility_ingredients();
+      }
+
       l1RelaxedProblem feasibility_problem{model, 0., this->constraint_violation_coefficient,
          this->optimality_inequality_handling_method->proximal_coefficient(), this->reference_optimality_primals.data()};
       current_iterate.set_number_variables(feasibility_problem.number_variables);
@@ -139,23 +141,32 @@ namespace uno {
       this->feasibility_inequality_handling_method->set_elastic_variable_values(feasibility_problem, current_iterate);
       this->feasibility_inequality_handling_method->initialize_feasibility_problem(feasibility_problem, current_iterate);
 
-      DEBUG2 << "Current iterate:\n" << current_iterate << '\n';
+      UNO_LOG(DEBUG2) << "Current iterate:\n" << current_iterate << '\n';
 
       // initialize the feasibility ingredients upon the first switch to feasibility restoration
-      if (this->first_switch_to_feasibility) {
+      if (first_switch_to_feasibility) {
          this->feasibility_inequality_handling_method->initialize(feasibility_problem, current_iterate,
             *this->feasibility_hessian_model, *this->feasibility_regularization_strategy, trust_region_radius);
          this->feasibility_hessian_model->initialize(model);
-
-         this->first_switch_to_feasibility = false;
+         this->feasibility_regularization_strategy->initialize_statistics(statistics, this->options);
+         this->feasibility_inequality_handling_method->initialize_statistics(statistics, this->options);
       }
 
+      // the Jacobian of the model at the current iterate was evaluated in the optimality phase: only the elastic
+      // contributions are set
       this->feasibility_inequality_handling_method->evaluate_constraint_jacobian(feasibility_problem, current_iterate);
 
-      if (Logger::level == INFO) statistics.print_current_line();
+      statistics.print_current_line();
       warmstart_information.whole_problem_changed();
    }
 
+   void FeasibilityRestoration::create_feasibility_ingredients() {
+      DEBUG << "Creating the ingredients of the feasibility restoration phase\n";
+      this->feasibility_hessian_model = HessianModelFactory::create(this->options);
+      this->feasibility_regularization_strategy = RegularizationStrategyFactory::create(this->options);
+      this->feasibility_inequality_handling_method = InequalityHandlingMethodFactory::create(this->options);
+   }
+
    void FeasibilityRestoration::solve_subproblem(Statistics& statistics, InequalityHandlingMethod& inequality_handling_method,
          const OptimizationProblem& problem, Iterate& current_iterate, Direction& direction, HessianModel& hessian_model,
          RegularizationStrategy<double>& regularization_strategy, double trust_region_radius,
@@ -164,7 +175,7 @@ namespace uno {
       inequality_handling_method.solve(statistics, problem, current_iterate, direction, hessian_model, regularization_strategy,
          trust_region_radius, warmstart_information);
       direction.norm = norm_inf(view(direction.primals, 0, problem.get_number_original_variables()));
-      DEBUG3 << direction << '\n';
+      UNO_LOG(DEBUG3) << direction << '\n';
    }
 
    bool FeasibilityRestoration::can_switch_to_optimality_phase(const Iterate& current_iterate, const GlobalizationStrategy& globalization_strategy,
@@ -174,11 +185,10 @@ namespace uno {
             return true;
          }
          // compute the linearized constraint violation
-         // TODO preallocate
-         Vector<double> result(model.number_constraints);
-         this->feasibility_inequality_handling_method->compute_constraint_jacobian_vector_product(direction.primals, result);
+         this->feasibility_inequality_handling_method->compute_constraint_jacobian_vector_product(direction.primals,
+            this->scratch_constraints);
          const double trial_linearized_constraint_violation = model.constraint_violation(current_iterate.evaluations.constraints +
-            step_length * result, this->residual_norm);
+            step_length * this->scratch_constraints, this->residual_norm);
          return (trial_linearized_constraint_violation <= this->linear_feasibility_tolerance);
       }
       return false;
@@ -261,6 +271,10 @@ namespace uno {
       inequality_handling_method.set_auxiliary_measure(problem, iterate);
    }
 
+   void FeasibilityRestoration::solve_optimality_kkt_system(const Vector<double>& rhs, Vector<double>& solution) {
+      this->optimality_inequality_handling_method->solve_kkt_system(rhs, solution);
+   }
+
    std::string FeasibilityRestoration::get_name() const {
       return "restoration " + this->optimality_inequality_handling_method->get_name() + " with " +
          this->optimality_hessian_model->get_name() + " Hessian and " + this->optimality_regularization_strategy->get_name() +
@@ -268,11 +282,18 @@ namespace uno {
    }
 
    size_t FeasibilityRestoration::get_hessian_evaluation_count() const {
-      return this->optimality_hessian_model->evaluation_count + this->feasibility_hessian_model->evaluation_count;
+      size_t evaluation_count = this->optimality_hessian_model->evaluation_count;
+      if (this->feasibility_hessian_model != nullptr) {
+         evaluation_count += this->feasibility_hessian_model->evaluation_count;
+      }
+      return evaluation_count;
    }
 
    size_t FeasibilityRestoration::get_number_subproblems_solved() const {
-      return this->optimality_inequality_handling_method->number_subproblems_solved +
-         this->feasibility_inequality_handling_method->number_subproblems_solved;
+      size_t number_subproblems_solved = this->optimality_inequality_handling_method->number_subproblems_solved;
+      if (this->feasibility_inequality_handling_method != nullptr) {
+         number_subproblems_solved += this->feasibility_inequality_handling_method->number_subproblems_solved;
+      }
+      return number_subproblems_solved;
    }
 } // namespace
\ No newline at end of file
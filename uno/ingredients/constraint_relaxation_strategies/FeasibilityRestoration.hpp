@@ -9,6 +9,7 @@
 #include "ingredients/globalization_strategies/ProgressMeasures.hpp"
 #include "ingredients/regularization_strategies/RegularizationStrategy.hpp"
 #include "linear_algebra/Vector.hpp"
+#include "tools/Statistics.hpp"
 
 namespace uno {
    enum class Phase {FEASIBILITY_RESTORATION = 1, OPTIMALITY = 2};
@@ -33,6 +34,7 @@ namespace uno {
          const Model& model, Iterate& current_iterate, Iterate& trial_iterate, const Direction& direction, double step_length,
          WarmstartInformation& warmstart_information, UserCallbacks& user_callbacks) override;
       [[nodiscard]] SolutionStatus check_termination(const Model& model, Iterate& iterate) override;
+      void solve_optimality_kkt_system(const Vector<double>& rhs, Vector<double>& solution) override;
 
       [[nodiscard]] std::string get_name() const override;
       [[nodiscard]] size_t get_hessian_evaluation_count() const override;
@@ -41,12 +43,15 @@ namespace uno {
    private:
       Phase current_phase{Phase::OPTIMALITY};
       const double constraint_violation_coefficient;
+      const Options& options; // copy of the options for delayed allocation of the feasibility ingredients
       std::unique_ptr<HessianModel> optimality_hessian_model;
-      std::unique_ptr<HessianModel> feasibility_hessian_model;
       std::unique_ptr<RegularizationStrategy<double>> optimality_regularization_strategy;
-      std::unique_ptr<RegularizationStrategy<double>> feasibility_regularization_strategy;
       std::unique_ptr<InequalityHandlingMethod> optimality_inequality_handling_method;
-      std::unique_ptr<InequalityHandlingMethod> feasibility_inequality_handling_method;
+      // the feasibility ingredients are created upon the first switch to feasibility restoration and kept (along with
+      // the symbolic analysis of their linear solver) for the subsequent switches
+      std::unique_ptr<HessianModel> feasibility_hessian_model{};
+      std::unique_ptr<RegularizationStrategy<double>> feasibility_regularization_strategy{};
+      std::unique_ptr<InequalityHandlingMethod> feasibility_inequality_handling_method{};
       // the class maintains multipliers for the other phase (feasibility multipliers if we are in the optimality phase,
       // and vice versa). These multipliers and those of the iterate are swapped whenever we switch phases.
       Multipliers other_phase_multipliers;
@@ -54,8 +59,9 @@ namespace uno {
       const bool switch_to_optimality_requires_linearized_feasibility;
       ProgressMeasures reference_optimality_progress{};
       Vector<double> reference_optimality_primals{};
-      bool first_switch_to_feasibility{true};
+      Statistics::ColumnHandle phase_column{};
 
+      void create_feasibility_ingredients();
       void solve_subproblem(Statistics& statistics, InequalityHandlingMethod& inequality_handling_method, const OptimizationProblem& problem,
          Iterate& current_iterate, Direction& direction, HessianModel& hessian_model, RegularizationStrategy<double>& regularization_strategy,
          double trust_region_radius, WarmstartInformation& warmstart_information);
@@ -30,6 +30,7 @@ namespace uno {
       this->inequality_handling_method->initialize(problem, initial_iterate, *this->hessian_model,
          *this->regularization_strategy, trust_region_radius);
       direction = Direction(problem.number_variables, problem.number_constraints);
+      this->scratch_constraints.resize(model.number_constraints);
 
       // statistics
       this->regularization_strategy->initialize_statistics(statistics, options);
@@ -56,7 +57,7 @@ namespace uno {
       this->inequality_handling_method->solve(statistics, problem, current_iterate, direction, *this->hessian_model,
          *this->regularization_strategy, trust_region_radius, warmstart_information);
       direction.norm = norm_inf(view(direction.primals, 0, problem.get_number_original_variables()));
-      DEBUG3 << direction << '\n';
+      UNO_LOG(DEBUG3) << direction << '\n';
       warmstart_information.no_changes();
    }
 
@@ -98,6 +99,10 @@ namespace uno {
       inequality_handling_method.set_auxiliary_measure(problem, iterate);
    }
 
+   void UnconstrainedStrategy::solve_optimality_kkt_system(const Vector<double>& rhs, Vector<double>& solution) {
+      this->inequality_handling_method->solve_kkt_system(rhs, solution);
+   }
+
    std::string UnconstrainedStrategy::get_name() const {
       return this->inequality_handling_method->get_name() + " with " + this->hessian_model->get_name() + " Hessian and " +
          this->regularization_strategy->get_name() + " regularization";
@@ -18,7 +18,8 @@ namespace uno {
          objective_multiplier(objective_multiplier),
          constraint_violation_coefficient(constraint_violation_coefficient),
          proximal_coefficient(proximal_coefficient),
-         proximal_center(proximal_center) {
+         proximal_center(proximal_center),
+         elastic_variables(model.number_variables, this->number_variables) {
    }
 
    double l1RelaxedProblem::get_objective_multiplier() const {
@@ -134,7 +135,8 @@ namespace uno {
    }
 
    void l1RelaxedProblem::evaluate_constraint_jacobian(Iterate& iterate, double* jacobian_values) const {
-      this->model.evaluate_constraint_jacobian(iterate.primals, jacobian_values);
+      // the Jacobian of the model is shared with the optimality problem
+      OptimizationProblem::evaluate_constraint_jacobian(iterate, jacobian_values);
 
       // add the contribution of the elastic variables
       size_t nonzero_index = this->model.number_jacobian_nonzeros();
@@ -303,6 +305,14 @@ namespace uno {
       return this->dual_regularization_constraints;
    }
 
+   // each elastic variable appears linearly in a single constraint and has no curvature. Only the interior-point methods
+   // eliminate them (from the augmented system). The active-set QP solvers (BQPD, HiGHS) accept neither a
+   // piecewise-linear penalty nor soft constraints: their subproblems keep the elastic variables, with their Jacobian
+   // columns and bounds
+   const Collection<size_t>& l1RelaxedProblem::get_condensable_variables() const {
+      return this->elastic_variables;
+   }
+
    void l1RelaxedProblem::set_elastic_variable_values(Iterate& iterate, const std::function<void(Iterate&, size_t, size_t,
          double)>& elastic_setting_function) const {
       iterate.set_number_variables(this->number_variables);
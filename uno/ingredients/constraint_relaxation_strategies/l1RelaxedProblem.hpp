@@ -50,6 +50,7 @@ namespace uno {
       [[nodiscard]] const Collection<size_t>& get_equality_constraints() const override;
       [[nodiscard]] const Collection<size_t>& get_inequality_constraints() const override;
       [[nodiscard]] const Collection<size_t>& get_dual_regularization_constraints() const override;
+      [[nodiscard]] const Collection<size_t>& get_condensable_variables() const override;
 
       [[nodiscard]] SolutionStatus check_first_order_convergence(const Iterate& current_iterate, double primal_tolerance,
          double dual_tolerance) const;
@@ -63,6 +64,7 @@ namespace uno {
       const double proximal_coefficient;
       double const* proximal_center;
       const ForwardRange dual_regularization_constraints{0};
+      const ForwardRange elastic_variables;
    };
 } // namespace
 
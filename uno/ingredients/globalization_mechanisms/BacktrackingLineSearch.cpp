@@ -2,6 +2,7 @@
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
 #include <cassert>
+#include <stdexcept>
 #include "BacktrackingLineSearch.hpp"
 #include "ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategy.hpp"
 #include "model/Model.hpp"
@@ -25,18 +26,18 @@ namespace uno {
    }
 
    void BacktrackingLineSearch::initialize(Statistics& statistics, const Options& options) {
-      statistics.add_column("LS iter", Statistics::int_width + 2, options.get_int("statistics_minor_column_order"));
-      statistics.add_column("step length", Statistics::double_width - 4, options.get_int("statistics_LS_step_length_column_order"));
+      this->iterations_column = statistics.add_column("LS iter", Statistics::int_width + 2, options.get_int("statistics_minor_column_order"));
+      this->step_length_column = statistics.add_column("step length", Statistics::double_width - 4, options.get_int("statistics_LS_step_length_column_order"));
    }
 
    void BacktrackingLineSearch::compute_next_iterate(Statistics& statistics, ConstraintRelaxationStrategy& constraint_relaxation_strategy,
          GlobalizationStrategy& globalization_strategy, const Model& model, Iterate& current_iterate, Iterate& trial_iterate,
          Direction& direction, WarmstartInformation& warmstart_information, UserCallbacks& user_callbacks) {
-      DEBUG2 << "Current iterate\n" << current_iterate << '\n';
+      UNO_LOG(DEBUG2) << "Current iterate\n" << current_iterate << '\n';
 
       constraint_relaxation_strategy.compute_feasible_direction(statistics, globalization_strategy, model, current_iterate,
          direction, INF<double>, warmstart_information);
-      BacktrackingLineSearch::check_unboundedness(direction);
+      BacktrackingLineSearch::check_subproblem_status(direction);
       this->backtrack_along_direction(statistics, constraint_relaxation_strategy, globalization_strategy, model, current_iterate,
          trial_iterate, direction, warmstart_information, user_callbacks);
    }
@@ -58,7 +59,7 @@ namespace uno {
          ++number_iterations;
          DEBUG << "\n\tLine-search iteration " << number_iterations << ", step_length " << step_length << '\n';
          if (1 < number_iterations) { statistics.start_new_line(); }
-         statistics.set("step length", step_length);
+         statistics.set(this->step_length_column, step_length);
 
          bool is_acceptable = false;
          try {
@@ -82,11 +83,11 @@ namespace uno {
             trial_iterate.status = constraint_relaxation_strategy.check_termination(model, trial_iterate);
             GlobalizationMechanism::set_dual_residuals_statistics(statistics, trial_iterate);
             termination = true;
-            if (Logger::level == INFO) statistics.print_current_line();
+            statistics.print_current_line();
          }
          else if (step_length >= this->minimum_step_length) {
             step_length = this->decrease_step_length(step_length);
-            if (Logger::level == INFO) statistics.print_current_line();
+            statistics.print_current_line();
          }
          else { // minimum_step_length reached
             DEBUG << "The line search step length is smaller than " << this->minimum_step_length << '\n';
@@ -104,7 +105,7 @@ namespace uno {
                   model, current_iterate, INF<double>, warmstart_information);
                constraint_relaxation_strategy.compute_feasible_direction(statistics, globalization_strategy,
                   model, current_iterate, direction, INF<double>, warmstart_information);
-               BacktrackingLineSearch::check_unboundedness(direction);
+               BacktrackingLineSearch::check_subproblem_status(direction);
                // restart backtracking
                step_length = 1.;
                number_iterations = 0;
@@ -132,14 +133,18 @@ namespace uno {
       return step_length;
    }
 
-   void BacktrackingLineSearch::check_unboundedness(const Direction& direction) {
+   void BacktrackingLineSearch::check_subproblem_status(const Direction& direction) {
       if (direction.status == SubproblemStatus::UNBOUNDED_PROBLEM) {
          throw std::runtime_error("The subproblem is unbounded, this should not happen. If the subproblem has curvature,"
             "use regularization. If not, use a trust-region method.\n");
       }
+      // the direction cannot be trusted and there is no trust region to shrink
+      if (direction.status == SubproblemStatus::ERROR) {
+         throw std::runtime_error("The subproblem solver failed");
+      }
    }
 
-   void BacktrackingLineSearch::set_LS_statistics(Statistics& statistics, size_t number_iterations) {
-      statistics.set("LS iter", number_iterations);
+   void BacktrackingLineSearch::set_LS_statistics(Statistics& statistics, size_t number_iterations) const {
+      statistics.set(this->iterations_column, number_iterations);
    }
 } // namespace
\ No newline at end of file
@@ -5,6 +5,7 @@
 #define UNO_BACKTRACKINGLINESEARCH_H
 
 #include "GlobalizationMechanism.hpp"
+#include "tools/Statistics.hpp"
 
 namespace uno {
    class BacktrackingLineSearch : public GlobalizationMechanism {
@@ -23,6 +24,8 @@ namespace uno {
       const double backtracking_ratio;
       const double minimum_step_length;
       const bool scale_duals_with_step_length;
+      Statistics::ColumnHandle iterations_column{};
+      Statistics::ColumnHandle step_length_column{};
 
       void backtrack_along_direction(Statistics& statistics, ConstraintRelaxationStrategy& constraint_relaxation_strategy,
          GlobalizationStrategy& globalization_strategy, const Model& model, Iterate& current_iterate, Iterate& trial_iterate,
@@ -30,9 +33,9 @@ namespace uno {
       [[nodiscard]] static bool terminate_with_small_step_length(Statistics& statistics, ConstraintRelaxationStrategy& constraint_relaxation_strategy,
          const Model& model, Iterate& trial_iterate);
       [[nodiscard]] double decrease_step_length(double step_length) const;
-      static void check_unboundedness(const Direction& direction);
+      static void check_subproblem_status(const Direction& direction);
 
-      static void set_LS_statistics(Statistics& statistics, size_t number_iterations);
+      void set_LS_statistics(Statistics& statistics, size_t number_iterations) const;
    };
 } // namespace
 
@@ -32,15 +32,15 @@ namespace uno {
    }
 
    void TrustRegionStrategy::initialize(Statistics& statistics, const Options& options) {
-      statistics.add_column("TR iter", Statistics::int_width + 2, options.get_int("statistics_minor_column_order"));
-      statistics.add_column("TR radius", Statistics::double_width - 4, options.get_int("statistics_TR_radius_column_order"));
-      statistics.set("TR radius", this->radius);
+      this->iterations_column = statistics.add_column("TR iter", Statistics::int_width + 2, options.get_int("statistics_minor_column_order"));
+      this->radius_column = statistics.add_column("TR radius", Statistics::double_width - 4, options.get_int("statistics_TR_radius_column_order"));
+      statistics.set(this->radius_column, this->radius);
    }
 
    void TrustRegionStrategy::compute_next_iterate(Statistics& statistics, ConstraintRelaxationStrategy& constraint_relaxation_strategy,
          GlobalizationStrategy& globalization_strategy, const Model& model, Iterate& current_iterate, Iterate& trial_iterate,
          Direction& direction, WarmstartInformation& warmstart_information, UserCallbacks& user_callbacks) {
-      DEBUG2 << "Current iterate\n" << current_iterate << '\n';
+      UNO_LOG(DEBUG2) << "Current iterate\n" << current_iterate << '\n';
       this->reset_radius();
 
       size_t number_iterations = 0;
@@ -62,13 +62,13 @@ namespace uno {
             if (direction.status == SubproblemStatus::UNBOUNDED_PROBLEM) {
                // the subproblem is always bounded, but the objective may exceed a very large negative value
                statistics.set("status", "unbounded subproblem");
-               if (Logger::level == INFO) statistics.print_current_line();
+               statistics.print_current_line();
                this->decrease_radius_aggressively();
                warmstart_information.variable_bounds_changed = true;
             }
             else if (direction.status == SubproblemStatus::ERROR) {
                statistics.set("status", "solver error");
-               if (Logger::level == INFO) statistics.print_current_line();
+               statistics.print_current_line();
                this->decrease_radius();
                // reset the Hessian representation of the subproblem solver
                warmstart_information.whole_problem_changed();
@@ -89,13 +89,13 @@ namespace uno {
                   this->decrease_radius(direction.norm);
                   warmstart_information.variable_bounds_changed = true;
                }
-               if (Logger::level == INFO) statistics.print_current_line();
+               statistics.print_current_line();
             }
          }
          // if an evaluation error occurs, decrease the radius
          catch (const EvaluationError&) {
             statistics.set("status", "eval. error");
-            if (Logger::level == INFO) statistics.print_current_line();
+            statistics.print_current_line();
             DEBUG << "A function could not be evaluated. The trust-region radius will be reduced\n";
             this->decrease_radius();
             warmstart_information.variable_bounds_changed = true;
@@ -190,7 +190,7 @@ namespace uno {
    }
 
    void TrustRegionStrategy::set_TR_statistics(Statistics& statistics, size_t number_iterations) const {
-      statistics.set("TR iter", number_iterations);
-      statistics.set("TR radius", this->radius);
+      statistics.set(this->iterations_column, number_iterations);
+      statistics.set(this->radius_column, this->radius);
    }
 } // namespace
\ No newline at end of file
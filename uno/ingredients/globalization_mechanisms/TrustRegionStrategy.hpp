@@ -5,6 +5,7 @@
 #define UNO_TRUSTREGIONSTRATEGY_H
 
 #include "GlobalizationMechanism.hpp"
+#include "tools/Statistics.hpp"
 
 namespace uno {
    class TrustRegionStrategy : public GlobalizationMechanism {
@@ -28,6 +29,8 @@ namespace uno {
       const double minimum_radius;
       const double radius_reset_threshold;
       const double primal_tolerance;
+      Statistics::ColumnHandle iterations_column{};
+      Statistics::ColumnHandle radius_column{};
 
       [[nodiscard]] bool is_iterate_acceptable(Statistics& statistics, ConstraintRelaxationStrategy& constraint_relaxation_strategy,
          GlobalizationStrategy& globalization_strategy, const Model& model, Iterate& current_iterate, Iterate& trial_iterate,
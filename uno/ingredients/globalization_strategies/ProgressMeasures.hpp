@@ -4,18 +4,28 @@
 #ifndef UNO_PROGRESSMEASURES_H
 #define UNO_PROGRESSMEASURES_H
 
-#include <functional>
 #include "tools/Infinity.hpp"
 
 namespace uno {
+   // objective measure, affine in the objective multiplier: objective_multiplier * scaled_term + unscaled_term.
+   // It is stored by value (not as a std::function) so that the progress measures can be updated without allocating
+   struct ObjectiveMeasure {
+      double scaled_term{};
+      double unscaled_term{};
+
+      [[nodiscard]] double operator()(double objective_multiplier) const {
+         return objective_multiplier * this->scaled_term + this->unscaled_term;
+      }
+   };
+
    struct ProgressMeasures {
       double infeasibility{}; // constraint violation
-      std::function<double(double objective_multiplier)> objective{}; // objective measure (scaled by penalty parameter): objective, Lagrangian
+      ObjectiveMeasure objective{}; // objective measure (scaled by penalty parameter): objective, Lagrangian
       double auxiliary{}; // auxiliary terms (independent of penalty parameter): barrier terms, proximal term, ...
 
       void reset() {
          this->infeasibility = INF<double>;
-         this->objective = [](double) { return INF<double>; };
+         this->objective = {0., INF<double>};
          this->auxiliary = INF<double>;
       }
    };
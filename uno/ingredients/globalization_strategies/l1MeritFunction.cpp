@@ -12,7 +12,7 @@ namespace uno {
    }
 
    void l1MeritFunction::initialize(Statistics& statistics, const Iterate& /*initial_iterate*/, const Options& options) {
-      statistics.add_column("penalty", Statistics::double_width - 5, options.get_int("statistics_penalty_parameter_column_order"));
+      this->penalty_column = statistics.add_column("penalty", Statistics::double_width - 5, options.get_int("statistics_penalty_parameter_column_order"));
    }
 
    bool l1MeritFunction::is_iterate_acceptable(Statistics& statistics, const ProgressMeasures& current_progress,
@@ -30,7 +30,7 @@ namespace uno {
       DEBUG << "Current merit: " << current_merit_value << '\n';
       DEBUG << "Trial merit:   " << trial_merit_value << '\n';
       DEBUG << "Actual reduction: " << current_merit_value << " - " << trial_merit_value << " = " << actual_reduction << '\n';
-      statistics.set("penalty", objective_multiplier);
+      statistics.set(this->penalty_column, objective_multiplier);
 
       // Armijo sufficient decrease condition
       const bool accept = this->armijo_sufficient_decrease(constrained_predicted_reduction, actual_reduction);
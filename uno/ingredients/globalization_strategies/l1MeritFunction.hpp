@@ -7,6 +7,7 @@
 #include <string>
 #include "GlobalizationStrategy.hpp"
 #include "tools/Infinity.hpp"
+#include "tools/Statistics.hpp"
 
 namespace uno {
    class l1MeritFunction : public GlobalizationStrategy {
@@ -25,6 +26,7 @@ namespace uno {
 
    protected:
       double smallest_known_infeasibility{INF<double>};
+      Statistics::ColumnHandle penalty_column{};
 
       [[nodiscard]] static double constrained_merit_function(const ProgressMeasures& progress, double objective_multiplier);
       [[nodiscard]] double compute_merit_actual_reduction(double current_merit_value, double trial_merit_value) const;
@@ -30,7 +30,7 @@ namespace uno {
       const double merit_predicted_reduction = FilterMethod::unconstrained_merit_function(predicted_reduction);
       DEBUG << "Current (infeasibility, objective + auxiliary) = (" << current_progress.infeasibility << ", " << current_merit << ")\n";
       DEBUG << "Trial   (infeasibility, objective + auxiliary) = (" << trial_progress.infeasibility << ", " << trial_merit << ")\n";
-      DEBUG << "Current filter:\n" << *this->filter;
+      UNO_LOG(DEBUG) << "Current filter:\n" << *this->filter;
       DEBUG << "Unconstrained predicted reduction = " << merit_predicted_reduction << '\n';
 
       std::string scenario;
@@ -26,8 +26,8 @@ namespace uno {
       this->funnel.set_infeasibility_upper_bound(upper_bound);
       DEBUG << "Current funnel width: " << this->funnel.current_width() << '\n';
 
-      statistics.add_column("funnel width", Statistics::double_width - 3, options.get_int("statistics_funnel_width_column_order"));
-      statistics.set("funnel width", this->funnel.current_width());
+      this->funnel_width_column = statistics.add_column("funnel width", Statistics::double_width - 3, options.get_int("statistics_funnel_width_column_order"));
+      statistics.set(this->funnel_width_column, this->funnel.current_width());
    }
 
    bool FunnelMethod::is_regular_iterate_acceptable(Statistics& statistics, const ProgressMeasures& current_progress,
@@ -69,7 +69,7 @@ namespace uno {
 
                DEBUG << "\t\tEntering funnel reduction mechanism\n";
                this->funnel.update(current_progress.infeasibility, trial_progress.infeasibility);
-               statistics.set("funnel width", this->funnel.current_width());
+               statistics.set(this->funnel_width_column, this->funnel.current_width());
                scenario = "h-type";
             }
             else {
@@ -140,6 +140,6 @@ namespace uno {
    }
 
    void FunnelMethod::set_statistics(Statistics& statistics) const {
-      statistics.set("funnel width", this->funnel.current_width());
+      statistics.set(this->funnel_width_column, this->funnel.current_width());
    }
 } // namespace
@@ -6,6 +6,7 @@
 
 #include "../SwitchingMethod.hpp"
 #include "Funnel.hpp"
+#include "tools/Statistics.hpp"
 
 namespace uno {
    struct FunnelMethodParameters {
@@ -43,6 +44,7 @@ namespace uno {
       Funnel funnel;
       const FunnelMethodParameters parameters; /*!< Set of constants */
       const bool require_acceptance_wrt_current_iterate;
+      Statistics::ColumnHandle funnel_width_column{};
 
       [[nodiscard]] bool is_regular_iterate_acceptable(Statistics& statistics, const ProgressMeasures& current_progress,
             const ProgressMeasures& trial_progress, const ProgressMeasures& predicted_reduction) override;
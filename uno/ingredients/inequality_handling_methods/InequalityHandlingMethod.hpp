@@ -46,6 +46,8 @@ namespace uno {
       virtual void compute_constraint_jacobian_vector_product(const Vector<double>& vector, Vector<double>& result) const = 0;
       virtual void compute_constraint_jacobian_transposed_vector_product(const Vector<double>& vector, Vector<double>& result) const = 0;
       [[nodiscard]] virtual double compute_hessian_quadratic_product(const Vector<double>& vector) const = 0;
+      // solve the last factorized KKT system with another right-hand side (e.g. for a sensitivity analysis)
+      virtual void solve_kkt_system(const Vector<double>& rhs, Vector<double>& solution) = 0;
 
       // progress measures
       virtual void set_auxiliary_measure(const OptimizationProblem& problem, Iterate& iterate) = 0;
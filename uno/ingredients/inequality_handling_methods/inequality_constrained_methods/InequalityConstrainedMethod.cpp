@@ -1,16 +1,19 @@
 // Copyright (c) 2018-2024 Charlie Vanaret
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
+#include <stdexcept>
 #include "InequalityConstrainedMethod.hpp"
 #include "optimization/Iterate.hpp"
 #include "ingredients/constraint_relaxation_strategies/l1RelaxedProblem.hpp"
 #include "ingredients/hessian_models/HessianModel.hpp"
 #include "ingredients/subproblem/Subproblem.hpp"
 #include "ingredients/subproblem_solvers/BoxLPSolverFactory.hpp"
+#include "ingredients/subproblem_solvers/BoxQPSolverFactory.hpp"
 #include "ingredients/subproblem_solvers/LPSolverFactory.hpp"
 #include "ingredients/subproblem_solvers/QPSolverFactory.hpp"
 #include "optimization/Direction.hpp"
 #include "optimization/EvaluationSpace.hpp"
+#include "options/Options.hpp"
 #include "symbolic/VectorView.hpp"
 #include "tools/Logger.hpp"
 
@@ -35,6 +38,11 @@ namespace uno {
             this->solver = LPSolverFactory::create(this->options);
          }
       }
+      else if (subproblem.number_constraints == 0 && this->options.get_string("box_QP_solver") != "none" &&
+            subproblem.has_hessian_operator()) {
+         DEBUG << "Curvature and only bound constraints in the subproblems, allocating a matrix-free box QP solver\n";
+         this->solver = BoxQPSolverFactory::create(this->options);
+      }
       else {
          DEBUG << "Curvature in the subproblems, allocating a QP solver\n";
          this->solver = QPSolverFactory::create(this->options);
@@ -42,8 +50,8 @@ namespace uno {
       this->solver->initialize_memory(subproblem);
    }
 
-   void InequalityConstrainedMethod::initialize_statistics(Statistics& /*statistics*/, const Options& /*options*/) {
-      // do nothing
+   void InequalityConstrainedMethod::initialize_statistics(Statistics& statistics, const Options& options) {
+      this->solver->initialize_statistics(statistics, options);
    }
 
    void InequalityConstrainedMethod::generate_initial_iterate(const OptimizationProblem& /*problem*/, Iterate& /*initial_iterate*/) {
@@ -106,6 +114,10 @@ namespace uno {
       return evaluation_space.compute_hessian_quadratic_product(vector);
    }
 
+   void InequalityConstrainedMethod::solve_kkt_system(const Vector<double>& /*rhs*/, Vector<double>& /*solution*/) {
+      throw std::runtime_error("The inequality-constrained methods do not factorize the KKT system");
+   }
+
    // compute dual *displacements*
    // because of the way we form LPs/QPs, we get the new *multipliers* back from the solver. To get the dual displacements/direction,
    // we need to subtract the current multipliers
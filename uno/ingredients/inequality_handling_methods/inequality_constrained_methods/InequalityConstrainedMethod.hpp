@@ -37,6 +37,7 @@ namespace uno {
       void compute_constraint_jacobian_vector_product(const Vector<double>& vector, Vector<double>& result) const override;
       void compute_constraint_jacobian_transposed_vector_product(const Vector<double>& vector, Vector<double>& result) const override;
       [[nodiscard]] double compute_hessian_quadratic_product(const Vector<double>& vector) const override;
+      void solve_kkt_system(const Vector<double>& rhs, Vector<double>& solution) override;
 
       // progress measures
       void set_auxiliary_measure(const OptimizationProblem& problem, Iterate& iterate) override;
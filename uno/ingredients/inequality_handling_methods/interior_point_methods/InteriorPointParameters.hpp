@@ -12,6 +12,8 @@ struct InteriorPointParameters {
    double push_variable_to_interior_k1;
    double push_variable_to_interior_k2;
    double damping_factor; // (Section 3.7 in IPOPT paper)
+   bool condense_elastic_variables;
+   bool condense_slacks;
 };
 
 #endif // UNO_INTERIORPOINTPARAMETERS_H
\ No newline at end of file
@@ -18,7 +18,7 @@
 namespace uno {
    PrimalDualInteriorPointMethod::PrimalDualInteriorPointMethod(const Options& options):
          InequalityHandlingMethod(),
-         linear_solver(SymmetricIndefiniteLinearSolverFactory::create(options.get_string("linear_solver"))),
+         options(options),
          barrier_parameter_update_strategy(options),
          previous_barrier_parameter(options.get_double("barrier_initial_parameter")),
          default_multiplier(options.get_double("barrier_default_multiplier")),
@@ -29,7 +29,9 @@ namespace uno {
                options.get_double("barrier_small_direction_factor"),
                options.get_double("barrier_push_variable_to_interior_k1"),
                options.get_double("barrier_push_variable_to_interior_k2"),
-               options.get_double("barrier_damping_factor")
+               options.get_double("barrier_damping_factor"),
+               options.get_bool("barrier_condense_elastic_variables"),
+               options.get_bool("barrier_condense_slacks")
          }),
          least_square_multiplier_max_norm(options.get_double("least_square_multiplier_max_norm")),
          l1_constraint_violation_coefficient(options.get_double("l1_constraint_violation_coefficient")) {
@@ -45,11 +47,14 @@ namespace uno {
       }
       const PrimalDualInteriorPointProblem barrier_problem(problem, this->barrier_parameter(), this->parameters);
       const Subproblem subproblem{barrier_problem, current_iterate, hessian_model, regularization_strategy, trust_region_radius};
+      this->linear_solver = SymmetricIndefiniteLinearSolverFactory::create(this->options,
+         subproblem.number_variables + subproblem.number_constraints, subproblem.number_regularized_augmented_system_nonzeros());
       this->linear_solver->initialize_augmented_system(subproblem);
    }
 
    void PrimalDualInteriorPointMethod::initialize_statistics(Statistics& statistics, const Options& options) {
-      statistics.add_column("barrier", Statistics::double_width - 5, options.get_int("statistics_barrier_parameter_column_order"));
+      this->barrier_parameter_column = statistics.add_column("barrier", Statistics::double_width - 5, options.get_int("statistics_barrier_parameter_column_order"));
+      this->linear_solver->initialize_statistics(statistics, options);
    }
 
    void PrimalDualInteriorPointMethod::generate_initial_iterate(const OptimizationProblem& problem, Iterate& initial_iterate) {
@@ -113,7 +118,7 @@ namespace uno {
       else {
          this->first_feasibility_iteration = false;
       }
-      statistics.set("barrier", this->barrier_parameter());
+      statistics.set(this->barrier_parameter_column, this->barrier_parameter());
 
       // create the subproblem
       const PrimalDualInteriorPointProblem barrier_problem(problem, this->barrier_parameter(), this->parameters);
@@ -129,6 +134,10 @@ namespace uno {
          direction.status = SubproblemStatus::INFEASIBLE;
          return;
       }
+      // the (iterative) linear solver failed
+      if (direction.status == SubproblemStatus::ERROR) {
+         return;
+      }
       direction.subproblem_objective = this->evaluate_subproblem_objective(direction);
 
       // determine if the direction is a "small direction" (Section 3.9 of the Ipopt paper) TODO
@@ -240,6 +249,10 @@ namespace uno {
       return evaluation_space.compute_hessian_quadratic_product(vector);
    }
 
+   void PrimalDualInteriorPointMethod::solve_kkt_system(const Vector<double>& rhs, Vector<double>& solution) {
+      this->linear_solver->solve_augmented_system(rhs, solution);
+   }
+
    void PrimalDualInteriorPointMethod::set_auxiliary_measure(const OptimizationProblem& problem, Iterate& iterate) {
       // auxiliary measure: barrier terms
       const PrimalDualInteriorPointProblem barrier_problem(problem, this->barrier_parameter(), this->parameters);
@@ -7,8 +7,9 @@
 #include <memory>
 #include "../InequalityHandlingMethod.hpp"
 #include "InteriorPointParameters.hpp"
-#include "ingredients/subproblem_solvers/DirectSymmetricIndefiniteLinearSolver.hpp"
+#include "ingredients/subproblem_solvers/SymmetricIndefiniteLinearSolver.hpp"
 #include "BarrierParameterUpdateStrategy.hpp"
+#include "tools/Statistics.hpp"
 
 namespace uno {
    // forward references
@@ -38,6 +39,7 @@ namespace uno {
       void compute_constraint_jacobian_vector_product(const Vector<double>& vector, Vector<double>& result) const override;
       void compute_constraint_jacobian_transposed_vector_product(const Vector<double>& vector, Vector<double>& result) const override;
       [[nodiscard]] double compute_hessian_quadratic_product(const Vector<double>& vector) const override;
+      void solve_kkt_system(const Vector<double>& rhs, Vector<double>& solution) override;
 
       // progress measures
       void set_auxiliary_measure(const OptimizationProblem& problem, Iterate& iterate) override;
@@ -51,7 +53,8 @@ namespace uno {
       [[nodiscard]] std::string get_name() const override;
 
    protected:
-      const std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<double>> linear_solver;
+      const Options& options;
+      std::unique_ptr<SymmetricIndefiniteLinearSolver<double>> linear_solver{}; // depends on the size of the system
       BarrierParameterUpdateStrategy barrier_parameter_update_strategy;
       double previous_barrier_parameter;
       const double default_multiplier;
@@ -61,6 +64,7 @@ namespace uno {
 
       bool solving_feasibility_problem{false};
       bool first_feasibility_iteration{false};
+      Statistics::ColumnHandle barrier_parameter_column{};
 
       [[nodiscard]] double barrier_parameter() const;
       void update_barrier_parameter(const PrimalDualInteriorPointProblem& barrier_problem, const Iterate& current_iterate,
@@ -3,6 +3,7 @@
 
 #include "PrimalDualInteriorPointProblem.hpp"
 #include "ingredients/hessian_models/HessianModel.hpp"
+#include "linear_algebra/SparseVector.hpp"
 #include "optimization/Direction.hpp"
 #include "optimization/Iterate.hpp"
 #include "symbolic/UnaryNegation.hpp"
@@ -15,7 +16,11 @@ namespace uno {
       const InteriorPointParameters &parameters):
          OptimizationProblem(problem.model, problem.number_variables, problem.number_constraints),
          first_reformulation(problem), barrier_parameter(barrier_parameter),
-         parameters(parameters), equality_constraints(problem.number_constraints) { }
+         parameters(parameters), equality_constraints(problem.number_constraints),
+         slacks(problem.model.number_variables - problem.model.get_slacks().size(), problem.model.number_variables),
+         variables_without_slacks(problem.model.number_variables - problem.model.get_slacks().size()),
+         barrier_condensable_variables(parameters.condense_slacks ? ForwardRange(this->slacks) : ForwardRange(0),
+            parameters.condense_elastic_variables ? problem.get_condensable_variables() : this->condensable_variables) { }
 
    double PrimalDualInteriorPointProblem::get_objective_multiplier() const {
       return this->first_reformulation.get_objective_multiplier();
@@ -172,11 +177,11 @@ namespace uno {
          if (finite_lower_bound || finite_upper_bound) {
             double diagonal_barrier_term = 0.;
             if (finite_lower_bound) { // lower bounded
-               const double distance_to_bound = vector[variable_index] - this->first_reformulation.variable_lower_bound(variable_index);
+               const double distance_to_bound = x[variable_index] - this->first_reformulation.variable_lower_bound(variable_index);
                diagonal_barrier_term += multipliers.lower_bounds[variable_index] / distance_to_bound;
             }
             if (finite_upper_bound) { // upper bounded
-               const double distance_to_bound = vector[variable_index] - this->first_reformulation.variable_upper_bound(variable_index);
+               const double distance_to_bound = x[variable_index] - this->first_reformulation.variable_upper_bound(variable_index);
                diagonal_barrier_term += multipliers.upper_bounds[variable_index] / distance_to_bound;
             }
             result[variable_index] += diagonal_barrier_term * vector[variable_index];
@@ -184,6 +189,23 @@ namespace uno {
       }
    }
 
+   void PrimalDualInteriorPointProblem::evaluate_diagonal_hessian_terms(const double* x, const Multipliers& multipliers,
+         double* diagonal) const {
+      this->first_reformulation.evaluate_diagonal_hessian_terms(x, multipliers, diagonal);
+
+      // barrier terms
+      for (size_t variable_index: Range(this->first_reformulation.number_variables)) {
+         if (is_finite(this->first_reformulation.variable_lower_bound(variable_index))) {
+            const double distance_to_bound = x[variable_index] - this->first_reformulation.variable_lower_bound(variable_index);
+            diagonal[variable_index] += multipliers.lower_bounds[variable_index] / distance_to_bound;
+         }
+         if (is_finite(this->first_reformulation.variable_upper_bound(variable_index))) {
+            const double distance_to_bound = x[variable_index] - this->first_reformulation.variable_upper_bound(variable_index);
+            diagonal[variable_index] += multipliers.upper_bounds[variable_index] / distance_to_bound;
+         }
+      }
+   }
+
    double PrimalDualInteriorPointProblem::variable_lower_bound(size_t /*variable_index*/) const {
       return -INF<double>;
    }
@@ -196,6 +218,14 @@ namespace uno {
       return this->fixed_variables;
    }
 
+   const Collection<size_t>& PrimalDualInteriorPointProblem::get_primal_regularization_variables() const {
+      if (this->parameters.condense_slacks) {
+         // the slacks are eliminated from the augmented system and cannot be regularized
+         return this->variables_without_slacks;
+      }
+      return this->first_reformulation.get_primal_regularization_variables();
+   }
+
    double PrimalDualInteriorPointProblem::constraint_lower_bound(size_t /*constraint_index*/) const {
       return 0.;
    }
@@ -222,6 +252,11 @@ namespace uno {
       return this->first_reformulation.get_equality_constraints();
    }
 
+   // the barrier terms make the diagonal terms of the slacks and elastic variables positive
+   const Collection<size_t>& PrimalDualInteriorPointProblem::get_condensable_variables() const {
+      return this->barrier_condensable_variables;
+   }
+
    void PrimalDualInteriorPointProblem::assemble_primal_dual_direction(const Iterate& current_iterate, const Vector<double>& solution,
          Direction& direction) const {
       // form the primal-dual direction
@@ -6,6 +6,7 @@
 
 #include "InteriorPointParameters.hpp"
 #include "optimization/OptimizationProblem.hpp"
+#include "symbolic/Concatenation.hpp"
 #include "symbolic/Range.hpp"
 
 namespace uno {
@@ -40,17 +41,19 @@ namespace uno {
          const Multipliers& multipliers, double* hessian_values) const override;
       void compute_hessian_vector_product(HessianModel& hessian_model, const double* x, const double* vector,
          const Multipliers& multipliers, double* result) const override;
+      void evaluate_diagonal_hessian_terms(const double* x, const Multipliers& multipliers, double* diagonal) const override;
 
       [[nodiscard]] double variable_lower_bound(size_t variable_index) const override;
       [[nodiscard]] double variable_upper_bound(size_t variable_index) const override;
       [[nodiscard]] const Vector<size_t>& get_fixed_variables() const override;
-      // [[nodiscard]] virtual const Collection<size_t>& get_primal_regularization_variables() const;
+      [[nodiscard]] const Collection<size_t>& get_primal_regularization_variables() const override;
 
       [[nodiscard]] double constraint_lower_bound(size_t constraint_index) const override;
       [[nodiscard]] double constraint_upper_bound(size_t constraint_index) const override;
       [[nodiscard]] const Collection<size_t>& get_equality_constraints() const override;
       [[nodiscard]] const Collection<size_t>& get_inequality_constraints() const override;
       [[nodiscard]] const Collection<size_t>& get_dual_regularization_constraints() const override;
+      [[nodiscard]] const Collection<size_t>& get_condensable_variables() const override;
 
       void assemble_primal_dual_direction(const Iterate& current_iterate, const Vector<double>& solution, Direction& direction) const override;
 
@@ -70,6 +73,10 @@ namespace uno {
       const Vector<size_t> fixed_variables{};
       const ForwardRange equality_constraints;
       const ForwardRange inequality_constraints{0};
+      // the slacks of the model are its last variables
+      const ForwardRange slacks;
+      const ForwardRange variables_without_slacks;
+      const Concatenation<ForwardRange, const Collection<size_t>&> barrier_condensable_variables;
 
       void compute_bound_dual_direction(const Iterate& current_iterate, Direction& direction) const;
       [[nodiscard]] double primal_fraction_to_boundary(const Vector<double>& current_primals, const Vector<double>& primal_direction,
@@ -0,0 +1,21 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_CURVATURETEST_H
+#define UNO_CURVATURETEST_H
+
+namespace uno {
+   // inertia-free regularization of the iterative linear solvers, which do not compute the inertia: the system is solved
+   // with a given primal regularization factor and the curvature of the Hessian along the primal direction is tested.
+   // The regularization strategy tests the unregularized system (factor 0) first
+   class CurvatureTest {
+   public:
+      CurvatureTest() = default;
+      virtual ~CurvatureTest() = default;
+
+      // returns true if the solution is accepted
+      virtual bool solve_with_sufficient_curvature(double primal_regularization) = 0;
+   };
+} // namespace
+
+#endif // UNO_CURVATURETEST_H
@@ -4,7 +4,9 @@
 #ifndef UNO_NOREGULARIZATION_H
 #define UNO_NOREGULARIZATION_H
 
+#include "CurvatureTest.hpp"
 #include "RegularizationStrategy.hpp"
+#include "ingredients/subproblem/Subproblem.hpp"
 
 namespace uno {
    template <typename ElementType>
@@ -46,6 +48,11 @@ namespace uno {
          }
       }
 
+      void regularize_with_curvature_test(Statistics& /*statistics*/, const Subproblem& /*subproblem*/,
+            CurvatureTest& curvature_test) override {
+         curvature_test.solve_with_sufficient_curvature(0.);
+      }
+
       [[nodiscard]] bool performs_primal_regularization() const override {
          return false;
       }
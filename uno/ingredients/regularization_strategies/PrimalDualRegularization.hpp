@@ -6,6 +6,7 @@
 
 #include <cassert>
 #include <string>
+#include "CurvatureTest.hpp"
 #include "RegularizationStrategy.hpp"
 #include "UnstableRegularization.hpp"
 #include "ingredients/subproblem_solvers/DirectSymmetricIndefiniteLinearSolver.hpp"
@@ -36,6 +37,8 @@ namespace uno {
          const double* augmented_matrix_values, ElementType dual_regularization_parameter,
          const Inertia& expected_inertia, DirectSymmetricIndefiniteLinearSolver<double>& linear_solver,
          double* primal_regularization_values, double* dual_regularization_values) override;
+      void regularize_with_curvature_test(Statistics& statistics, const Subproblem& subproblem,
+         CurvatureTest& curvature_test) override;
 
       [[nodiscard]] bool performs_primal_regularization() const override;
       [[nodiscard]] bool performs_dual_regularization() const override;
@@ -43,7 +46,7 @@ namespace uno {
       [[nodiscard]] std::string get_name() const override;
 
    protected:
-      const std::string& optional_linear_solver_name;
+      const Options& options; // copy of the options for delayed allocation of the linear solver
       std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<double>> optional_linear_solver{};
       ElementType primal_regularization{0.};
       ElementType dual_regularization{0.};
@@ -56,12 +59,13 @@ namespace uno {
       const ElementType primal_regularization_fast_increase_factor;
       const ElementType primal_regularization_slow_increase_factor;
       const size_t threshold_unsuccessful_attempts;
+      Statistics::ColumnHandle regularization_column{};
    };
 
    template <typename ElementType>
    PrimalDualRegularization<ElementType>::PrimalDualRegularization(const Options& options):
          RegularizationStrategy<ElementType>(),
-         optional_linear_solver_name(options.get_string("linear_solver")),
+         options(options),
          regularization_failure_threshold(ElementType(options.get_double("regularization_failure_threshold"))),
          primal_regularization_initial_factor(ElementType(options.get_double("primal_regularization_initial_factor"))),
          dual_regularization_fraction(ElementType(options.get_double("dual_regularization_fraction"))),
@@ -74,7 +78,7 @@ namespace uno {
 
    template <typename ElementType>
    void PrimalDualRegularization<ElementType>::initialize_statistics(Statistics& statistics, const Options& options) {
-      statistics.add_column("regulariz", Statistics::double_width - 4, options.get_int("statistics_regularization_column_order"));
+      this->regularization_column = statistics.add_column("regulariz", Statistics::double_width - 4, options.get_int("statistics_regularization_column_order"));
    }
 
    template <typename ElementType>
@@ -82,7 +86,9 @@ namespace uno {
          const double* hessian_values, const Inertia& expected_inertia, double* primal_regularization_values) {
       // pick the member linear solver
       if (this->optional_linear_solver == nullptr) {
-         this->optional_linear_solver = SymmetricIndefiniteLinearSolverFactory::create(this->optional_linear_solver_name);
+         this->optional_linear_solver = SymmetricIndefiniteLinearSolverFactory::create(
+            this->options.get_string("linear_solver"), this->options, subproblem.number_variables + subproblem.number_constraints,
+            subproblem.number_regularized_augmented_system_nonzeros());
          this->optional_linear_solver->initialize_augmented_system(subproblem);
          this->optional_linear_solver->do_symbolic_analysis();
       }
@@ -106,7 +112,9 @@ namespace uno {
          const double* augmented_matrix_values, ElementType dual_regularization_parameter,
          const Inertia& expected_inertia, double* primal_regularization_values, double* dual_regularization_values) {
       if (this->optional_linear_solver == nullptr) {
-         this->optional_linear_solver = SymmetricIndefiniteLinearSolverFactory::create(this->optional_linear_solver_name);
+         this->optional_linear_solver = SymmetricIndefiniteLinearSolverFactory::create(
+            this->options.get_string("linear_solver"), this->options, subproblem.number_variables + subproblem.number_constraints,
+            subproblem.number_regularized_augmented_system_nonzeros());
          this->optional_linear_solver->initialize_augmented_system(subproblem);
          this->optional_linear_solver->do_symbolic_analysis();
       }
@@ -129,7 +137,7 @@ namespace uno {
       for (size_t index: Range(subproblem.get_dual_regularization_constraints().size())) {
          dual_regularization_values[index] = -this->dual_regularization;
       }
-      DEBUG2 << "Original matrix values\n" << augmented_matrix_values << '\n';
+      UNO_LOG(DEBUG2) << "Original matrix values\n" << augmented_matrix_values << '\n';
       DEBUG << "Testing factorization with regularization factors (0, 0)\n";
       size_t number_attempts = 1;
       DEBUG << "Number of attempts: " << number_attempts << "\n\n";
@@ -142,7 +150,7 @@ namespace uno {
 
       if (estimated_inertia == expected_inertia) {
          DEBUG << "The inertia is correct\n";
-         statistics.set("regulariz", this->primal_regularization);
+         statistics.set(this->regularization_column, this->primal_regularization);
          return;
       }
 
@@ -171,7 +179,7 @@ namespace uno {
       bool good_inertia = false;
       while (!good_inertia) {
          DEBUG << "Testing factorization with regularization factors (" << this->primal_regularization << ", " << this->dual_regularization << ")\n";
-         DEBUG2 << augmented_matrix_values << '\n';
+         UNO_LOG(DEBUG2) << augmented_matrix_values << '\n';
          DEBUG << "Performing numerical factorization of the indefinite system\n";
          linear_solver.do_numerical_factorization(augmented_matrix_values);
          ++number_attempts;
@@ -209,7 +217,48 @@ namespace uno {
             }
          }
       }
-      statistics.set("regulariz", this->primal_regularization);
+      statistics.set(this->regularization_column, this->primal_regularization);
+   }
+
+   // the primal regularization factor follows the same sequence as with the inertia test. The dual regularization is not
+   // needed, since the iterative solvers do not factorize the (possibly singular) matrix
+   template <typename ElementType>
+   void PrimalDualRegularization<ElementType>::regularize_with_curvature_test(Statistics& statistics,
+         const Subproblem& /*subproblem*/, CurvatureTest& curvature_test) {
+      this->primal_regularization = ElementType(0);
+      this->dual_regularization = ElementType(0);
+      DEBUG << "Testing the curvature with regularization factor 0\n";
+      if (!curvature_test.solve_with_sufficient_curvature(0.)) {
+         if (this->previous_primal_regularization == 0.) {
+            this->primal_regularization = this->primal_regularization_initial_factor;
+         }
+         else {
+            this->primal_regularization = std::max(this->primal_regularization_lb,
+               this->previous_primal_regularization / this->primal_regularization_decrease_factor);
+         }
+         size_t number_attempts = 1;
+         bool good_curvature = false;
+         while (!good_curvature) {
+            DEBUG << "Testing the curvature with regularization factor " << this->primal_regularization << '\n';
+            ++number_attempts;
+            good_curvature = curvature_test.solve_with_sufficient_curvature(static_cast<double>(this->primal_regularization));
+            if (good_curvature) {
+               this->previous_primal_regularization = this->primal_regularization;
+            }
+            else {
+               if (this->previous_primal_regularization == 0. || this->threshold_unsuccessful_attempts < number_attempts) {
+                  this->primal_regularization *= this->primal_regularization_fast_increase_factor;
+               }
+               else {
+                  this->primal_regularization *= this->primal_regularization_slow_increase_factor;
+               }
+               if (this->regularization_failure_threshold < this->primal_regularization) {
+                  throw UnstableRegularization();
+               }
+            }
+         }
+      }
+      statistics.set(this->regularization_column, this->primal_regularization);
    }
 
    template <typename ElementType>
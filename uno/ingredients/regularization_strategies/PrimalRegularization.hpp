@@ -7,6 +7,7 @@
 #include <cassert>
 #include <memory>
 #include <string>
+#include "CurvatureTest.hpp"
 #include "RegularizationStrategy.hpp"
 #include "UnstableRegularization.hpp"
 #include "ingredients/subproblem/Subproblem.hpp"
@@ -38,6 +39,8 @@ namespace uno {
          const Inertia& expected_inertia, DirectSymmetricIndefiniteLinearSolver<double>& linear_solver,
          double* primal_regularization_values,
          double* dual_regularization_values) override;
+      void regularize_with_curvature_test(Statistics& statistics, const Subproblem& subproblem,
+         CurvatureTest& curvature_test) override;
 
       [[nodiscard]] bool performs_primal_regularization() const override;
       [[nodiscard]] bool performs_dual_regularization() const override;
@@ -45,18 +48,19 @@ namespace uno {
       [[nodiscard]] std::string get_name() const override;
 
    protected:
-      const std::string& optional_linear_solver_name;
+      const Options& options; // copy of the options for delayed allocation of the linear solver
       std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<double>> optional_linear_solver{};
       double regularization_factor{0.};
       const double regularization_initial_value{};
       const double regularization_increase_factor{};
       const double regularization_failure_threshold{};
+      Statistics::ColumnHandle regularization_column{};
    };
 
    template <typename ElementType>
    PrimalRegularization<ElementType>::PrimalRegularization(const Options& options):
          RegularizationStrategy<ElementType>(),
-         optional_linear_solver_name(options.get_string("linear_solver")),
+         options(options),
          regularization_initial_value(options.get_double("regularization_initial_value")),
          regularization_increase_factor(options.get_double("regularization_increase_factor")),
          regularization_failure_threshold(options.get_double("regularization_failure_threshold")) {
@@ -64,7 +68,7 @@ namespace uno {
 
    template <typename ElementType>
    void PrimalRegularization<ElementType>::initialize_statistics(Statistics& statistics, const Options& options) {
-      statistics.add_column("regulariz", Statistics::double_width - 4, options.get_int("statistics_regularization_column_order"));
+      this->regularization_column = statistics.add_column("regulariz", Statistics::double_width - 4, options.get_int("statistics_regularization_column_order"));
    }
 
    // Nocedal and Wright, p51
@@ -73,7 +77,9 @@ namespace uno {
          const double* hessian_values, const Inertia& expected_inertia, double* primal_regularization_values) {
       // pick the member linear solver
       if (this->optional_linear_solver == nullptr) {
-         this->optional_linear_solver = SymmetricIndefiniteLinearSolverFactory::create(this->optional_linear_solver_name);
+         this->optional_linear_solver = SymmetricIndefiniteLinearSolverFactory::create(
+            this->options.get_string("linear_solver"), this->options, subproblem.number_variables,
+            subproblem.number_regularized_hessian_nonzeros());
          this->optional_linear_solver->initialize_hessian(subproblem);
          this->optional_linear_solver->do_symbolic_analysis();
       }
@@ -87,7 +93,7 @@ namespace uno {
          DirectSymmetricIndefiniteLinearSolver<double>& linear_solver, double* primal_regularization_values) {
       assert(hessian_values != nullptr);
 
-      DEBUG << "Current Hessian:\n" << hessian_values << '\n';
+      UNO_LOG(DEBUG) << "Current Hessian:\n" << hessian_values << '\n';
       const double smallest_diagonal_entry = 0.; // TODO hessian_values.smallest_diagonal_entry(expected_inertia.positive);
       DEBUG << "The minimal diagonal entry of the matrix is " << smallest_diagonal_entry << '\n';
 
@@ -98,7 +104,7 @@ namespace uno {
          for (size_t index: Range(subproblem.get_primal_regularization_variables().size())) {
             primal_regularization_values[index] = this->regularization_factor;
          }
-         DEBUG << "Current Hessian:\n" << hessian_values;
+         UNO_LOG(DEBUG) << "Current Hessian:\n" << hessian_values;
 
          linear_solver.do_numerical_factorization(hessian_values);
          const Inertia estimated_inertia = linear_solver.get_inertia();
@@ -117,7 +123,7 @@ namespace uno {
          }
          DEBUG << '\n';
       }
-      statistics.set("regulariz", this->regularization_factor);
+      statistics.set(this->regularization_column, this->regularization_factor);
    }
 
    template <typename ElementType>
@@ -127,7 +133,9 @@ namespace uno {
          double* dual_regularization_values) {
       // pick the member linear solver
       if (this->optional_linear_solver == nullptr) {
-         this->optional_linear_solver = SymmetricIndefiniteLinearSolverFactory::create(this->optional_linear_solver_name);
+         this->optional_linear_solver = SymmetricIndefiniteLinearSolverFactory::create(
+            this->options.get_string("linear_solver"), this->options, subproblem.number_variables,
+            subproblem.number_regularized_hessian_nonzeros());
          this->optional_linear_solver->initialize_hessian(subproblem);
          this->optional_linear_solver->do_symbolic_analysis();
       }
@@ -144,6 +152,25 @@ namespace uno {
          primal_regularization_values);
    }
 
+   template <typename ElementType>
+   void PrimalRegularization<ElementType>::regularize_with_curvature_test(Statistics& statistics, const Subproblem& /*subproblem*/,
+         CurvatureTest& curvature_test) {
+      this->regularization_factor = 0.;
+      bool good_curvature = false;
+      while (!good_curvature) {
+         DEBUG << "Testing the curvature with regularization factor " << this->regularization_factor << '\n';
+         good_curvature = curvature_test.solve_with_sufficient_curvature(this->regularization_factor);
+         if (!good_curvature) {
+            this->regularization_factor = (this->regularization_factor == 0.) ? this->regularization_initial_value :
+               this->regularization_increase_factor * this->regularization_factor;
+            if (this->regularization_factor > this->regularization_failure_threshold) {
+               throw UnstableRegularization();
+            }
+         }
+      }
+      statistics.set(this->regularization_column, this->regularization_factor);
+   }
+
    template <typename ElementType>
    bool PrimalRegularization<ElementType>::performs_primal_regularization() const {
       return true;
@@ -10,6 +10,7 @@ namespace uno {
    // forward declarations
    template <typename ElementType>
    class Collection;
+   class CurvatureTest;
    template <typename ElementType>
    class DirectSymmetricIndefiniteLinearSolver;
    class HessianModel;
@@ -41,6 +42,9 @@ namespace uno {
          const double* augmented_matrix_values, ElementType dual_regularization_parameter,
          const Inertia& expected_inertia, DirectSymmetricIndefiniteLinearSolver<double>& linear_solver,
          double* primal_regularization_values, double* dual_regularization_values) = 0;
+      // inertia-free regularization (iterative linear solvers)
+      virtual void regularize_with_curvature_test(Statistics& statistics, const Subproblem& subproblem,
+         CurvatureTest& curvature_test) = 0;
 
       [[nodiscard]] virtual bool performs_primal_regularization() const = 0;
       [[nodiscard]] virtual bool performs_dual_regularization() const = 0;
@@ -3,6 +3,7 @@
 
 #include "Subproblem.hpp"
 #include "ingredients/hessian_models/HessianModel.hpp"
+#include "ingredients/regularization_strategies/CurvatureTest.hpp"
 #include "ingredients/regularization_strategies/RegularizationStrategy.hpp"
 #include "ingredients/subproblem_solvers/DirectSymmetricIndefiniteLinearSolver.hpp"
 #include "linear_algebra/SparseVector.hpp"
@@ -102,6 +103,21 @@ namespace uno {
       }
    }
 
+   // inertia-free regularization: the factor of the regularization strategy is picked up by compute_hessian_vector_product
+   void Subproblem::regularize_with_curvature_test(Statistics& statistics, CurvatureTest& curvature_test) const {
+      if (!this->hessian_model.is_positive_definite() && this->regularization_strategy.performs_primal_regularization() &&
+            !this->get_primal_regularization_variables().empty()) {
+         this->regularization_strategy.regularize_with_curvature_test(statistics, *this, curvature_test);
+      }
+      else {
+         curvature_test.solve_with_sufficient_curvature(0.);
+      }
+   }
+
+   void Subproblem::evaluate_diagonal_hessian_terms(double* diagonal) const {
+      this->problem.evaluate_diagonal_hessian_terms(this->current_iterate.primals.data(), this->current_iterate.multipliers, diagonal);
+   }
+
    void Subproblem::assemble_augmented_matrix(Statistics& statistics, double* augmented_matrix_values) const {
       // evaluate the Lagrangian Hessian of the problem at the current primal-dual point
       this->problem.evaluate_lagrangian_hessian(statistics, this->hessian_model, this->current_iterate.primals,
@@ -111,15 +127,17 @@ namespace uno {
       this->problem.evaluate_constraint_jacobian(this->current_iterate, augmented_matrix_values + this->number_hessian_nonzeros());
    }
 
-   void Subproblem::regularize_augmented_matrix(Statistics& statistics, double* augmented_matrix_values,
-         double dual_regularization_parameter, DirectSymmetricIndefiniteLinearSolver<double>& linear_solver) const {
+   // the regularization entries start at regularization_offset. The variables condensed out of the augmented matrix
+   // no longer contribute positive eigenvalues
+   void Subproblem::regularize_augmented_matrix(Statistics& statistics, double* augmented_matrix_values, size_t regularization_offset,
+         size_t number_condensed_variables, double dual_regularization_parameter,
+         DirectSymmetricIndefiniteLinearSolver<double>& linear_solver) const {
       if ((!this->hessian_model.is_positive_definite() && this->regularization_strategy.performs_dual_regularization()) ||
             this->regularization_strategy.performs_dual_regularization()) {
-         const Inertia expected_inertia{this->number_variables, this->number_constraints, 0};
+         const Inertia expected_inertia{this->number_variables - number_condensed_variables, this->number_constraints, 0};
 
-         const size_t offset = this->number_hessian_nonzeros() + this->problem.number_jacobian_nonzeros();
-         double* primal_regularization_values = augmented_matrix_values + offset;
-         double* dual_regularization_values = augmented_matrix_values + offset + this->get_primal_regularization_variables().size();
+         double* primal_regularization_values = augmented_matrix_values + regularization_offset;
+         double* dual_regularization_values = primal_regularization_values + this->get_primal_regularization_variables().size();
          this->regularization_strategy.regularize_augmented_matrix(statistics, *this, augmented_matrix_values,
             dual_regularization_parameter, expected_inertia, linear_solver, primal_regularization_values, dual_regularization_values);
       }
@@ -193,6 +211,10 @@ namespace uno {
       return this->problem.get_dual_regularization_constraints();
    }
 
+   const Collection<size_t>& Subproblem::get_condensable_variables() const {
+      return this->problem.get_condensable_variables();
+   }
+
    size_t Subproblem::number_jacobian_nonzeros() const {
       return this->problem.number_jacobian_nonzeros();
    }
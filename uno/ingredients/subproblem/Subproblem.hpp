@@ -16,6 +16,7 @@
 
 namespace uno {
    // forward declarations
+   class CurvatureTest;
    template <typename ElementType>
    class DirectSymmetricIndefiniteLinearSolver;
    class HessianModel;
@@ -43,11 +44,14 @@ namespace uno {
       void evaluate_lagrangian_hessian(Statistics& statistics, double* hessian_values) const;
       void regularize_lagrangian_hessian(Statistics& statistics, double* hessian_values) const;
       void compute_hessian_vector_product(const double* x, const double* vector, double* result) const;
+      void regularize_with_curvature_test(Statistics& statistics, CurvatureTest& curvature_test) const;
+      void evaluate_diagonal_hessian_terms(double* diagonal) const;
 
       // augmented system
       void assemble_augmented_matrix(Statistics& statistics, double* augmented_matrix_values) const;
-      void regularize_augmented_matrix(Statistics& statistics, double* augmented_matrix_values,
-         double dual_regularization_parameter, DirectSymmetricIndefiniteLinearSolver<double>& linear_solver) const;
+      void regularize_augmented_matrix(Statistics& statistics, double* augmented_matrix_values, size_t regularization_offset,
+         size_t number_condensed_variables, double dual_regularization_parameter,
+         DirectSymmetricIndefiniteLinearSolver<double>& linear_solver) const;
       template <typename IndexType>
       void assemble_augmented_rhs(const Vector<double>& objective_gradient, const Vector<double>& constraints,
          const Matrix<IndexType>& constraint_jacobian, Vector<double>& rhs) const;
@@ -71,6 +75,7 @@ namespace uno {
 
       [[nodiscard]] const Collection<size_t>& get_primal_regularization_variables() const;
       [[nodiscard]] const Collection<size_t>& get_dual_regularization_constraints() const;
+      [[nodiscard]] const Collection<size_t>& get_condensable_variables() const;
 
       [[nodiscard]] size_t number_jacobian_nonzeros() const;
       [[nodiscard]] size_t number_hessian_nonzeros() const;
@@ -107,7 +112,7 @@ namespace uno {
       for (size_t constraint_index: Range(this->number_constraints)) {
          rhs[this->number_variables + constraint_index] = -constraints[constraint_index];
       }
-      DEBUG2 << "RHS: "; print_vector(DEBUG2, view(rhs, 0, this->number_variables + this->number_constraints)); DEBUG << '\n';
+      UNO_LOG(DEBUG2) << "RHS: " << view(rhs, 0, this->number_variables + this->number_constraints) << '\n';
    }
 
    template <typename Array>
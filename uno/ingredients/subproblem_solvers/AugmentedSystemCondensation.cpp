@@ -0,0 +1,183 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <cassert>
+#include <initializer_list>
+#include <utility>
+#include "AugmentedSystemCondensation.hpp"
+#include "symbolic/Collection.hpp"
+#include "symbolic/Range.hpp"
+#include "tools/Logger.hpp"
+
+namespace uno {
+   void AugmentedSystemCondensation::initialize(const Collection<size_t>& candidate_variables, size_t number_variables,
+         size_t number_constraints, const std::vector<int>& augmented_row_indices, const std::vector<int>& augmented_column_indices,
+         size_t number_unregularized_nonzeros) {
+      this->augmented_dimension = number_variables + number_constraints;
+      this->condensed_variables.clear();
+      this->kept_nonzeros.clear();
+      this->row_indices.clear();
+      this->column_indices.clear();
+
+      // gather the diagonal and off-diagonal entries in the rows of the candidate variables
+      std::vector<bool> is_candidate(this->augmented_dimension, false);
+      for (size_t variable_index: candidate_variables) {
+         if (variable_index < number_variables) {
+            is_candidate[variable_index] = true;
+         }
+      }
+      std::vector<size_t> number_off_diagonal_entries(this->augmented_dimension, 0);
+      std::vector<size_t> coupling_nonzeros(this->augmented_dimension, 0);
+      std::vector<size_t> constraint_rows(this->augmented_dimension, 0);
+      std::vector<std::vector<size_t>> diagonal_nonzeros(this->augmented_dimension);
+      for (size_t nonzero_index: Range(augmented_row_indices.size())) {
+         const size_t row_index = static_cast<size_t>(augmented_row_indices[nonzero_index] - 1);
+         const size_t column_index = static_cast<size_t>(augmented_column_indices[nonzero_index] - 1);
+         if (number_unregularized_nonzeros <= nonzero_index) {
+            // the regularization of a variable would modify its diagonal term during the factorization
+            is_candidate[row_index] = false;
+            is_candidate[column_index] = false;
+         }
+         else if (row_index == column_index) {
+            diagonal_nonzeros[row_index].push_back(nonzero_index);
+         }
+         else {
+            for (const auto& [index, other_index]: {std::pair{row_index, column_index}, std::pair{column_index, row_index}}) {
+               if (is_candidate[index]) {
+                  if (other_index < number_variables) { // Hessian entry that couples two variables
+                     is_candidate[index] = false;
+                  }
+                  else { // Jacobian entry
+                     ++number_off_diagonal_entries[index];
+                     coupling_nonzeros[index] = nonzero_index;
+                     constraint_rows[index] = other_index;
+                  }
+               }
+            }
+         }
+      }
+
+      // number the rows of the condensed system
+      this->condensed_index.resize(this->augmented_dimension);
+      size_t current_index = 0;
+      for (size_t index: Range(this->augmented_dimension)) {
+         if (is_candidate[index] && number_off_diagonal_entries[index] == 1 && !diagonal_nonzeros[index].empty()) {
+            this->condensed_index[index] = AugmentedSystemCondensation::eliminated;
+            this->condensed_variables.push_back({index, constraint_rows[index], coupling_nonzeros[index],
+               std::move(diagonal_nonzeros[index]), 0});
+         }
+         else {
+            this->condensed_index[index] = current_index;
+            ++current_index;
+         }
+      }
+      if (!this->is_active()) {
+         return;
+      }
+      DEBUG << "Condensing " << this->condensed_variables.size() << " variables out of the augmented system\n";
+
+      // sparsity pattern of the condensed matrix: Hessian and Jacobian entries that do not involve eliminated variables...
+      for (size_t nonzero_index: Range(number_unregularized_nonzeros)) {
+         const size_t row_index = this->condensed_index[static_cast<size_t>(augmented_row_indices[nonzero_index] - 1)];
+         const size_t column_index = this->condensed_index[static_cast<size_t>(augmented_column_indices[nonzero_index] - 1)];
+         if (row_index != AugmentedSystemCondensation::eliminated && column_index != AugmentedSystemCondensation::eliminated) {
+            this->kept_nonzeros.push_back(nonzero_index);
+            this->row_indices.push_back(static_cast<int>(row_index) + 1);
+            this->column_indices.push_back(static_cast<int>(column_index) + 1);
+         }
+      }
+      // ... diagonal terms of the constraints coupled to the eliminated variables...
+      std::vector<size_t> constraint_diagonal_nonzeros(this->augmented_dimension, AugmentedSystemCondensation::eliminated);
+      for (CondensedVariable& variable: this->condensed_variables) {
+         if (constraint_diagonal_nonzeros[variable.constraint_row] == AugmentedSystemCondensation::eliminated) {
+            constraint_diagonal_nonzeros[variable.constraint_row] = this->row_indices.size();
+            const int constraint_index = static_cast<int>(this->condensed_index[variable.constraint_row]) + 1;
+            this->row_indices.push_back(constraint_index);
+            this->column_indices.push_back(constraint_index);
+         }
+         variable.condensed_diagonal_nonzero = constraint_diagonal_nonzeros[variable.constraint_row];
+      }
+      this->number_condensed_unregularized_nonzeros = this->row_indices.size();
+      // ... and regularization entries
+      for (size_t nonzero_index: Range(number_unregularized_nonzeros, augmented_row_indices.size())) {
+         this->row_indices.push_back(static_cast<int>(this->condensed_index[static_cast<size_t>(augmented_row_indices[nonzero_index] - 1)]) + 1);
+         this->column_indices.push_back(static_cast<int>(this->condensed_index[static_cast<size_t>(augmented_column_indices[nonzero_index] - 1)]) + 1);
+      }
+   }
+
+   bool AugmentedSystemCondensation::is_active() const {
+      return !this->condensed_variables.empty();
+   }
+
+   size_t AugmentedSystemCondensation::number_condensed_variables() const {
+      return this->condensed_variables.size();
+   }
+
+   size_t AugmentedSystemCondensation::dimension() const {
+      return this->augmented_dimension - this->condensed_variables.size();
+   }
+
+   size_t AugmentedSystemCondensation::number_nonzeros() const {
+      return this->row_indices.size();
+   }
+
+   size_t AugmentedSystemCondensation::number_unregularized_nonzeros() const {
+      return this->number_condensed_unregularized_nonzeros;
+   }
+
+   size_t AugmentedSystemCondensation::condensed_row(size_t augmented_row) const {
+      return this->condensed_index[augmented_row];
+   }
+
+   void AugmentedSystemCondensation::condense_matrix(const Vector<double>& augmented_matrix_values, Vector<double>& matrix_values) const {
+      for (size_t nonzero_index: Range(this->kept_nonzeros.size())) {
+         matrix_values[nonzero_index] = augmented_matrix_values[this->kept_nonzeros[nonzero_index]];
+      }
+      for (size_t nonzero_index: Range(this->kept_nonzeros.size(), this->number_condensed_unregularized_nonzeros)) {
+         matrix_values[nonzero_index] = 0.;
+      }
+      for (const CondensedVariable& variable: this->condensed_variables) {
+         const double coupling_term = augmented_matrix_values[variable.coupling_nonzero];
+         matrix_values[variable.condensed_diagonal_nonzero] -= coupling_term * coupling_term /
+            AugmentedSystemCondensation::diagonal_term(variable, augmented_matrix_values);
+      }
+   }
+
+   void AugmentedSystemCondensation::condense_rhs(const Vector<double>& augmented_matrix_values, const Vector<double>& augmented_rhs,
+         Vector<double>& rhs) const {
+      for (size_t index: Range(this->augmented_dimension)) {
+         if (this->condensed_index[index] != AugmentedSystemCondensation::eliminated) {
+            rhs[this->condensed_index[index]] = augmented_rhs[index];
+         }
+      }
+      for (const CondensedVariable& variable: this->condensed_variables) {
+         rhs[this->condensed_index[variable.constraint_row]] -= augmented_matrix_values[variable.coupling_nonzero] *
+            augmented_rhs[variable.variable_index] / AugmentedSystemCondensation::diagonal_term(variable, augmented_matrix_values);
+      }
+   }
+
+   void AugmentedSystemCondensation::expand_solution(const Vector<double>& augmented_matrix_values, const Vector<double>& augmented_rhs,
+         const Vector<double>& solution, Vector<double>& augmented_solution) const {
+      for (size_t index: Range(this->augmented_dimension)) {
+         if (this->condensed_index[index] != AugmentedSystemCondensation::eliminated) {
+            augmented_solution[index] = solution[this->condensed_index[index]];
+         }
+      }
+      for (const CondensedVariable& variable: this->condensed_variables) {
+         augmented_solution[variable.variable_index] = (augmented_rhs[variable.variable_index] -
+            augmented_matrix_values[variable.coupling_nonzero] * augmented_solution[variable.constraint_row]) /
+            AugmentedSystemCondensation::diagonal_term(variable, augmented_matrix_values);
+      }
+   }
+
+   // protected member functions
+
+   double AugmentedSystemCondensation::diagonal_term(const CondensedVariable& variable, const Vector<double>& augmented_matrix_values) {
+      double diagonal_term = 0.;
+      for (size_t nonzero_index: variable.diagonal_nonzeros) {
+         diagonal_term += augmented_matrix_values[nonzero_index];
+      }
+      assert(0. < diagonal_term && "The diagonal term of a condensed variable is not positive");
+      return diagonal_term;
+   }
+} // namespace
@@ -0,0 +1,75 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_AUGMENTEDSYSTEMCONDENSATION_H
+#define UNO_AUGMENTEDSYSTEMCONDENSATION_H
+
+#include <cstddef>
+#include <vector>
+#include "linear_algebra/Vector.hpp"
+
+namespace uno {
+   // forward declaration
+   template <typename ElementType>
+   class Collection;
+
+   // elimination of variables from the augmented system. A variable v can be eliminated if its row in the augmented
+   // matrix contains a positive diagonal d_v (e.g. a barrier term) and a single off-diagonal entry a_v in the row of a
+   // constraint j (e.g. elastic variables or slacks). Its elimination adds the term -a_v^2/d_v to the diagonal of the
+   // constraint block:
+   //   [d_v  a_v] [dx_v]   [r_v]                                     dx_v = (r_v - a_v dy_j) / d_v
+   //   [a_v  ...] [dy_j] = [r_j]  =>  (... - a_v^2/d_v) dy_j = r_j - a_v r_v/d_v
+   // The inertia of the condensed matrix is that of the augmented matrix minus one positive eigenvalue per eliminated
+   // variable
+   class AugmentedSystemCondensation {
+   public:
+      static constexpr size_t eliminated = static_cast<size_t>(-1);
+
+      AugmentedSystemCondensation() = default;
+
+      // select the candidate variables that can be eliminated, given the sparsity pattern (Fortran indexing) of the
+      // augmented matrix. The first number_unregularized_nonzeros entries are the Hessian and Jacobian entries, the
+      // remaining ones are the regularization entries
+      void initialize(const Collection<size_t>& candidate_variables, size_t number_variables, size_t number_constraints,
+         const std::vector<int>& augmented_row_indices, const std::vector<int>& augmented_column_indices,
+         size_t number_unregularized_nonzeros);
+
+      [[nodiscard]] bool is_active() const;
+      [[nodiscard]] size_t number_condensed_variables() const;
+      [[nodiscard]] size_t dimension() const;
+      [[nodiscard]] size_t number_nonzeros() const;
+      [[nodiscard]] size_t number_unregularized_nonzeros() const;
+      // row of the condensed system of a row of the augmented system (or eliminated)
+      [[nodiscard]] size_t condensed_row(size_t augmented_row) const;
+
+      // the regularization entries of the condensed matrix (the last ones) are not modified
+      void condense_matrix(const Vector<double>& augmented_matrix_values, Vector<double>& matrix_values) const;
+      void condense_rhs(const Vector<double>& augmented_matrix_values, const Vector<double>& augmented_rhs,
+         Vector<double>& rhs) const;
+      void expand_solution(const Vector<double>& augmented_matrix_values, const Vector<double>& augmented_rhs,
+         const Vector<double>& solution, Vector<double>& augmented_solution) const;
+
+      // sparsity pattern of the condensed matrix (Fortran indexing)
+      std::vector<int> row_indices{};
+      std::vector<int> column_indices{};
+
+   protected:
+      struct CondensedVariable {
+         size_t variable_index;
+         size_t constraint_row; // row of the constraint in the augmented system
+         size_t coupling_nonzero; // augmented nonzero of a_v
+         std::vector<size_t> diagonal_nonzeros; // augmented nonzeros whose sum is d_v
+         size_t condensed_diagonal_nonzero; // condensed nonzero of the diagonal term of the constraint
+      };
+
+      size_t augmented_dimension{0};
+      std::vector<CondensedVariable> condensed_variables{};
+      std::vector<size_t> condensed_index{}; // row in the condensed system of each row of the augmented system
+      std::vector<size_t> kept_nonzeros{}; // augmented nonzero of each unregularized condensed nonzero
+      size_t number_condensed_unregularized_nonzeros{0};
+
+      [[nodiscard]] static double diagonal_term(const CondensedVariable& variable, const Vector<double>& augmented_matrix_values);
+   };
+} // namespace
+
+#endif // UNO_AUGMENTEDSYSTEMCONDENSATION_H
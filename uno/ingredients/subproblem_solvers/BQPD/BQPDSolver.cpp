@@ -1,7 +1,9 @@
 // Copyright (c) 2018-2024 Charlie Vanaret
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include "BQPDSolver.hpp"
 #include "ingredients/hessian_models/HessianModel.hpp"
 #include "ingredients/subproblem/Subproblem.hpp"
@@ -57,6 +59,8 @@ namespace uno {
          QPSolver(),
          alp(static_cast<size_t>(this->mlp)),
          lp(static_cast<size_t>(this->mlp)),
+         initial_kmax(options.get_unsigned_int("BQPD_kmax")),
+         workspace_increase_factor(options.get_double("BQPD_workspace_increase_factor")),
          print_subproblem(options.get_bool("print_subproblem")) {
    }
 
@@ -81,20 +85,16 @@ namespace uno {
          this->active_set[variable_index] = static_cast<int>(variable_index + Indexing::Fortran_indexing);
       }
 
-      // determine whether the subproblem has curvature
-      this->kmax = subproblem.has_curvature() ? pick_kmax_heuristically(subproblem.number_variables,
-         subproblem.number_constraints) : 0;
-
-      // allocation of integer and real workspaces
-      this->mxws = static_cast<size_t>(this->kmax * (this->kmax + 9) / 2) + 2 * subproblem.number_variables +
-         subproblem.number_constraints /* (required by bqpd.f) */ + 5 * subproblem.number_variables + this->nprof /* (required
-         by sparseL.f) */;
-      // 6 pointers hidden in lws
-      constexpr size_t hidden_pointers_size = 6*sizeof(intptr_t);
-      this->mxlws = hidden_pointers_size + static_cast<size_t>(this->kmax) /* (required by bqpd.f) */ +
-         9 * subproblem.number_variables + subproblem.number_constraints /* (required by sparseL.f) */;
-      this->ws.resize(this->mxws);
-      this->lws.resize(this->mxlws);
+      // determine whether the subproblem has curvature. The initial kmax is small and grows when BQPD runs out of space.
+      // The estimate does not count the condensable variables (e.g. the elastic variables of the l1 relaxation): this is
+      // a heuristic, not a bound. An elastic variable that leaves its bound may enlarge the nullspace, in which case kmax
+      // grows as usual
+      this->number_variables = subproblem.number_variables;
+      this->number_constraints = subproblem.number_constraints;
+      const size_t number_curved_variables = subproblem.number_variables - subproblem.get_condensable_variables().size();
+      this->kmax = subproblem.has_curvature() ? std::min(static_cast<int>(this->initial_kmax),
+         pick_kmax_heuristically(number_curved_variables, subproblem.number_constraints)) : 0;
+      this->allocate_workspace();
    }
 
    void BQPDSolver::solve(Statistics& statistics, Subproblem& subproblem, const Vector<double>& initial_point,
@@ -145,10 +145,10 @@ namespace uno {
 
    void BQPDSolver::display_subproblem(const Subproblem& subproblem, const Vector<double>& initial_point) const {
       DEBUG << "Subproblem:\n";
-      DEBUG << "Linear objective part: " << view(this->evaluation_space.gradients, 0, subproblem.number_variables) << '\n';
+      UNO_LOG(DEBUG) << "Linear objective part: " << view(this->evaluation_space.gradients, 0, subproblem.number_variables) << '\n';
       // note: Hessian values may not be available yet
       // DEBUG << "Hessian: " << this->hessian_values << '\n';
-      DEBUG << "Jacobian: " << view(this->evaluation_space.gradients, subproblem.number_variables, subproblem.number_variables +
+      UNO_LOG(DEBUG) << "Jacobian: " << view(this->evaluation_space.gradients, subproblem.number_variables, subproblem.number_variables +
          subproblem.number_jacobian_nonzeros()) << '\n';
       for (size_t variable_index: Range(subproblem.number_variables)) {
          DEBUG << "d" << variable_index << " in [" << this->lower_bounds[variable_index] << ", " << this->upper_bounds[variable_index] << "]\n";
@@ -160,22 +160,44 @@ namespace uno {
       DEBUG << "Initial point: " << initial_point << '\n';
    }
 
-   // we use (x*4)/3 to increase by 33% TODO add an option
+   // allocation of integer and real workspaces. The workspaces never shrink
+   void BQPDSolver::allocate_workspace() {
+      const size_t kmax_size = static_cast<size_t>(this->kmax);
+      const size_t required_mxws = kmax_size * (kmax_size + 9) / 2 + 2 * this->number_variables + this->number_constraints
+         /* (required by bqpd.f) */ + 5 * this->number_variables + this->nprof /* (required by sparseL.f) */;
+      // 6 pointers hidden in lws
+      constexpr size_t hidden_pointers_size = 6*sizeof(intptr_t);
+      const size_t required_mxlws = hidden_pointers_size + kmax_size /* (required by bqpd.f) */ + 9 * this->number_variables +
+         this->number_constraints /* (required by sparseL.f) */;
+      this->mxws = std::max(this->mxws, required_mxws);
+      this->mxlws = std::max(this->mxlws, required_mxlws);
+      this->ws.resize(this->mxws);
+      this->lws.resize(this->mxlws);
+      WSC.mxws = static_cast<int>(this->mxws);
+      WSC.mxlws = static_cast<int>(this->mxlws);
+   }
+
+   // grow the workspaces if BQPD ran out of space. Return true if the status is final
    bool BQPDSolver::check_sufficient_workspace_size(BQPDStatus bqpd_status) {
       switch (bqpd_status) {
-         case BQPDStatus::REDUCED_HESSIAN_INSUFFICIENT_SPACE:
-            // increase kmax
-            this->kmax = (this->kmax*4)/3;
+         case BQPDStatus::REDUCED_HESSIAN_INSUFFICIENT_SPACE: {
+            // increase kmax (bounded by the number of variables) and the real workspace that stores the reduced Hessian
+            const int maximum_kmax = static_cast<int>(this->number_variables);
+            if (maximum_kmax <= this->kmax) {
+               return true;
+            }
+            this->kmax = std::min(maximum_kmax, std::max(this->kmax + 1,
+               static_cast<int>(std::ceil(this->workspace_increase_factor * this->kmax))));
+            DEBUG << "BQPD: kmax increased to " << this->kmax << '\n';
+            this->allocate_workspace();
             return false;
-
+         }
          case BQPDStatus::SPARSE_INSUFFICIENT_SPACE:
             // allocate more size for (sparse) factors
-            this->mxws = (this->mxws*4)/3;
-            this->mxlws = (this->mxlws*4)/3;
-            this->ws.resize(this->mxws);
-            this->lws.resize(this->mxlws);
-            WSC.mxws = static_cast<int>(this->mxws);
-            WSC.mxlws = static_cast<int>(this->mxlws);
+            this->mxws = static_cast<size_t>(std::ceil(this->workspace_increase_factor * static_cast<double>(this->mxws)));
+            this->mxlws = static_cast<size_t>(std::ceil(this->workspace_increase_factor * static_cast<double>(this->mxlws)));
+            DEBUG << "BQPD: workspaces increased to " << this->mxws << " and " << this->mxlws << '\n';
+            this->allocate_workspace();
             return false;
 
          default:
@@ -190,8 +212,8 @@ namespace uno {
       const int n = static_cast<int>(subproblem.number_variables);
       const int m = static_cast<int>(subproblem.number_constraints);
 
-      const BQPDMode mode = BQPDSolver::determine_mode(warmstart_information);
-      const int mode_integer = static_cast<int>(mode);
+      const BQPDMode mode = this->determine_mode(subproblem, initial_point, warmstart_information);
+      int mode_integer = static_cast<int>(mode);
 
       // solve the LP/QP
       bool termination = false;
@@ -208,6 +230,18 @@ namespace uno {
          if (termination) {
             direction.status = BQPDSolver::status_from_bqpd_status(bqpd_status);
          }
+         else {
+            // resume from the current point and active set after the workspaces were resized
+            mode_integer = static_cast<int>(BQPDMode::USER_DEFINED);
+         }
+      }
+
+      // save the active set of the subproblems solved to optimality
+      this->previous_solve_optimal = (direction.status == SubproblemStatus::OPTIMAL);
+      if (this->previous_solve_optimal) {
+         this->saved_active_set = this->active_set;
+         this->saved_k = this->k;
+         this->has_saved_active_set = true;
       }
 
       // project solution into bounds
@@ -218,20 +252,84 @@ namespace uno {
       this->set_multipliers(subproblem.number_variables, direction.multipliers);
    }
 
-   BQPDMode BQPDSolver::determine_mode(const WarmstartInformation& warmstart_information) {
+   BQPDMode BQPDSolver::determine_mode(const Subproblem& subproblem, const Vector<double>& initial_point,
+         const WarmstartInformation& warmstart_information) {
+      // the previous subproblem was not solved to optimality (e.g. infeasible subproblem before a switch to the other phase):
+      // its active set is not a good estimate. Restore that of the last subproblem solved to optimality
+      if (!this->previous_solve_optimal && this->has_saved_active_set) {
+         this->active_set = this->saved_active_set;
+         this->k = this->saved_k;
+      }
+
       BQPDMode mode = BQPDMode::USER_DEFINED;
-      // if problem structure changed, use cold start
+      // the structure of the problem changed (e.g. switch between the optimality and feasibility phases). Each phase has its
+      // own solver whose sparsity patterns are fixed, so the saved active set remains meaningful
       if (warmstart_information.hessian_sparsity_changed || warmstart_information.jacobian_sparsity_changed) {
-         mode = BQPDMode::ACTIVE_SET_EQUALITIES;
+         if (this->has_saved_active_set) {
+            DEBUG << "BQPD: warmstart with the active set of the last subproblem solved in this phase\n";
+         }
+         // first solve in this phase: map the active bounds of the initial point (e.g. the solution of the subproblem in the
+         // other phase, extended with the elastic variables) into an active set
+         else if (this->set_active_set_from_initial_point(subproblem, initial_point)) {
+            DEBUG << "BQPD: warmstart with the active bounds of the initial point\n";
+         }
+         // cold start
+         else {
+            mode = BQPDMode::ACTIVE_SET_EQUALITIES;
+         }
       }
       // if only the variable bounds changed, reuse the active set estimate and the Jacobian information
       else if (warmstart_information.variable_bounds_changed && !warmstart_information.objective_changed &&
-               !warmstart_information.constraints_changed && !warmstart_information.constraint_bounds_changed) {
+               !warmstart_information.constraints_changed && !warmstart_information.constraint_bounds_changed &&
+               this->previous_solve_optimal) {
          mode = BQPDMode::UNCHANGED_ACTIVE_SET_AND_JACOBIAN;
       }
       return mode;
    }
 
+   // the variables whose initial value is at one of the bounds form the active set. Return false if the initial point is trivial or if
+   // the dimension of the nullspace exceeds kmax
+   bool BQPDSolver::set_active_set_from_initial_point(const Subproblem& subproblem, const Vector<double>& initial_point) {
+      const size_t dimension = subproblem.number_variables + subproblem.number_constraints;
+      bool trivial_initial_point = true;
+      for (size_t variable_index: Range(subproblem.number_variables)) {
+         trivial_initial_point = trivial_initial_point && (initial_point[variable_index] == 0.);
+      }
+      if (trivial_initial_point) {
+         return false;
+      }
+      // active bounds first (positive index: lower bound, negative index: upper bound), then the inactive constraints
+      size_t number_active_bounds = 0;
+      for (size_t variable_index: Range(subproblem.number_variables)) {
+         const int fortran_index = static_cast<int>(variable_index + Indexing::Fortran_indexing);
+         if (initial_point[variable_index] <= this->lower_bounds[variable_index]) {
+            this->active_set[number_active_bounds++] = fortran_index;
+         }
+         else if (this->upper_bounds[variable_index] <= initial_point[variable_index]) {
+            this->active_set[number_active_bounds++] = -fortran_index;
+         }
+      }
+      const int nullspace_dimension = static_cast<int>(subproblem.number_variables - number_active_bounds);
+      if (this->kmax < nullspace_dimension) {
+         // restore the default active set
+         for (size_t index: Range(dimension)) {
+            this->active_set[index] = static_cast<int>(index + Indexing::Fortran_indexing);
+         }
+         return false;
+      }
+      size_t position = number_active_bounds;
+      for (size_t variable_index: Range(subproblem.number_variables)) {
+         if (this->lower_bounds[variable_index] < initial_point[variable_index] && initial_point[variable_index] < this->upper_bounds[variable_index]) {
+            this->active_set[position++] = static_cast<int>(variable_index + Indexing::Fortran_indexing);
+         }
+      }
+      for (size_t index: Range(subproblem.number_variables, dimension)) {
+         this->active_set[position++] = static_cast<int>(index + Indexing::Fortran_indexing);
+      }
+      this->k = nullspace_dimension;
+      return true;
+   }
+
    // hide pointers to arbitrary objects into this->workspace_sparsity (BQPD's lws)
    void BQPDSolver::hide_pointers_in_workspace(Statistics& statistics, const Subproblem& subproblem) {
       WSC.kk = 0; // length of ws that is used by gdotx
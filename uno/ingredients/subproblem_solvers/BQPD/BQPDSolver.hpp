@@ -55,12 +55,22 @@ namespace uno {
       BQPDEvaluationSpace evaluation_space;
       std::vector<double> lower_bounds{}, upper_bounds{}; // lower and upper bounds of variables and constraints
 
+      // the maximum dimension of the nullspace (and the workspaces that depend on it) only grows: it is the high-water mark
+      // of the nullspace dimensions encountered in previous solves
       int kmax{0};
       int mlp{1000};
       const size_t nprof{2000000};
+      size_t number_variables{0};
+      size_t number_constraints{0};
       std::array<int, 100> info{};
       std::vector<double> alp{};
       std::vector<int> lp{}, active_set{};
+      // active set (and nullspace dimension) of the last subproblem solved to optimality. Each phase of the constraint
+      // relaxation strategy owns its own solver, hence its own saved active set
+      std::vector<int> saved_active_set{};
+      int saved_k{0};
+      bool has_saved_active_set{false};
+      bool previous_solve_optimal{false};
       std::vector<double> w{}, gradient_solution{}, residuals{}, e{};
       size_t mxws{};
       size_t mxlws{};
@@ -71,17 +81,22 @@ namespace uno {
       double fmin{-1e20};
       int peq_solution{0}, ifail{0};
 
+      const size_t initial_kmax;
+      const double workspace_increase_factor;
       const bool print_subproblem;
 
       void set_up_subproblem(Statistics& statistics, const Subproblem& subproblem, const WarmstartInformation& warmstart_information);
       void display_subproblem(const Subproblem& subproblem, const Vector<double>& initial_point) const;
       void solve_subproblem(const Subproblem& subproblem, const Vector<double>& initial_point, Direction& direction,
          const WarmstartInformation& warmstart_information);
-      [[nodiscard]] static BQPDMode determine_mode(const WarmstartInformation& warmstart_information);
+      [[nodiscard]] BQPDMode determine_mode(const Subproblem& subproblem, const Vector<double>& initial_point,
+         const WarmstartInformation& warmstart_information);
+      [[nodiscard]] bool set_active_set_from_initial_point(const Subproblem& subproblem, const Vector<double>& initial_point);
       void hide_pointers_in_workspace(Statistics& statistics, const Subproblem& subproblem);
       void compute_gradients_sparsity(const Subproblem& subproblem);
       void set_multipliers(size_t number_variables, Multipliers& direction_multipliers) const;
       [[nodiscard]] static BQPDStatus bqpd_status_from_int(int ifail);
+      void allocate_workspace();
       [[nodiscard]] bool check_sufficient_workspace_size(BQPDStatus bqpd_status);
       [[nodiscard]] static SubproblemStatus status_from_bqpd_status(BQPDStatus bqpd_status);
    };
@@ -0,0 +1,12 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include "BoxQPSolverFactory.hpp"
+#include "InequalityConstrainedSolver.hpp"
+#include "SteihaugCGSolver.hpp"
+
+namespace uno {
+   std::unique_ptr<InequalityConstrainedSolver> BoxQPSolverFactory::create(const Options& options) {
+      return std::make_unique<SteihaugCGSolver>(options);
+   }
+} // namespace
@@ -0,0 +1,24 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_BOXQPSOLVERFACTORY_H
+#define UNO_BOXQPSOLVERFACTORY_H
+
+#include <initializer_list>
+#include <memory>
+
+namespace uno {
+   // forward declarations
+   class InequalityConstrainedSolver;
+   class Options;
+
+   class BoxQPSolverFactory {
+   public:
+      static std::unique_ptr<InequalityConstrainedSolver> create(const Options& options);
+
+      // list of available QP solvers for problems with bound constraints only
+      constexpr static std::initializer_list<const char*> available_solvers{"SteihaugCG"};
+   };
+} // namespace
+
+#endif // UNO_BOXQPSOLVERFACTORY_H
\ No newline at end of file
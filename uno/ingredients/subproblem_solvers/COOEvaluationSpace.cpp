@@ -1,7 +1,9 @@
 // Copyright (c) 2025 Charlie Vanaret
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
+#include <cmath>
 #include <stdexcept>
+#include <utility>
 #include "COOEvaluationSpace.hpp"
 #include "ingredients/subproblem/Subproblem.hpp"
 #include "ingredients/subproblem_solvers/DirectSymmetricIndefiniteLinearSolver.hpp"
@@ -15,7 +17,7 @@ namespace uno {
       if (!subproblem.has_hessian_matrix()) {
          throw std::runtime_error("The subproblem does not have an explicit Hessian matrix and cannot be solved with a direct linear solver");
       }
-      const size_t dimension = subproblem.number_variables;
+      this->dimension = subproblem.number_variables;
 
       // Hessian
       this->number_hessian_nonzeros = subproblem.number_hessian_nonzeros();
@@ -26,15 +28,15 @@ namespace uno {
       subproblem.compute_regularized_hessian_sparsity(this->matrix_row_indices.data(), this->matrix_column_indices.data(),
          Indexing::Fortran_indexing);
       this->matrix_values.resize(this->number_matrix_nonzeros);
-      this->rhs.resize(dimension);
-      this->solution.resize(dimension);
+      this->rhs.resize(this->dimension);
+      this->solution.resize(this->dimension);
    }
 
    void COOEvaluationSpace::initialize_augmented_system(const Subproblem& subproblem) {
       if (!subproblem.has_hessian_matrix()) {
          throw std::runtime_error("The subproblem does not have an explicit Hessian matrix and cannot be solved with a direct linear solver");
       }
-      const size_t dimension = subproblem.number_variables + subproblem.number_constraints;
+      this->dimension = subproblem.number_variables + subproblem.number_constraints;
 
       // evaluations
       this->objective_gradient.resize(subproblem.number_variables);
@@ -55,22 +57,36 @@ namespace uno {
       // compute the COO sparse representation
       subproblem.compute_regularized_augmented_matrix_sparsity(this->matrix_row_indices.data(), this->matrix_column_indices.data(),
          this->jacobian_row_indices.data(), this->jacobian_column_indices.data(), Indexing::Fortran_indexing);
+
+      // eliminate the condensable variables (if any): the linear solver works on the condensed matrix
+      this->condensation.initialize(subproblem.get_condensable_variables(), subproblem.number_variables,
+         subproblem.number_constraints, this->matrix_row_indices, this->matrix_column_indices,
+         this->number_hessian_nonzeros + this->number_jacobian_nonzeros);
+      if (this->condensation.is_active()) {
+         this->augmented_matrix_values.resize(this->number_matrix_nonzeros);
+         this->augmented_rhs.resize(this->dimension);
+         this->augmented_solution.resize(this->dimension);
+         this->dimension = this->condensation.dimension();
+         this->number_matrix_nonzeros = this->condensation.number_nonzeros();
+         this->matrix_row_indices = std::move(this->condensation.row_indices);
+         this->matrix_column_indices = std::move(this->condensation.column_indices);
+      }
       this->matrix_values.resize(this->number_matrix_nonzeros);
-      this->rhs.resize(dimension);
-      this->solution.resize(dimension);
+      this->rhs.resize(this->dimension);
+      this->solution.resize(this->dimension);
    }
 
    void COOEvaluationSpace::evaluate_constraint_jacobian(const OptimizationProblem& problem, Iterate& iterate) {
-      problem.evaluate_constraint_jacobian(iterate, this->matrix_values.data() + this->number_hessian_nonzeros);
+      problem.evaluate_constraint_jacobian(iterate, this->jacobian_values());
    }
 
    void COOEvaluationSpace::compute_constraint_jacobian_vector_product(const Vector<double>& vector, Vector<double>& result) const {
       result.fill(0.);
-      const size_t offset = this->number_hessian_nonzeros;
+      const double* jacobian_values = this->jacobian_values();
       for (size_t nonzero_index: Range(this->number_jacobian_nonzeros)) {
          const size_t constraint_index = static_cast<size_t>(this->jacobian_row_indices[nonzero_index]);
          const size_t variable_index = static_cast<size_t>(this->jacobian_column_indices[nonzero_index]);
-         const double derivative = this->matrix_values[offset + nonzero_index];
+         const double derivative = jacobian_values[nonzero_index];
 
          if (constraint_index < result.size() && variable_index < vector.size()) {
             result[constraint_index] += derivative * vector[variable_index];
@@ -80,11 +96,11 @@ namespace uno {
 
    void COOEvaluationSpace::compute_constraint_jacobian_transposed_vector_product(const Vector<double>& vector, Vector<double>& result) const {
       result.fill(0.);
-      const size_t offset = this->number_hessian_nonzeros;
+      const double* jacobian_values = this->jacobian_values();
       for (size_t nonzero_index: Range(this->number_jacobian_nonzeros)) {
          const size_t constraint_index = static_cast<size_t>(this->jacobian_row_indices[nonzero_index]);
          const size_t variable_index = static_cast<size_t>(this->jacobian_column_indices[nonzero_index]);
-         const double derivative = this->matrix_values[offset + nonzero_index];
+         const double derivative = jacobian_values[nonzero_index];
 
          if (variable_index < result.size() && constraint_index < vector.size()) {
             result[variable_index] += derivative * vector[constraint_index];
@@ -113,16 +129,92 @@ namespace uno {
             linear_solver.do_symbolic_analysis();
             this->analysis_performed = true;
          }
+         const bool condensed = this->condensation.is_active();
          // assemble the augmented matrix
-         subproblem.assemble_augmented_matrix(statistics, this->matrix_values.data());
+         subproblem.assemble_augmented_matrix(statistics, condensed ? this->augmented_matrix_values.data() :
+            this->matrix_values.data());
+         if (condensed) {
+            this->condensation.condense_matrix(this->augmented_matrix_values, this->matrix_values);
+         }
          // regularize the augmented matrix (this calls the analysis and the factorization)
-         subproblem.regularize_augmented_matrix(statistics, this->matrix_values.data(),
-            subproblem.dual_regularization_factor(), linear_solver);
+         subproblem.regularize_augmented_matrix(statistics, this->matrix_values.data(), this->number_unregularized_nonzeros(),
+            this->condensation.number_condensed_variables(), subproblem.dual_regularization_factor(), linear_solver);
 
          // assemble the RHS
          const COOMatrix jacobian{this->jacobian_row_indices.data(), this->jacobian_column_indices.data(),
-            this->matrix_values.data() + this->number_hessian_nonzeros};
-         subproblem.assemble_augmented_rhs(this->objective_gradient, this->constraints, jacobian, this->rhs);
+            this->jacobian_values()};
+         subproblem.assemble_augmented_rhs(this->objective_gradient, this->constraints, jacobian,
+            condensed ? this->augmented_rhs : this->rhs);
+         if (condensed) {
+            this->condensation.condense_rhs(this->augmented_matrix_values, this->augmented_rhs, this->rhs);
+         }
+      }
+   }
+
+   // residual = rhs - matrix * solution and scaling = |matrix| |solution| + |rhs|. The symmetric matrix is stored as a
+   // triangle (with possible duplicates) in Fortran indexing
+   void COOEvaluationSpace::compute_residual(const Vector<double>& matrix_values, const Vector<double>& rhs,
+         const Vector<double>& solution, Vector<double>& residual, Vector<double>& scaling) const {
+      for (size_t index: Range(rhs.size())) {
+         residual[index] = rhs[index];
+         scaling[index] = std::abs(rhs[index]);
+      }
+      for (size_t nonzero_index: Range(this->matrix_row_indices.size())) {
+         const size_t row_index = static_cast<size_t>(this->matrix_row_indices[nonzero_index] - 1);
+         const size_t column_index = static_cast<size_t>(this->matrix_column_indices[nonzero_index] - 1);
+         const double entry = matrix_values[nonzero_index];
+         residual[row_index] -= entry * solution[column_index];
+         scaling[row_index] += std::abs(entry * solution[column_index]);
+         if (row_index != column_index) {
+            residual[column_index] -= entry * solution[row_index];
+            scaling[column_index] += std::abs(entry * solution[row_index]);
+         }
+      }
+   }
+
+   void COOEvaluationSpace::assemble_primal_dual_direction(const Subproblem& subproblem, Direction& direction) {
+      if (this->condensation.is_active()) {
+         // recover the components of the condensed variables
+         this->condensation.expand_solution(this->augmented_matrix_values, this->augmented_rhs, this->solution,
+            this->augmented_solution);
+         subproblem.assemble_primal_dual_direction(this->augmented_solution, direction);
+      }
+      else {
+         subproblem.assemble_primal_dual_direction(this->solution, direction);
       }
    }
-} // namespace
\ No newline at end of file
+
+   void COOEvaluationSpace::solve_augmented_system(DirectSymmetricIndefiniteLinearSolver<double>& linear_solver,
+         const Vector<double>& augmented_rhs, Vector<double>& augmented_solution) {
+      if (this->condensation.is_active()) {
+         this->condensation.condense_rhs(this->augmented_matrix_values, augmented_rhs, this->rhs);
+         linear_solver.solve_indefinite_system(this->matrix_values, this->rhs, this->solution);
+         this->condensation.expand_solution(this->augmented_matrix_values, augmented_rhs, this->solution, augmented_solution);
+      }
+      else {
+         linear_solver.solve_indefinite_system(this->matrix_values, augmented_rhs, augmented_solution);
+      }
+   }
+
+   size_t COOEvaluationSpace::linear_system_row(size_t augmented_row) const {
+      return this->condensation.is_active() ? this->condensation.condensed_row(augmented_row) : augmented_row;
+   }
+
+   size_t COOEvaluationSpace::number_unregularized_nonzeros() const {
+      return this->condensation.is_active() ? this->condensation.number_unregularized_nonzeros() :
+         this->number_hessian_nonzeros + this->number_jacobian_nonzeros;
+   }
+
+   // protected member functions
+
+   // the Jacobian values are stored in the augmented matrix, after the Hessian values
+   double* COOEvaluationSpace::jacobian_values() {
+      return (this->condensation.is_active() ? this->augmented_matrix_values.data() : this->matrix_values.data()) +
+         this->number_hessian_nonzeros;
+   }
+
+   const double* COOEvaluationSpace::jacobian_values() const {
+      return (this->condensation.is_active() ? this->augmented_matrix_values.data() : this->matrix_values.data()) +
+         this->number_hessian_nonzeros;
+   }
+} // namespace
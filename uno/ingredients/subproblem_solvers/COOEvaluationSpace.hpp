@@ -6,10 +6,14 @@
 
 #include <cstddef>
 #include <vector>
+#include "AugmentedSystemCondensation.hpp"
 #include "linear_algebra/Vector.hpp"
 #include "optimization/EvaluationSpace.hpp"
 
 namespace uno {
+   // forward declaration
+   class Direction;
+
    class COOEvaluationSpace: public EvaluationSpace {
    public:
       COOEvaluationSpace() = default;
@@ -26,6 +30,17 @@ namespace uno {
 
       void set_up_linear_system(Statistics& statistics, const Subproblem& subproblem, DirectSymmetricIndefiniteLinearSolver<double>& linear_solver,
          const WarmstartInformation& warmstart_information);
+      void compute_residual(const Vector<double>& matrix_values, const Vector<double>& rhs, const Vector<double>& solution,
+         Vector<double>& residual, Vector<double>& scaling) const;
+      void assemble_primal_dual_direction(const Subproblem& subproblem, Direction& direction);
+      // solve the last factorized augmented system with another right-hand side (of the dimension of the augmented system)
+      void solve_augmented_system(DirectSymmetricIndefiniteLinearSolver<double>& linear_solver, const Vector<double>& augmented_rhs,
+         Vector<double>& augmented_solution);
+      // row of the linear system of a row of the augmented system (AugmentedSystemCondensation::eliminated if the row
+      // was condensed out)
+      [[nodiscard]] size_t linear_system_row(size_t augmented_row) const;
+      // the regularization entries of the matrix come after its first number_unregularized_nonzeros() entries
+      [[nodiscard]] size_t number_unregularized_nonzeros() const;
 
       Vector<double> objective_gradient{}; /*!< Sparse Jacobian of the objective */
       Vector<double> constraints{}; /*!< Constraint values (size \f$m)\f$ */
@@ -35,7 +50,8 @@ namespace uno {
       std::vector<int> jacobian_row_indices{};
       std::vector<int> jacobian_column_indices{};
 
-      // symmetric matrix (Hessian or augmented system)
+      // symmetric matrix (Hessian or augmented system) passed to the linear solver
+      size_t dimension{};
       size_t number_hessian_nonzeros{};
       size_t number_matrix_nonzeros{};
       std::vector<int> matrix_row_indices{};
@@ -44,6 +60,16 @@ namespace uno {
       Vector<double> rhs{};
       Vector<double> solution{};
       bool analysis_performed{false};
+
+   protected:
+      // augmented system before the elimination of the condensable variables (only used if some variables are condensed)
+      AugmentedSystemCondensation condensation{};
+      Vector<double> augmented_matrix_values{};
+      Vector<double> augmented_rhs{};
+      Vector<double> augmented_solution{};
+
+      [[nodiscard]] double* jacobian_values();
+      [[nodiscard]] const double* jacobian_values() const;
    };
 } // namespace
 
@@ -0,0 +1,254 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <utility>
+#include "DenseLDLFactorization.hpp"
+#include "symbolic/Range.hpp"
+
+namespace uno {
+   void DenseLDLFactorization::resize(size_t dimension) {
+      this->matrix_dimension = dimension;
+      this->factor.resize(dimension * dimension);
+      this->pivots.resize(dimension);
+      this->clear();
+   }
+
+   void DenseLDLFactorization::clear() {
+      std::fill(this->factor.begin(), this->factor.end(), 0.);
+      this->factorization_performed = false;
+   }
+
+   size_t DenseLDLFactorization::dimension() const {
+      return this->matrix_dimension;
+   }
+
+   void DenseLDLFactorization::add(size_t row_index, size_t column_index, double value) {
+      this->entry(std::max(row_index, column_index), std::min(row_index, column_index)) += value;
+   }
+
+   // Bunch-Kaufman pivoting: the 1x1 or 2x2 pivot is chosen to bound the growth of the entries of L
+   void DenseLDLFactorization::factorize() {
+      const size_t n = this->matrix_dimension;
+      this->number_positive_pivots = 0;
+      this->number_negative_pivots = 0;
+      this->number_zero_pivots = 0;
+
+      const double alpha = (1. + std::sqrt(17.)) / 8.;
+      size_t k = 0;
+      while (k < n) {
+         // largest off-diagonal entry in column k
+         const double absakk = std::abs(this->entry(k, k));
+         size_t imax = k;
+         double colmax = 0.;
+         for (size_t row_index: Range(k + 1, n)) {
+            if (colmax < std::abs(this->entry(row_index, k))) {
+               colmax = std::abs(this->entry(row_index, k));
+               imax = row_index;
+            }
+         }
+         if (std::max(absakk, colmax) <= DenseLDLFactorization::zero_pivot_tolerance) {
+            // the column is numerically zero: no elimination
+            for (size_t row_index: Range(k, n)) {
+               this->entry(row_index, k) = 0.;
+            }
+            this->pivots[k] = static_cast<int>(k);
+            ++this->number_zero_pivots;
+            ++k;
+            continue;
+         }
+
+         // pick a 1x1 pivot (k or imax) or a 2x2 pivot (k, imax)
+         size_t pivot_size = 1;
+         size_t kp = k;
+         if (absakk < alpha * colmax) {
+            // largest off-diagonal entry in row/column imax
+            double rowmax = 0.;
+            for (size_t column_index: Range(k, imax)) {
+               rowmax = std::max(rowmax, std::abs(this->entry(imax, column_index)));
+            }
+            for (size_t row_index: Range(imax + 1, n)) {
+               rowmax = std::max(rowmax, std::abs(this->entry(row_index, imax)));
+            }
+            if (alpha * colmax * (colmax / rowmax) <= absakk) {
+               kp = k;
+            }
+            else if (alpha * rowmax <= std::abs(this->entry(imax, imax))) {
+               kp = imax;
+            }
+            else {
+               kp = imax;
+               pivot_size = 2;
+            }
+         }
+
+         // interchange the rows and columns kk and kp of the trailing matrix
+         const size_t kk = k + pivot_size - 1;
+         if (kp != kk) {
+            for (size_t row_index: Range(kp + 1, n)) {
+               std::swap(this->entry(row_index, kk), this->entry(row_index, kp));
+            }
+            for (size_t index: Range(kk + 1, kp)) {
+               std::swap(this->entry(index, kk), this->entry(kp, index));
+            }
+            std::swap(this->entry(kk, kk), this->entry(kp, kp));
+            if (pivot_size == 2) {
+               std::swap(this->entry(k + 1, k), this->entry(kp, k));
+            }
+         }
+
+         if (pivot_size == 1) {
+            // rank-1 update of the trailing matrix and column k of L
+            const double d11 = this->entry(k, k);
+            this->update_inertia_1x1(d11);
+            for (size_t column_index: Range(k + 1, n)) {
+               const double multiplier = this->entry(column_index, k) / d11;
+               for (size_t row_index: Range(column_index, n)) {
+                  this->entry(row_index, column_index) -= this->entry(row_index, k) * multiplier;
+               }
+            }
+            for (size_t row_index: Range(k + 1, n)) {
+               this->entry(row_index, k) /= d11;
+            }
+            this->pivots[k] = static_cast<int>(kp);
+         }
+         else {
+            // rank-2 update of the trailing matrix and columns k and k+1 of L
+            this->update_inertia_2x2(this->entry(k, k), this->entry(k + 1, k), this->entry(k + 1, k + 1));
+            if (k + 2 < n) {
+               double d21 = this->entry(k + 1, k);
+               const double d11 = this->entry(k + 1, k + 1) / d21;
+               const double d22 = this->entry(k, k) / d21;
+               const double t = 1. / (d11 * d22 - 1.);
+               d21 = t / d21;
+               for (size_t column_index: Range(k + 2, n)) {
+                  const double wk = d21 * (d11 * this->entry(column_index, k) - this->entry(column_index, k + 1));
+                  const double wkp1 = d21 * (d22 * this->entry(column_index, k + 1) - this->entry(column_index, k));
+                  for (size_t row_index: Range(column_index, n)) {
+                     this->entry(row_index, column_index) -= this->entry(row_index, k) * wk + this->entry(row_index, k + 1) * wkp1;
+                  }
+                  this->entry(column_index, k) = wk;
+                  this->entry(column_index, k + 1) = wkp1;
+               }
+            }
+            this->pivots[k] = -static_cast<int>(kp + 1);
+            this->pivots[k + 1] = -static_cast<int>(kp + 1);
+         }
+         k += pivot_size;
+      }
+      this->factorization_performed = true;
+   }
+
+   // solve L D L^T P^T x = P^T b with the permutation P stored in the pivots (LAPACK's dsytrs)
+   void DenseLDLFactorization::solve(double* vector) const {
+      assert(this->factorization_performed);
+      const size_t n = this->matrix_dimension;
+
+      // solve L D y = P^T b
+      size_t k = 0;
+      while (k < n) {
+         if (0 <= this->pivots[k]) {
+            const size_t kp = static_cast<size_t>(this->pivots[k]);
+            std::swap(vector[k], vector[kp]);
+            for (size_t row_index: Range(k + 1, n)) {
+               vector[row_index] -= this->entry(row_index, k) * vector[k];
+            }
+            // zero pivot of a singular matrix: pick the zero component
+            const double d11 = this->entry(k, k);
+            vector[k] = (d11 != 0.) ? vector[k] / d11 : 0.;
+            ++k;
+         }
+         else {
+            const size_t kp = static_cast<size_t>(-this->pivots[k] - 1);
+            std::swap(vector[k + 1], vector[kp]);
+            for (size_t row_index: Range(k + 2, n)) {
+               vector[row_index] -= this->entry(row_index, k) * vector[k] + this->entry(row_index, k + 1) * vector[k + 1];
+            }
+            const double d21 = this->entry(k + 1, k);
+            const double d11 = this->entry(k, k) / d21;
+            const double d22 = this->entry(k + 1, k + 1) / d21;
+            const double denominator = d11 * d22 - 1.;
+            const double bk = vector[k] / d21;
+            const double bkp1 = vector[k + 1] / d21;
+            vector[k] = (d22 * bk - bkp1) / denominator;
+            vector[k + 1] = (d11 * bkp1 - bk) / denominator;
+            k += 2;
+         }
+      }
+
+      // solve L^T P^T x = y
+      k = n;
+      while (0 < k) {
+         const size_t index = k - 1;
+         if (0 <= this->pivots[index]) {
+            for (size_t row_index: Range(index + 1, n)) {
+               vector[index] -= this->entry(row_index, index) * vector[row_index];
+            }
+            std::swap(vector[index], vector[static_cast<size_t>(this->pivots[index])]);
+            --k;
+         }
+         else {
+            // 2x2 pivot (index - 1, index)
+            for (size_t row_index: Range(index + 1, n)) {
+               vector[index] -= this->entry(row_index, index) * vector[row_index];
+               vector[index - 1] -= this->entry(row_index, index - 1) * vector[row_index];
+            }
+            std::swap(vector[index], vector[static_cast<size_t>(-this->pivots[index] - 1)]);
+            k -= 2;
+         }
+      }
+   }
+
+   Inertia DenseLDLFactorization::get_inertia() const {
+      return {this->number_positive_pivots, this->number_negative_pivots, this->number_zero_pivots};
+   }
+
+   size_t DenseLDLFactorization::number_negative_eigenvalues() const {
+      return this->number_negative_pivots;
+   }
+
+   size_t DenseLDLFactorization::number_zero_eigenvalues() const {
+      return this->number_zero_pivots;
+   }
+
+   // protected member functions
+
+   double& DenseLDLFactorization::entry(size_t row_index, size_t column_index) {
+      return this->factor[column_index * this->matrix_dimension + row_index];
+   }
+
+   double DenseLDLFactorization::entry(size_t row_index, size_t column_index) const {
+      return this->factor[column_index * this->matrix_dimension + row_index];
+   }
+
+   // by Sylvester's law of inertia, the inertia of the matrix is that of D
+   void DenseLDLFactorization::update_inertia_1x1(double pivot) {
+      if (std::abs(pivot) <= DenseLDLFactorization::zero_pivot_tolerance) {
+         ++this->number_zero_pivots;
+      }
+      else if (0. < pivot) {
+         ++this->number_positive_pivots;
+      }
+      else {
+         ++this->number_negative_pivots;
+      }
+   }
+
+   // the eigenvalues of a 2x2 pivot have opposite signs when its determinant is negative (always the case for a
+   // Bunch-Kaufman 2x2 pivot, up to roundoff)
+   void DenseLDLFactorization::update_inertia_2x2(double d11, double d21, double d22) {
+      const double determinant = d11 * d22 - d21 * d21;
+      if (determinant < 0.) {
+         ++this->number_positive_pivots;
+         ++this->number_negative_pivots;
+      }
+      else if (0. < d11 + d22) {
+         this->number_positive_pivots += 2;
+      }
+      else {
+         this->number_negative_pivots += 2;
+      }
+   }
+} // namespace
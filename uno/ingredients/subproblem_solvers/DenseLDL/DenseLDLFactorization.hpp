@@ -0,0 +1,57 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_DENSELDLFACTORIZATION_H
+#define UNO_DENSELDLFACTORIZATION_H
+
+#include <cstddef>
+#include <vector>
+#include "ingredients/regularization_strategies/Inertia.hpp"
+
+namespace uno {
+   // dense LDL^T factorization with Bunch-Kaufman pivoting (unblocked variant of LAPACK's dsytrf) of a symmetric matrix
+   // whose lower triangle is stored column-major
+   class DenseLDLFactorization {
+   public:
+      DenseLDLFactorization() = default;
+
+      // set the dimension and zero the matrix
+      void resize(size_t dimension);
+      void clear();
+      [[nodiscard]] size_t dimension() const;
+      // add a value to the entry (row_index, column_index), taken in either triangle
+      void add(size_t row_index, size_t column_index, double value);
+
+      // the matrix is overwritten by L and the diagonal blocks of D
+      void factorize();
+      // solve in place, given the right-hand side (of size dimension). The components associated with zero pivots are
+      // set to zero
+      void solve(double* vector) const;
+
+      [[nodiscard]] Inertia get_inertia() const;
+      [[nodiscard]] size_t number_negative_eigenvalues() const;
+      [[nodiscard]] size_t number_zero_eigenvalues() const;
+
+   protected:
+      size_t matrix_dimension{0};
+      // lower triangle of the matrix (column-major), overwritten by L and the diagonal blocks of D
+      std::vector<double> factor{};
+      // pivot of each column: a 1x1 pivot stores the index of the interchanged row, the two columns of a 2x2 pivot
+      // store -(index + 1)
+      std::vector<int> pivots{};
+      size_t number_positive_pivots{0};
+      size_t number_negative_pivots{0};
+      size_t number_zero_pivots{0};
+      bool factorization_performed{false};
+      // pivots below this absolute value are considered zero (MA57's default). A tolerance relative to the largest entry
+      // would flag the pivots of the interior-point systems, whose barrier terms blow up near the solution
+      static constexpr double zero_pivot_tolerance = 1e-20;
+
+      [[nodiscard]] double& entry(size_t row_index, size_t column_index);
+      [[nodiscard]] double entry(size_t row_index, size_t column_index) const;
+      void update_inertia_1x1(double pivot);
+      void update_inertia_2x2(double d11, double d21, double d22);
+   };
+} // namespace
+
+#endif // UNO_DENSELDLFACTORIZATION_H
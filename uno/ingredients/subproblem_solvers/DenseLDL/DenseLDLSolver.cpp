@@ -0,0 +1,90 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include "DenseLDLSolver.hpp"
+#include "ingredients/subproblem/Subproblem.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "optimization/Direction.hpp"
+#include "symbolic/Range.hpp"
+#include "tools/Logger.hpp"
+
+namespace uno {
+   DenseLDLSolver::DenseLDLSolver(const Options& options): DirectSymmetricIndefiniteLinearSolver(options) {
+   }
+
+   void DenseLDLSolver::initialize_hessian(const Subproblem& subproblem) {
+      this->evaluation_space.initialize_hessian(subproblem);
+   }
+
+   void DenseLDLSolver::initialize_augmented_system(const Subproblem& subproblem) {
+      this->evaluation_space.initialize_augmented_system(subproblem);
+   }
+
+   // the dense factorization does not depend on the sparsity pattern: the analysis only allocates the factor
+   void DenseLDLSolver::do_symbolic_analysis() {
+      this->factorization.resize(this->evaluation_space.dimension);
+   }
+
+   void DenseLDLSolver::do_numerical_factorization(const double* matrix_values) {
+      // scatter the COO entries (possibly duplicated) into the dense matrix
+      this->factorization.clear();
+      for (size_t nonzero_index: Range(this->evaluation_space.number_matrix_nonzeros)) {
+         const size_t row_index = static_cast<size_t>(this->evaluation_space.matrix_row_indices[nonzero_index] - 1);
+         const size_t column_index = static_cast<size_t>(this->evaluation_space.matrix_column_indices[nonzero_index] - 1);
+         this->factorization.add(row_index, column_index, matrix_values[nonzero_index]);
+      }
+      this->factorization.factorize();
+      UNO_LOG(DEBUG) << "Dense LDL^T factorization with inertia " << this->get_inertia() << '\n';
+   }
+
+   void DenseLDLSolver::solve_indefinite_system(Statistics& statistics, const Subproblem& subproblem, Direction& direction,
+         const WarmstartInformation& warmstart_information) {
+      // set up the linear system by evaluating the functions at the current iterate
+      this->evaluation_space.set_up_linear_system(statistics, subproblem, *this, warmstart_information);
+      // solve the linear system
+      this->solve_indefinite_system(this->evaluation_space.matrix_values, this->evaluation_space.rhs, this->evaluation_space.solution);
+      this->report_refinement(statistics);
+      // assemble the full primal-dual direction
+      this->evaluation_space.assemble_primal_dual_direction(subproblem, direction);
+      if (this->matrix_is_singular()) {
+         direction.status = SubproblemStatus::INFEASIBLE;
+      }
+   }
+
+   void DenseLDLSolver::solve_augmented_system(const Vector<double>& rhs, Vector<double>& result) {
+      this->evaluation_space.solve_augmented_system(*this, rhs, result);
+   }
+
+   Inertia DenseLDLSolver::get_inertia() const {
+      return this->factorization.get_inertia();
+   }
+
+   size_t DenseLDLSolver::number_negative_eigenvalues() const {
+      return this->factorization.number_negative_eigenvalues();
+   }
+
+   bool DenseLDLSolver::matrix_is_singular() const {
+      return (0 < this->factorization.number_zero_eigenvalues());
+   }
+
+   size_t DenseLDLSolver::rank() const {
+      return this->factorization.dimension() - this->factorization.number_zero_eigenvalues();
+   }
+
+   EvaluationSpace& DenseLDLSolver::get_evaluation_space() {
+      return this->evaluation_space;
+   }
+
+   // private member functions
+
+   void DenseLDLSolver::solve_with_factorization(const Vector<double>& /*matrix_values*/, const Vector<double>& rhs,
+         Vector<double>& result) {
+      result = rhs;
+      this->factorization.solve(result.data());
+   }
+
+   void DenseLDLSolver::compute_residual(const Vector<double>& matrix_values, const Vector<double>& rhs, const Vector<double>& solution,
+         Vector<double>& residual, Vector<double>& scaling) const {
+      this->evaluation_space.compute_residual(matrix_values, rhs, solution, residual, scaling);
+   }
+} // namespace
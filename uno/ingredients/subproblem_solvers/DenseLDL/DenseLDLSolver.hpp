@@ -0,0 +1,52 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_DENSELDLSOLVER_H
+#define UNO_DENSELDLSOLVER_H
+
+#include "DenseLDLFactorization.hpp"
+#include "ingredients/subproblem_solvers/DirectSymmetricIndefiniteLinearSolver.hpp"
+#include "ingredients/subproblem_solvers/COOEvaluationSpace.hpp"
+
+namespace uno {
+   // forward declarations
+   class Options;
+   class Statistics;
+   class Subproblem;
+
+   // dense LDL^T factorization with Bunch-Kaufman pivoting. The matrix is assembled in COO format, then scattered into a
+   // dense array: there is no symbolic analysis. Meant for small systems, for which the setup cost of a sparse solver
+   // dominates
+   class DenseLDLSolver : public DirectSymmetricIndefiniteLinearSolver<double> {
+   public:
+      explicit DenseLDLSolver(const Options& options);
+      ~DenseLDLSolver() override = default;
+
+      void initialize_hessian(const Subproblem& subproblem) override;
+      void initialize_augmented_system(const Subproblem& subproblem) override;
+
+      void do_symbolic_analysis() override;
+      void do_numerical_factorization(const double* matrix_values) override;
+      void solve_indefinite_system(Statistics& statistics, const Subproblem& subproblem, Direction& direction,
+         const WarmstartInformation& warmstart_information) override;
+      using DirectSymmetricIndefiniteLinearSolver<double>::solve_indefinite_system;
+      void solve_augmented_system(const Vector<double>& rhs, Vector<double>& result) override;
+
+      [[nodiscard]] Inertia get_inertia() const override;
+      [[nodiscard]] size_t number_negative_eigenvalues() const override;
+      [[nodiscard]] bool matrix_is_singular() const override;
+      [[nodiscard]] size_t rank() const override;
+
+      [[nodiscard]] EvaluationSpace& get_evaluation_space() override;
+
+   private:
+      COOEvaluationSpace evaluation_space{};
+      DenseLDLFactorization factorization{};
+
+      void solve_with_factorization(const Vector<double>& matrix_values, const Vector<double>& rhs, Vector<double>& result) override;
+      void compute_residual(const Vector<double>& matrix_values, const Vector<double>& rhs, const Vector<double>& solution,
+         Vector<double>& residual, Vector<double>& scaling) const override;
+   };
+} // namespace
+
+#endif // UNO_DENSELDLSOLVER_H
@@ -4,25 +4,183 @@
 #ifndef UNO_DIRECTSYMMETRICINDEFINITELINEARSOLVER_H
 #define UNO_DIRECTSYMMETRICINDEFINITELINEARSOLVER_H
 
+#include <algorithm>
+#include <cmath>
 #include "SymmetricIndefiniteLinearSolver.hpp"
 #include "ingredients/regularization_strategies/Inertia.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "options/Options.hpp"
+#include "tools/Logger.hpp"
+#include "tools/Statistics.hpp"
 
 namespace uno {
+   // direct solvers share a residual-adaptive iterative refinement: the solution is refined only while its componentwise
+   // backward error max_i |b - Kx|_i / (|K||x| + |b|)_i exceeds a tolerance. When the refinement does not converge (a
+   // step does not reduce the backward error sufficiently or the steps are exhausted), the matrix is factorized again in
+   // a higher precision (if it was factorized in a lower precision) or with a tighter pivoting threshold
    template <typename ElementType>
    class DirectSymmetricIndefiniteLinearSolver: public SymmetricIndefiniteLinearSolver<ElementType> {
    public:
-      DirectSymmetricIndefiniteLinearSolver() = default;
+      explicit DirectSymmetricIndefiniteLinearSolver(const Options& options);
       ~DirectSymmetricIndefiniteLinearSolver() override = default;
 
+      void initialize_statistics(Statistics& statistics, const Options& options) override;
+
       virtual void do_symbolic_analysis() = 0;
       virtual void do_numerical_factorization(const double* matrix_values) = 0;
 
+      // solve with the current factorization and refine the solution
+      void solve_indefinite_system(const Vector<double>& matrix_values, const Vector<ElementType>& rhs,
+         Vector<ElementType>& result) override;
+      using SymmetricIndefiniteLinearSolver<ElementType>::solve_indefinite_system;
+
       [[nodiscard]] virtual Inertia get_inertia() const = 0;
       [[nodiscard]] virtual size_t number_negative_eigenvalues() const = 0;
       // [[nodiscard]] virtual bool matrix_is_positive_definite() const = 0;
-      [[nodiscard]] virtual bool matrix_is_singular() const = 0;
       [[nodiscard]] virtual size_t rank() const = 0;
+
+      // outcome of the last solve
+      [[nodiscard]] size_t get_number_refinement_steps() const { return this->number_refinement_steps; }
+      [[nodiscard]] double get_backward_error() const { return this->backward_error; }
+
+   protected:
+      const double refinement_tolerance;
+      const size_t maximum_number_refinement_steps;
+      const double refinement_stall_factor;
+      size_t number_refinement_steps{0};
+      double backward_error{0.};
+      // scratch space for the refinement
+      Vector<ElementType> residual{};
+      Vector<ElementType> residual_scaling{};
+      Vector<ElementType> correction{};
+      Vector<ElementType> previous_solution{};
+      Statistics::ColumnHandle refinement_steps_column{};
+      Statistics::ColumnHandle backward_error_column{};
+
+      // solve with the current factorization only
+      virtual void solve_with_factorization(const Vector<double>& matrix_values, const Vector<ElementType>& rhs,
+         Vector<ElementType>& result) = 0;
+      // residual = rhs - matrix * solution and scaling = |matrix| |solution| + |rhs|
+      virtual void compute_residual(const Vector<double>& matrix_values, const Vector<ElementType>& rhs,
+         const Vector<ElementType>& solution, Vector<ElementType>& residual, Vector<ElementType>& scaling) const = 0;
+      // switch the next factorizations to a higher precision. Returns false if the precision cannot be increased
+      [[nodiscard]] virtual bool increase_precision() { return false; }
+      // tighten the pivoting threshold of the next factorizations. Returns false if it cannot be tightened
+      [[nodiscard]] virtual bool tighten_pivoting() { return false; }
+      // restore the configured pivoting threshold for the next factorizations
+      virtual void restore_pivoting() { }
+
+      void report_refinement(Statistics& statistics) const;
+
+   private:
+      [[nodiscard]] double compute_backward_error(const Vector<double>& matrix_values, const Vector<ElementType>& rhs,
+         const Vector<ElementType>& solution);
    };
+
+   template <typename ElementType>
+   DirectSymmetricIndefiniteLinearSolver<ElementType>::DirectSymmetricIndefiniteLinearSolver(const Options& options):
+         SymmetricIndefiniteLinearSolver<ElementType>(),
+         refinement_tolerance(options.get_double("linear_solver_refinement_tolerance")),
+         maximum_number_refinement_steps(options.get_unsigned_int("linear_solver_max_refinement_steps")),
+         refinement_stall_factor(options.get_double("linear_solver_refinement_stall_factor")) {
+   }
+
+   template <typename ElementType>
+   void DirectSymmetricIndefiniteLinearSolver<ElementType>::initialize_statistics(Statistics& statistics, const Options& options) {
+      if (0 < this->maximum_number_refinement_steps) {
+         this->refinement_steps_column = statistics.add_column("refin", Statistics::int_width - 1, options.get_int("statistics_refinement_steps_column_order"));
+         this->backward_error_column = statistics.add_column("bwd error", Statistics::double_width - 5, options.get_int("statistics_backward_error_column_order"));
+      }
+   }
+
+   template <typename ElementType>
+   void DirectSymmetricIndefiniteLinearSolver<ElementType>::solve_indefinite_system(const Vector<double>& matrix_values,
+         const Vector<ElementType>& rhs, Vector<ElementType>& result) {
+      this->solve_with_factorization(matrix_values, rhs, result);
+      this->number_refinement_steps = 0;
+      if (this->maximum_number_refinement_steps == 0) {
+         return;
+      }
+      // the scratch space is resized only when the dimension changes
+      const size_t dimension = rhs.size();
+      this->residual.resize(dimension);
+      this->residual_scaling.resize(dimension);
+      this->correction.resize(dimension);
+      this->previous_solution.resize(dimension);
+
+      this->backward_error = this->compute_backward_error(matrix_values, rhs, result);
+      bool refactorized = false;
+      size_t number_steps_with_factorization = 0;
+      while (this->refinement_tolerance < this->backward_error) {
+         bool converges = (number_steps_with_factorization < this->maximum_number_refinement_steps);
+         if (converges) {
+            // refinement step: solve K d = b - Kx and update x += d
+            this->previous_solution = result;
+            this->solve_with_factorization(matrix_values, this->residual, this->correction);
+            result += this->correction;
+            ++this->number_refinement_steps;
+            ++number_steps_with_factorization;
+            const double previous_backward_error = this->backward_error;
+            this->backward_error = this->compute_backward_error(matrix_values, rhs, result);
+            DEBUG2 << "Refinement step " << this->number_refinement_steps << ": backward error " << this->backward_error << '\n';
+
+            if (this->refinement_stall_factor * previous_backward_error < this->backward_error) {
+               // the refinement stalls: discard a step that increased the backward error
+               if (previous_backward_error < this->backward_error) {
+                  result = this->previous_solution;
+                  this->backward_error = this->compute_backward_error(matrix_values, rhs, result);
+               }
+               converges = false;
+            }
+         }
+         if (!converges) {
+            // factorize once more in a higher precision or with a tighter pivoting threshold and start afresh
+            if (!refactorized && (this->increase_precision() || this->tighten_pivoting())) {
+               DEBUG << "The iterative refinement did not converge (backward error " << this->backward_error <<
+                  "): refactorizing the matrix\n";
+               this->do_numerical_factorization(matrix_values.data());
+               refactorized = true;
+               number_steps_with_factorization = 0;
+               this->solve_with_factorization(matrix_values, rhs, result);
+               this->backward_error = this->compute_backward_error(matrix_values, rhs, result);
+            }
+            else {
+               break;
+            }
+         }
+      }
+      if (refactorized) {
+         // the tighter threshold only serves the recovery factorization: the current factors remain valid
+         this->restore_pivoting();
+      }
+      if (this->refinement_tolerance < this->backward_error) {
+         DEBUG << "The backward error of the linear solve is " << this->backward_error << " after " <<
+            this->number_refinement_steps << " refinement steps\n";
+      }
+   }
+
+   template <typename ElementType>
+   void DirectSymmetricIndefiniteLinearSolver<ElementType>::report_refinement(Statistics& statistics) const {
+      if (0 < this->maximum_number_refinement_steps) {
+         statistics.set(this->refinement_steps_column, this->number_refinement_steps);
+         statistics.set(this->backward_error_column, this->backward_error);
+      }
+   }
+
+   // componentwise backward error (Oettli-Prager). The residual is kept for the next refinement step
+   template <typename ElementType>
+   double DirectSymmetricIndefiniteLinearSolver<ElementType>::compute_backward_error(const Vector<double>& matrix_values,
+         const Vector<ElementType>& rhs, const Vector<ElementType>& solution) {
+      this->compute_residual(matrix_values, rhs, solution, this->residual, this->residual_scaling);
+      double error = 0.;
+      for (size_t index: Range(rhs.size())) {
+         // a zero scaling implies a zero residual
+         if (0. < this->residual_scaling[index]) {
+            error = std::max(error, static_cast<double>(std::abs(this->residual[index]) / this->residual_scaling[index]));
+         }
+      }
+      return error;
+   }
 } // namespace
 
-#endif // UNO_DIRECTSYMMETRICINDEFINITELINEARSOLVER_H
\ No newline at end of file
+#endif // UNO_DIRECTSYMMETRICINDEFINITELINEARSOLVER_H
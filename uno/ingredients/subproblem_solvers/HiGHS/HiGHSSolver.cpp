@@ -22,6 +22,7 @@ namespace uno {
    void HiGHSSolver::solve(Statistics& statistics, Subproblem& subproblem, const Vector<double>& /*initial_point*/,
          Direction& direction, const WarmstartInformation& warmstart_information) {
       this->set_up_subproblem(statistics, subproblem, warmstart_information);
+      this->update_model(subproblem, warmstart_information);
       this->solve_subproblem(subproblem, direction);
    }
 
@@ -62,13 +63,55 @@ namespace uno {
       }
    }
 
+   // pass the whole model to HiGHS only when the sparsity patterns change. Otherwise, modify the parts of the model that changed
+   // in place: HiGHS keeps its basis (and its factorization when only the bounds or the costs change), and the next solve
+   // typically takes a few dual simplex pivots
+   void HiGHSSolver::update_model(const Subproblem& subproblem, const WarmstartInformation& warmstart_information) {
+      HighsModel& model = this->evaluation_space.model;
+      if (!this->model_passed || warmstart_information.hessian_sparsity_changed || warmstart_information.jacobian_sparsity_changed) {
+         DEBUG2 << "Passing the whole model to HiGHS\n";
+         this->highs_solver.passModel(model);
+         this->model_passed = true;
+         // passModel discards the basis: restore the previous one if the dimensions still match
+         if (this->basis.valid && this->basis.col_status.size() == subproblem.number_variables &&
+               this->basis.row_status.size() == subproblem.number_constraints) {
+            this->highs_solver.setBasis(this->basis);
+         }
+         return;
+      }
+
+      const HighsInt number_variables = static_cast<HighsInt>(subproblem.number_variables);
+      const HighsInt number_constraints = static_cast<HighsInt>(subproblem.number_constraints);
+      // linear part of the objective
+      if (warmstart_information.objective_changed && 0 < number_variables) {
+         this->highs_solver.changeColsCost(0, number_variables - 1, model.lp_.col_cost_.data());
+      }
+      // variable bounds
+      if (warmstart_information.variable_bounds_changed && 0 < number_variables) {
+         this->highs_solver.changeColsBounds(0, number_variables - 1, model.lp_.col_lower_.data(), model.lp_.col_upper_.data());
+      }
+      // constraint bounds
+      if ((warmstart_information.constraint_bounds_changed || warmstart_information.constraints_changed) && 0 < number_constraints) {
+         this->highs_solver.changeRowsBounds(0, number_constraints - 1, model.lp_.row_lower_.data(), model.lp_.row_upper_.data());
+      }
+      // Jacobian coefficients (the sparsity pattern is unchanged)
+      if (warmstart_information.constraints_changed) {
+         for (size_t nonzero_index: Range(model.lp_.a_matrix_.value_.size())) {
+            this->highs_solver.changeCoeff(model.lp_.a_matrix_.index_[nonzero_index],
+               static_cast<HighsInt>(this->evaluation_space.jacobian_column_indices[nonzero_index]),
+               model.lp_.a_matrix_.value_[nonzero_index]);
+         }
+      }
+      // Hessian (the Hessian was reevaluated)
+      if ((warmstart_information.objective_changed || warmstart_information.constraints_changed) && !model.hessian_.value_.empty()) {
+         this->highs_solver.passHessian(model.hessian_);
+      }
+   }
+
    void HiGHSSolver::solve_subproblem(const Subproblem& subproblem, Direction& direction) {
       // solve the subproblem
-      HighsStatus return_status = this->highs_solver.passModel(this->evaluation_space.model);
-      //assert(return_status == HighsStatus::kOk);
-
       DEBUG2 << "Running HiGHS\n";
-      return_status = this->highs_solver.run(); // solve
+      HighsStatus return_status = this->highs_solver.run(); // solve
       DEBUG2 << "Ran HiGHS\n";
       DEBUG << "HiGHS status: " << static_cast<int>(return_status) << '\n';
 
@@ -89,6 +132,11 @@ namespace uno {
       }
       
       direction.status = SubproblemStatus::OPTIMAL;
+      // keep the optimal basis for the next subproblem
+      const HighsBasis& optimal_basis = this->highs_solver.getBasis();
+      if (optimal_basis.valid) {
+         this->basis = optimal_basis;
+      }
       const HighsSolution& solution = this->highs_solver.getSolution();
       // read the primal solution and bound dual solution
       for (size_t variable_index = 0; variable_index < subproblem.number_variables; variable_index++) {
@@ -26,10 +26,15 @@ namespace uno {
    protected:
       Highs highs_solver;
       HiGHSEvaluationSpace evaluation_space;
+      // the model is passed to HiGHS once, then modified incrementally
+      bool model_passed{false};
+      // basis of the previous subproblem, used to warmstart the next one
+      HighsBasis basis{};
 
       const bool print_subproblem;
 
       void set_up_subproblem(Statistics& statistics, const Subproblem& subproblem, const WarmstartInformation& warmstart_information);
+      void update_model(const Subproblem& subproblem, const WarmstartInformation& warmstart_information);
       void solve_subproblem(const Subproblem& subproblem, Direction& direction);
    };
 } // namespace
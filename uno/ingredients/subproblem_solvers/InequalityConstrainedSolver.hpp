@@ -8,6 +8,7 @@ namespace uno {
    // forward declarations
    class Direction;
    class EvaluationSpace;
+   class Options;
    class Statistics;
    class Subproblem;
    template <typename ElementType>
@@ -20,6 +21,7 @@ namespace uno {
       virtual ~InequalityConstrainedSolver() = default;
 
       virtual void initialize_memory(const Subproblem& subproblem) = 0;
+      virtual void initialize_statistics(Statistics& /*statistics*/, const Options& /*options*/) { }
 
       virtual void solve(Statistics& statistics, Subproblem& subproblem, const Vector<double>& initial_point,
          Direction& direction, const WarmstartInformation& warmstart_information) = 0;
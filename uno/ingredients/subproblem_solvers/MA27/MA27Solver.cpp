@@ -111,9 +111,10 @@ namespace uno {
    };
 
 
-   MA27Solver::MA27Solver(): DirectSymmetricIndefiniteLinearSolver() {
+   MA27Solver::MA27Solver(const Options& options): DirectSymmetricIndefiniteLinearSolver(options) {
       // initialization: set the default values of the controlling parameters
       MA27_set_default_parameters(this->workspace.icntl.data(), this->workspace.cntl.data());
+      this->configured_pivoting_threshold = this->workspace.cntl[eCNTL::U];
       // a suitable pivot order is to be chosen automatically
       this->workspace.iflag = 0;
       // suppress warning messages
@@ -126,7 +127,7 @@ namespace uno {
       this->evaluation_space.initialize_hessian(subproblem);
 
       // workspace
-      const size_t dimension = subproblem.number_variables;
+      const size_t dimension = this->evaluation_space.dimension;
       this->workspace.n = static_cast<int>(dimension);
       this->workspace.nnz = static_cast<int>(this->evaluation_space.number_matrix_nonzeros);
       // 20% more than 2*nnz + 3*n + 1
@@ -139,7 +140,7 @@ namespace uno {
       this->evaluation_space.initialize_augmented_system(subproblem);
 
       // workspace
-      const size_t dimension = subproblem.number_variables + subproblem.number_constraints;
+      const size_t dimension = this->evaluation_space.dimension;
       this->workspace.n = static_cast<int>(dimension);
       this->workspace.nnz = static_cast<int>(this->evaluation_space.number_matrix_nonzeros);
       // 20% more than 2*nnz + 3*n + 1
@@ -211,39 +212,24 @@ namespace uno {
       this->factorization_performed = true;
    }
 
-   void MA27Solver::solve_indefinite_system(const Vector<double>& /*matrix_values*/, const Vector<double>& rhs,
-         Vector<double>& result) {
-      assert(this->factorization_performed);
-
-      int la = static_cast<int>(this->workspace.factor.size());
-      int liw = static_cast<int>(this->workspace.iw.size());
-
-      result = rhs;
-
-      MA27_linear_solve(&this->workspace.n, this->workspace.factor.data(), &la, this->workspace.iw.data(), &liw,
-         this->workspace.w.data(), &this->workspace.maxfrt, result.data(), this->workspace.iw1.data(), &this->workspace.nsteps,
-         this->workspace.icntl.data(), this->workspace.info.data());
-
-      assert(this->workspace.info[eINFO::IFLAG] == eIFLAG::SUCCESS && "MA27: the linear solve failed");
-      if (this->workspace.info[eINFO::IFLAG] != eIFLAG::SUCCESS) {
-         WARNING << "MA27 has issued a warning: IFLAG = " << this->workspace.info[eINFO::IFLAG] << " additional info, IERROR = "
-            << this->workspace.info[eINFO::IERROR] << '\n';
-      }
-   }
-
    void MA27Solver::solve_indefinite_system(Statistics& statistics, const Subproblem& subproblem, Direction& direction,
          const WarmstartInformation& warmstart_information) {
       // set up the linear system by evaluating the functions at the current iterate
       this->evaluation_space.set_up_linear_system(statistics, subproblem, *this, warmstart_information);
       // solve the linear system
       this->solve_indefinite_system(this->evaluation_space.matrix_values, this->evaluation_space.rhs, this->evaluation_space.solution);
+      this->report_refinement(statistics);
       // assemble the full primal-dual direction
-      subproblem.assemble_primal_dual_direction(this->evaluation_space.solution, direction);
+      this->evaluation_space.assemble_primal_dual_direction(subproblem, direction);
       if (this->matrix_is_singular()) {
          direction.status = SubproblemStatus::INFEASIBLE;
       }
    }
 
+   void MA27Solver::solve_augmented_system(const Vector<double>& rhs, Vector<double>& result) {
+      this->evaluation_space.solve_augmented_system(*this, rhs, result);
+   }
+
    Inertia MA27Solver::get_inertia() const {
       // rank = number_positive_eigenvalues + number_negative_eigenvalues
       // n = rank + number_zero_eigenvalues
@@ -303,4 +289,43 @@ namespace uno {
             break;
       }
    }
-} // namespace
\ No newline at end of file
+
+   void MA27Solver::solve_with_factorization(const Vector<double>& /*matrix_values*/, const Vector<double>& rhs,
+         Vector<double>& result) {
+      assert(this->factorization_performed);
+
+      int la = static_cast<int>(this->workspace.factor.size());
+      int liw = static_cast<int>(this->workspace.iw.size());
+
+      result = rhs;
+
+      MA27_linear_solve(&this->workspace.n, this->workspace.factor.data(), &la, this->workspace.iw.data(), &liw,
+         this->workspace.w.data(), &this->workspace.maxfrt, result.data(), this->workspace.iw1.data(), &this->workspace.nsteps,
+         this->workspace.icntl.data(), this->workspace.info.data());
+
+      assert(this->workspace.info[eINFO::IFLAG] == eIFLAG::SUCCESS && "MA27: the linear solve failed");
+      if (this->workspace.info[eINFO::IFLAG] != eIFLAG::SUCCESS) {
+         WARNING << "MA27 has issued a warning: IFLAG = " << this->workspace.info[eINFO::IFLAG] << " additional info, IERROR = "
+            << this->workspace.info[eINFO::IERROR] << '\n';
+      }
+   }
+
+   void MA27Solver::compute_residual(const Vector<double>& matrix_values, const Vector<double>& rhs, const Vector<double>& solution,
+         Vector<double>& residual, Vector<double>& scaling) const {
+      this->evaluation_space.compute_residual(matrix_values, rhs, solution, residual, scaling);
+   }
+
+   // CNTL(1) = U: threshold pivoting parameter (default 0.1, at most 0.5)
+   bool MA27Solver::tighten_pivoting() {
+      if (0.5 <= this->workspace.cntl[eCNTL::U]) {
+         return false;
+      }
+      this->workspace.cntl[eCNTL::U] = std::min(0.5, 2. * this->workspace.cntl[eCNTL::U]);
+      DEBUG << "MA27: pivoting threshold increased to " << this->workspace.cntl[eCNTL::U] << '\n';
+      return true;
+   }
+
+   void MA27Solver::restore_pivoting() {
+      this->workspace.cntl[eCNTL::U] = this->configured_pivoting_threshold;
+   }
+} // namespace
@@ -36,7 +36,7 @@ namespace uno {
 
    class MA27Solver: public DirectSymmetricIndefiniteLinearSolver<double> {
    public:
-      MA27Solver();
+      explicit MA27Solver(const Options& options);
       ~MA27Solver() override = default;
 
       void initialize_hessian(const Subproblem& subproblem) override;
@@ -44,9 +44,10 @@ namespace uno {
 
       void do_symbolic_analysis() override;
       void do_numerical_factorization(const double* matrix_values) override;
-      void solve_indefinite_system(const Vector<double>& matrix_values, const Vector<double>& rhs, Vector<double>& result) override;
       void solve_indefinite_system(Statistics& statistics, const Subproblem& subproblem, Direction& direction,
          const WarmstartInformation& warmstart_information) override;
+      using DirectSymmetricIndefiniteLinearSolver<double>::solve_indefinite_system;
+      void solve_augmented_system(const Vector<double>& rhs, Vector<double>& result) override;
 
       [[nodiscard]] Inertia get_inertia() const override;
       [[nodiscard]] size_t number_negative_eigenvalues() const override;
@@ -62,9 +63,15 @@ namespace uno {
 
       bool analysis_performed{false};
       bool factorization_performed{false};
+      double configured_pivoting_threshold{};
 
-      // bool use_iterative_refinement{false}; // Not sure how to do this with ma27
       void check_factorization_status();
+      void solve_with_factorization(const Vector<double>& matrix_values, const Vector<double>& rhs, Vector<double>& result) override;
+      void compute_residual(const Vector<double>& matrix_values, const Vector<double>& rhs, const Vector<double>& solution,
+         Vector<double>& residual, Vector<double>& scaling) const override;
+      [[nodiscard]] bool tighten_pivoting() override;
+      void restore_pivoting() override;
+
    };
 } // namespace
 
@@ -17,7 +17,6 @@
 #define MA57_symbolic_analysis FC_GLOBAL(ma57ad, MA57AD)
 #define MA57_numerical_factorization FC_GLOBAL(ma57bd, MA57BD)
 #define MA57_linear_solve FC_GLOBAL(ma57cd, MA57CD)
-#define MA57_linear_solve_with_iterative_refinement FC_GLOBAL(ma57dd, MA57DD)
 #define MA57_enlarge_workspace FC_GLOBAL(ma57ed, MA57ED)
 
 namespace uno {
@@ -34,10 +33,6 @@ namespace uno {
       void MA57_linear_solve(const int* job, const int* n, double fact[], int* lfact, int ifact[], int* lifact, const int* nrhs,
          double rhs[], const int* lrhs, double work[], int* lwork, int iwork[], int icntl[], int info[]);
 
-      void MA57_linear_solve_with_iterative_refinement(const int* job, const int* n, int* ne, const double a[], const int irn[],
-         const int jcn[], double fact[], int* lfact, int ifact[], int* lifact, const double rhs[], double x[], double resid[],
-         double work[], int iwork[], int icntl[], double cntl[], int info[], double rinfo[]);
-
       // enlarging of workspaces when numerical factorization runs out of memory
       void MA57_enlarge_workspace(const int* n, const int* ic, int keep[], const double fact[], const int* lfact,
          double newfac[], const int* lnew, const int ifact[], const int* lifact, int newifc[], const int* linew,
@@ -74,20 +69,20 @@ namespace uno {
       }
    }  // anonymous namespace
 
-   MA57Solver::MA57Solver(): DirectSymmetricIndefiniteLinearSolver() {
+   MA57Solver::MA57Solver(const Options& options): DirectSymmetricIndefiniteLinearSolver(options) {
       // set the default values of the controlling parameters
       MA57_set_default_parameters(this->workspace.cntl.data(), this->workspace.icntl.data());
+      this->configured_pivoting_threshold = this->workspace.cntl[0];
       // suppress warning messages
       this->workspace.icntl[4] = 0;
-      // iterative refinement enabled
-      this->workspace.icntl[8] = 1;
+      // the iterative refinement is performed by DirectSymmetricIndefiniteLinearSolver
    }
 
    void MA57Solver::initialize_hessian(const Subproblem& subproblem) {
       this->evaluation_space.initialize_hessian(subproblem);
 
       // workspace
-      const size_t dimension = subproblem.number_variables;
+      const size_t dimension = this->evaluation_space.dimension;
       this->workspace.n = static_cast<int>(dimension);
       this->workspace.nnz = static_cast<int>(this->evaluation_space.number_matrix_nonzeros);
       this->workspace.lkeep = static_cast<int>(5 * dimension + this->evaluation_space.number_matrix_nonzeros +
@@ -96,14 +91,13 @@ namespace uno {
       this->workspace.iwork.resize(5 * dimension);
       this->workspace.lwork = static_cast<int>(1.2 * static_cast<double>(dimension));
       this->workspace.work.resize(static_cast<size_t>(this->workspace.lwork));
-      this->workspace.residuals.resize(dimension);
    }
 
    void MA57Solver::initialize_augmented_system(const Subproblem& subproblem) {
       this->evaluation_space.initialize_augmented_system(subproblem);
 
       // workspace
-      const size_t dimension = subproblem.number_variables + subproblem.number_constraints;
+      const size_t dimension = this->evaluation_space.dimension;
       this->workspace.n = static_cast<int>(dimension);
       this->workspace.nnz = static_cast<int>(this->evaluation_space.number_matrix_nonzeros);
       this->workspace.lkeep = static_cast<int>(5 * dimension + this->evaluation_space.number_matrix_nonzeros +
@@ -112,7 +106,6 @@ namespace uno {
       this->workspace.iwork.resize(5 * dimension);
       this->workspace.lwork = static_cast<int>(1.2 * static_cast<double>(dimension));
       this->workspace.work.resize(static_cast<size_t>(this->workspace.lwork));
-      this->workspace.residuals.resize(dimension);
    }
 
    void MA57Solver::do_symbolic_analysis() {
@@ -178,44 +171,24 @@ namespace uno {
       this->factorization_performed = true;
    }
 
-   void MA57Solver::solve_indefinite_system(const Vector<double>& matrix_values, const Vector<double>& rhs, Vector<double>& result) {
-      assert(this->factorization_performed);
-
-      // solve
-      const int lrhs = this->workspace.n; // integer, length of rhs
-
-      // solve the linear system
-      if (this->use_iterative_refinement) {
-         MA57_linear_solve_with_iterative_refinement(&this->workspace.job, &this->workspace.n, &this->workspace.nnz,
-            matrix_values.data(), this->evaluation_space.matrix_row_indices.data(), this->evaluation_space.matrix_column_indices.data(),
-            this->workspace.fact.data(), &this->workspace.lfact, this->workspace.ifact.data(), &this->workspace.lifact,
-            rhs.data(), result.data(), this->workspace.residuals.data(), this->workspace.work.data(), this->workspace.iwork.data(),
-            this->workspace.icntl.data(), this->workspace.cntl.data(), this->workspace.info.data(), this->workspace.rinfo.data());
-      }
-      else {
-         // copy rhs into result (overwritten by MA57)
-         result = rhs;
-
-         MA57_linear_solve(&this->workspace.job, &this->workspace.n, this->workspace.fact.data(), &this->workspace.lfact,
-            this->workspace.ifact.data(), &this->workspace.lifact, &this->workspace.nrhs, result.data(), &lrhs,
-            this->workspace.work.data(), &this->workspace.lwork, this->workspace.iwork.data(), this->workspace.icntl.data(),
-            this->workspace.info.data());
-      }
-   }
-
    void MA57Solver::solve_indefinite_system(Statistics& statistics, const Subproblem& subproblem, Direction& direction,
          const WarmstartInformation& warmstart_information) {
       // set up the linear system by evaluating the functions at the current iterate
       this->evaluation_space.set_up_linear_system(statistics, subproblem, *this, warmstart_information);
       // solve the linear system
       this->solve_indefinite_system(this->evaluation_space.matrix_values, this->evaluation_space.rhs, this->evaluation_space.solution);
+      this->report_refinement(statistics);
       // assemble the full primal-dual direction
-      subproblem.assemble_primal_dual_direction(this->evaluation_space.solution, direction);
+      this->evaluation_space.assemble_primal_dual_direction(subproblem, direction);
       if (this->matrix_is_singular()) {
          direction.status = SubproblemStatus::INFEASIBLE;
       }
    }
 
+   void MA57Solver::solve_augmented_system(const Vector<double>& rhs, Vector<double>& result) {
+      this->evaluation_space.solve_augmented_system(*this, rhs, result);
+   }
+
    Inertia MA57Solver::get_inertia() const {
       // rank = number_positive_eigenvalues + number_negative_eigenvalues
       // n = rank + number_zero_eigenvalues
@@ -248,4 +221,38 @@ namespace uno {
    EvaluationSpace& MA57Solver::get_evaluation_space() {
       return this->evaluation_space;
    }
-} // namespace
\ No newline at end of file
+
+   // private member functions
+
+   void MA57Solver::solve_with_factorization(const Vector<double>& /*matrix_values*/, const Vector<double>& rhs,
+         Vector<double>& result) {
+      assert(this->factorization_performed);
+
+      const int lrhs = this->workspace.n; // integer, length of rhs
+      // copy rhs into result (overwritten by MA57)
+      result = rhs;
+      MA57_linear_solve(&this->workspace.job, &this->workspace.n, this->workspace.fact.data(), &this->workspace.lfact,
+         this->workspace.ifact.data(), &this->workspace.lifact, &this->workspace.nrhs, result.data(), &lrhs,
+         this->workspace.work.data(), &this->workspace.lwork, this->workspace.iwork.data(), this->workspace.icntl.data(),
+         this->workspace.info.data());
+   }
+
+   void MA57Solver::compute_residual(const Vector<double>& matrix_values, const Vector<double>& rhs, const Vector<double>& solution,
+         Vector<double>& residual, Vector<double>& scaling) const {
+      this->evaluation_space.compute_residual(matrix_values, rhs, solution, residual, scaling);
+   }
+
+   // CNTL(1): relative pivot tolerance (default 0.01, at most 0.5)
+   bool MA57Solver::tighten_pivoting() {
+      if (0.5 <= this->workspace.cntl[0]) {
+         return false;
+      }
+      this->workspace.cntl[0] = std::min(0.5, 10. * this->workspace.cntl[0]);
+      DEBUG << "MA57: pivot tolerance increased to " << this->workspace.cntl[0] << '\n';
+      return true;
+   }
+
+   void MA57Solver::restore_pivoting() {
+      this->workspace.cntl[0] = this->configured_pivoting_threshold;
+   }
+} // namespace
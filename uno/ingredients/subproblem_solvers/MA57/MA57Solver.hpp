@@ -11,6 +11,7 @@
 
 namespace uno {
    // forward declarations
+   class Options;
    class Statistics;
    class Subproblem;
 
@@ -36,14 +37,13 @@ namespace uno {
 
       const int nrhs{1}; // number of right hand side being solved
       const int job{1};
-      std::vector<double> residuals;
 
       MA57Workspace() = default;
    };
 
    class MA57Solver : public DirectSymmetricIndefiniteLinearSolver<double> {
    public:
-      MA57Solver();
+      explicit MA57Solver(const Options& options);
       ~MA57Solver() override = default;
 
       void initialize_hessian(const Subproblem& subproblem) override;
@@ -51,9 +51,10 @@ namespace uno {
 
       void do_symbolic_analysis() override;
       void do_numerical_factorization(const double* matrix_values) override;
-      void solve_indefinite_system(const Vector<double>& matrix_values, const Vector<double>& rhs, Vector<double>& result) override;
       void solve_indefinite_system(Statistics& statistics, const Subproblem& subproblem, Direction& direction,
          const WarmstartInformation& warmstart_information) override;
+      using DirectSymmetricIndefiniteLinearSolver<double>::solve_indefinite_system;
+      void solve_augmented_system(const Vector<double>& rhs, Vector<double>& result) override;
 
       [[nodiscard]] Inertia get_inertia() const override;
       [[nodiscard]] size_t number_negative_eigenvalues() const override;
@@ -69,8 +70,13 @@ namespace uno {
 
       bool analysis_performed{false};
       bool factorization_performed{false};
+      double configured_pivoting_threshold{};
 
-      bool use_iterative_refinement{false};
+      void solve_with_factorization(const Vector<double>& matrix_values, const Vector<double>& rhs, Vector<double>& result) override;
+      void compute_residual(const Vector<double>& matrix_values, const Vector<double>& rhs, const Vector<double>& solution,
+         Vector<double>& residual, Vector<double>& scaling) const override;
+      [[nodiscard]] bool tighten_pivoting() override;
+      void restore_pivoting() override;
    };
 } // namespace
 
@@ -0,0 +1,269 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include "MINRESSolver.hpp"
+#include "ingredients/subproblem/Subproblem.hpp"
+#include "linear_algebra/Norm.hpp"
+#include "linear_algebra/SparseVector.hpp"
+#include "optimization/Direction.hpp"
+#include "options/Options.hpp"
+#include "tools/Infinity.hpp"
+#include "tools/Logger.hpp"
+#include "tools/Statistics.hpp"
+
+namespace uno {
+   MINRESSolver::MINRESSolver(const Options& options): SymmetricIndefiniteLinearSolver<double>(),
+         maximum_number_iterations(options.get_unsigned_int("MINRES_max_iterations")),
+         forcing_term_max(options.get_double("MINRES_forcing_term_max")),
+         forcing_term_min(options.get_double("MINRES_forcing_term_min")),
+         curvature_threshold(options.get_double("MINRES_curvature_threshold")) {
+   }
+
+   void MINRESSolver::initialize_hessian(const Subproblem& subproblem) {
+      this->reference_rhs_norm = 0.;
+      this->evaluation_space.initialize_hessian(subproblem);
+      this->allocate_krylov_vectors(subproblem.number_variables);
+   }
+
+   void MINRESSolver::initialize_augmented_system(const Subproblem& subproblem) {
+      this->reference_rhs_norm = 0.;
+      this->evaluation_space.initialize_augmented_system(subproblem);
+      this->allocate_krylov_vectors(subproblem.number_variables + subproblem.number_constraints);
+   }
+
+   void MINRESSolver::initialize_statistics(Statistics& statistics, const Options& options) {
+      this->iterations_column = statistics.add_column("MINRES it", Statistics::int_width + 1, options.get_int("statistics_linear_solver_iterations_column_order"));
+   }
+
+   void MINRESSolver::solve_indefinite_system(const Vector<double>& /*matrix_values*/, const Vector<double>& /*rhs*/,
+         Vector<double>& /*result*/) {
+      throw std::runtime_error("MINRES is matrix free and cannot solve a system given by its matrix values");
+   }
+
+   void MINRESSolver::solve_indefinite_system(Statistics& statistics, const Subproblem& subproblem, Direction& direction,
+         const WarmstartInformation& warmstart_information) {
+      // set up the RHS by evaluating the functions at the current iterate
+      this->evaluation_space.set_up_linear_system(subproblem, warmstart_information);
+
+      // inexact Newton: the forcing term decreases with the residual of the optimality conditions, relative to that of
+      // the first system. It is nonincreasing, since the RHS grows whenever the barrier parameter is decreased. The
+      // residual of MINRES is itself relative to the norm of the RHS
+      const double rhs_norm = norm_2(this->evaluation_space.rhs);
+      if (this->reference_rhs_norm == 0.) {
+         this->reference_rhs_norm = rhs_norm;
+         this->forcing_term = this->forcing_term_max;
+      }
+      if (0. < this->reference_rhs_norm) {
+         this->forcing_term = std::max(this->forcing_term_min, std::min(this->forcing_term, rhs_norm / this->reference_rhs_norm));
+      }
+      this->relative_tolerance = this->forcing_term;
+      DEBUG << "MINRES relative tolerance: " << this->relative_tolerance << '\n';
+
+      // inertia-free regularization: the regularization strategy increases the primal regularization until the direction
+      // has sufficient curvature (see solve_with_sufficient_curvature)
+      this->current_subproblem = &subproblem;
+      this->number_iterations = 0;
+      this->hessian_diagonal_estimated = false;
+      subproblem.regularize_with_curvature_test(statistics, *this);
+      this->current_subproblem = nullptr;
+      statistics.set(this->iterations_column, this->number_iterations);
+
+      // assemble the full primal-dual direction
+      subproblem.assemble_primal_dual_direction(this->evaluation_space.solution, direction);
+      // the system could not be solved, not even to the loosest tolerance: this says nothing about the feasibility of the
+      // subproblem
+      if (this->failure) {
+         WARNING << "MINRES could not reduce the relative residual below " << this->forcing_term_max << '\n';
+         direction.status = SubproblemStatus::ERROR;
+      }
+      else {
+         direction.status = SubproblemStatus::OPTIMAL;
+      }
+   }
+
+   // no factorization is performed: singularity cannot be detected
+   bool MINRESSolver::matrix_is_singular() const {
+      return false;
+   }
+
+   EvaluationSpace& MINRESSolver::get_evaluation_space() {
+      return this->evaluation_space;
+   }
+
+   // protected member functions
+
+   // solve the system with the current primal regularization of the regularization strategy (primal_regularization)
+   bool MINRESSolver::solve_with_sufficient_curvature(double primal_regularization) {
+      assert(this->current_subproblem != nullptr && "MINRESSolver::solve_with_sufficient_curvature: no current subproblem");
+      const Subproblem& subproblem = *this->current_subproblem;
+      // the estimate of the Hessian diagonal is computed once, when the Hessian is not yet regularized
+      if (!this->hessian_diagonal_estimated) {
+         this->evaluation_space.estimate_hessian_diagonal(subproblem);
+         this->hessian_diagonal_estimated = true;
+      }
+      this->number_iterations += this->minres(subproblem, primal_regularization, this->relative_tolerance);
+      if (this->failure) {
+         // an unregularized system that cannot be solved is reported as a solver error, not regularized
+         return (primal_regularization == 0.);
+      }
+      return this->has_sufficient_curvature(subproblem);
+   }
+
+   void MINRESSolver::allocate_krylov_vectors(size_t dimension) {
+      this->preconditioner.resize(dimension);
+      this->v.resize(dimension);
+      this->y.resize(dimension);
+      this->r1.resize(dimension);
+      this->r2.resize(dimension);
+      this->w.resize(dimension);
+      this->w1.resize(dimension);
+      this->w2.resize(dimension);
+      this->residual.resize(dimension);
+   }
+
+   // solve the regularized augmented system with MINRES, starting from 0. The primal regularization primal_shift (already
+   // included in the matrix-vector products) shifts the preconditioner. Return the number of iterations
+   size_t MINRESSolver::minres(const Subproblem& subproblem, double primal_shift, double relative_tolerance) {
+      const Vector<double>& rhs = this->evaluation_space.rhs;
+      Vector<double>& solution = this->evaluation_space.solution;
+      const size_t dimension = rhs.size();
+      solution.fill(0.);
+
+      this->evaluation_space.compute_block_diagonal_preconditioner(subproblem, primal_shift, this->preconditioner);
+
+      // Lanczos process initialized with the RHS
+      this->r1 = rhs;
+      this->r2 = rhs;
+      for (size_t index: Range(dimension)) {
+         this->y[index] = rhs[index] / this->preconditioner[index];
+      }
+      const double beta1 = std::sqrt(dot(this->r1, this->y));
+      this->failure = !std::isfinite(beta1);
+      if (beta1 == 0. || this->failure) {
+         return 0;
+      }
+      // the stopping test is relative to the Euclidean norm of the RHS. MINRES only monitors the residual in the norm
+      // induced by the inverse of the preconditioner: its target is tightened whenever the true residual is too large, as
+      // long as the true residual decreases (it eventually stagnates because of rounding errors)
+      const double rhs_norm = norm_2(rhs);
+      double preconditioned_target = relative_tolerance * beta1;
+      double relative_residual = INF<double>;
+      this->w.fill(0.);
+      this->w2.fill(0.);
+      double previous_beta = 0.;
+      double beta = beta1;
+      double epsilon = 0.;
+      double delta_bar = 0.;
+      double phi_bar = beta1;
+      // Givens rotation
+      double cosine = -1.;
+      double sine = 0.;
+
+      size_t iteration = 0;
+      bool terminate = false;
+      while (!terminate && iteration < this->maximum_number_iterations) {
+         ++iteration;
+         // next Lanczos vector
+         for (size_t index: Range(dimension)) {
+            this->v[index] = this->y[index] / beta;
+         }
+         this->evaluation_space.compute_augmented_matrix_vector_product(subproblem, this->v, this->y);
+         if (2 <= iteration) {
+            for (size_t index: Range(dimension)) {
+               this->y[index] -= (beta / previous_beta) * this->r1[index];
+            }
+         }
+         const double alpha = dot(this->v, this->y);
+         for (size_t index: Range(dimension)) {
+            this->y[index] -= (alpha / beta) * this->r2[index];
+         }
+         std::swap(this->r1, this->r2);
+         this->r2 = this->y;
+         for (size_t index: Range(dimension)) {
+            this->y[index] = this->r2[index] / this->preconditioner[index];
+         }
+         previous_beta = beta;
+         beta = std::sqrt(dot(this->r2, this->y));
+
+         // apply the previous rotation and compute the new one
+         const double previous_epsilon = epsilon;
+         const double delta = cosine * delta_bar + sine * alpha;
+         const double gamma_bar = sine * delta_bar - cosine * alpha;
+         epsilon = sine * beta;
+         delta_bar = -cosine * beta;
+         const double gamma = std::max(std::hypot(gamma_bar, beta), std::numeric_limits<double>::epsilon());
+         cosine = gamma_bar / gamma;
+         sine = beta / gamma;
+         const double phi = cosine * phi_bar;
+         phi_bar = sine * phi_bar;
+
+         // update the search direction and the solution
+         std::swap(this->w1, this->w2);
+         std::swap(this->w2, this->w);
+         for (size_t index: Range(dimension)) {
+            this->w[index] = (this->v[index] - previous_epsilon * this->w1[index] - delta * this->w2[index]) / gamma;
+            solution[index] += phi * this->w[index];
+         }
+
+         // phi_bar is the norm of the residual (in the norm induced by the inverse of the preconditioner)
+         if (!std::isfinite(phi_bar)) {
+            terminate = true;
+         }
+         else if (phi_bar <= preconditioned_target) {
+            const double previous_relative_residual = relative_residual;
+            relative_residual = this->compute_residual_norm(subproblem) / rhs_norm;
+            if (relative_residual <= relative_tolerance || previous_relative_residual <= relative_residual) {
+               terminate = true;
+            }
+            else {
+               preconditioned_target = phi_bar * relative_tolerance / relative_residual;
+            }
+         }
+         // the Krylov subspace is invariant: the solution cannot be improved any further
+         else if (beta <= std::numeric_limits<double>::epsilon() * beta1) {
+            terminate = true;
+         }
+      }
+      if (!terminate || beta <= std::numeric_limits<double>::epsilon() * beta1) {
+         relative_residual = this->compute_residual_norm(subproblem) / rhs_norm;
+      }
+      this->failure = !(relative_residual <= this->forcing_term_max);
+      DEBUG << "MINRES: " << iteration << " iterations, relative residual " << relative_residual << '\n';
+      return iteration;
+   }
+
+   // Euclidean norm of the residual of the (regularized) augmented system at the current solution
+   double MINRESSolver::compute_residual_norm(const Subproblem& subproblem) {
+      this->evaluation_space.compute_augmented_matrix_vector_product(subproblem, this->evaluation_space.solution,
+         this->residual);
+      double squared_norm = 0.;
+      for (size_t index: Range(this->residual.size())) {
+         const double component = this->evaluation_space.rhs[index] - this->residual[index];
+         squared_norm += component * component;
+      }
+      return std::sqrt(squared_norm);
+   }
+
+   // check that d^T (W + delta I) d >= kappa ||d||^2 along the primal direction d
+   bool MINRESSolver::has_sufficient_curvature(const Subproblem& subproblem) {
+      const Vector<double>& solution = this->evaluation_space.solution;
+      this->v.fill(0.);
+      for (size_t variable_index: Range(subproblem.number_variables)) {
+         this->v[variable_index] = solution[variable_index];
+      }
+      this->evaluation_space.compute_augmented_matrix_vector_product(subproblem, this->v, this->y);
+      double curvature = 0.;
+      double squared_norm = 0.;
+      for (size_t variable_index: Range(subproblem.number_variables)) {
+         curvature += this->v[variable_index] * this->y[variable_index];
+         squared_norm += this->v[variable_index] * this->v[variable_index];
+      }
+      DEBUG << "Curvature along the primal direction: " << curvature << '\n';
+      return (this->curvature_threshold * squared_norm <= curvature);
+   }
+} // namespace
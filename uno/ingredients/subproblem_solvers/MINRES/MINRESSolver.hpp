@@ -0,0 +1,76 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_MINRESSOLVER_H
+#define UNO_MINRESSOLVER_H
+
+#include "ingredients/regularization_strategies/CurvatureTest.hpp"
+#include "ingredients/subproblem_solvers/SymmetricIndefiniteLinearSolver.hpp"
+#include "ingredients/subproblem_solvers/MatrixFreeEvaluationSpace.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "tools/Statistics.hpp"
+
+namespace uno {
+   // forward declarations
+   class Options;
+   class Subproblem;
+
+   // matrix-free MINRES method (Paige & Saunders, 1975) for the symmetric indefinite KKT systems, preconditioned with a
+   // block-diagonal SPD matrix.
+   // The systems are solved inexactly: the relative residual tolerance (forcing term) is tied to the norm of the RHS, that is
+   // the residual of the optimality conditions of the outer problem, relative to that of the first system. A system that
+   // cannot be solved to the loosest tolerance is reported as a solver error. Since no inertia is available, the curvature of the
+   // Hessian along the primal direction is tested instead (inertia-free regularization), and the primal regularization is
+   // picked by the regularization strategy of the subproblem
+   class MINRESSolver: public SymmetricIndefiniteLinearSolver<double>, public CurvatureTest {
+   public:
+      explicit MINRESSolver(const Options& options);
+      ~MINRESSolver() override = default;
+
+      void initialize_hessian(const Subproblem& subproblem) override;
+      void initialize_augmented_system(const Subproblem& subproblem) override;
+      void initialize_statistics(Statistics& statistics, const Options& options) override;
+
+      void solve_indefinite_system(const Vector<double>& matrix_values, const Vector<double>& rhs, Vector<double>& result) override;
+      void solve_indefinite_system(Statistics& statistics, const Subproblem& subproblem, Direction& direction,
+         const WarmstartInformation& warmstart_information) override;
+      [[nodiscard]] bool matrix_is_singular() const override;
+
+      [[nodiscard]] EvaluationSpace& get_evaluation_space() override;
+
+   protected:
+      MatrixFreeEvaluationSpace evaluation_space{};
+      const size_t maximum_number_iterations;
+      const double forcing_term_max;
+      const double forcing_term_min;
+      const double curvature_threshold;
+      double reference_rhs_norm{0.};
+      double forcing_term{0.};
+      bool failure{false};
+      // state of the current linear system, for the curvature test
+      const Subproblem* current_subproblem{nullptr};
+      double relative_tolerance{0.};
+      size_t number_iterations{0};
+      bool hessian_diagonal_estimated{false};
+      Statistics::ColumnHandle iterations_column{};
+
+      // Krylov vectors
+      Vector<double> preconditioner{};
+      Vector<double> v{};
+      Vector<double> y{};
+      Vector<double> r1{};
+      Vector<double> r2{};
+      Vector<double> w{};
+      Vector<double> w1{};
+      Vector<double> w2{};
+      Vector<double> residual{};
+
+      void allocate_krylov_vectors(size_t dimension);
+      bool solve_with_sufficient_curvature(double primal_regularization) override;
+      size_t minres(const Subproblem& subproblem, double primal_shift, double relative_tolerance);
+      [[nodiscard]] double compute_residual_norm(const Subproblem& subproblem);
+      [[nodiscard]] bool has_sufficient_curvature(const Subproblem& subproblem);
+   };
+} // namespace
+
+#endif // UNO_MINRESSOLVER_H
@@ -1,129 +1,264 @@
 // Copyright (c) 2024 Charlie Vanaret
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
 #include "MUMPSSolver.hpp"
 #include "ingredients/subproblem/Subproblem.hpp"
 #include "optimization/Direction.hpp"
+#include "options/Options.hpp"
+#include "tools/Logger.hpp"
 #if defined(HAS_MPI) && defined(MUMPS_PARALLEL)
+#include <array>
+#include <map>
 #include "mpi.h"
 #endif
 
 #define USE_COMM_WORLD (-987654)
 
 namespace uno {
-   MUMPSSolver::MUMPSSolver(): DirectSymmetricIndefiniteLinearSolver() {
-      this->workspace.sym = MUMPSSolver::GENERAL_SYMMETRIC;
+   namespace {
+      void call_mumps(DMUMPS_STRUC_C& workspace) {
+         dmumps_c(&workspace);
+      }
+
+#ifdef HAS_SMUMPS
+      void call_mumps(SMUMPS_STRUC_C& workspace) {
+         smumps_c(&workspace);
+      }
+#endif
+
+      template <typename Workspace>
+      void set_control_parameters(Workspace& workspace) {
+         workspace.icntl[0] = -1;
+         workspace.icntl[1] = -1;
+         workspace.icntl[2] = -1;
+         workspace.icntl[3] = 0;
+         workspace.icntl[5] = 0; // no scaling
+         workspace.icntl[7] = 0; // no scaling
+
+         workspace.icntl[12] = 1;
+         workspace.icntl[23] = 1; // ICNTL(24) controls the detection of “null pivot rows”
 #if defined(HAS_MPI) && defined(MUMPS_PARALLEL)
-      // TODO load number of processes from option file
-      this->workspace.par = 1;
-#else
-      this->workspace.par = 1;
+         workspace.icntl[17] = 3; // ICNTL(18) = 3: the entries of the matrix are distributed among the processes
 #endif
-      this->workspace.job = MUMPSSolver::JOB_INIT;
-      this->workspace.comm_fortran = USE_COMM_WORLD;
-      dmumps_c(&this->workspace);
-      // control parameters
-      this->workspace.icntl[0] = -1;
-      this->workspace.icntl[1] = -1;
-      this->workspace.icntl[2] = -1;
-      this->workspace.icntl[3] = 0;
-      this->workspace.icntl[5] = 0; // no scaling
-      this->workspace.icntl[7] = 0; // no scaling
 
-      this->workspace.icntl[12] = 1;
-      this->workspace.icntl[23] = 1; // ICNTL(24) controls the detection of “null pivot rows”
+         /*
+         // debug for MUMPS team
+         workspace.icntl[1] = 6; // ICNTL(2)=6
+         workspace.icntl[2] = 6; // ICNTL(3)=6
+         workspace.icntl[3] = 6; // ICNTL(4)=2
+          */
+      }
+
+      // CNTL(1): relative pivoting threshold (default 0.01 for symmetric matrices, at most 0.5)
+      template <typename Workspace>
+      bool tighten_pivoting_threshold(Workspace& workspace) {
+         if (0.5 <= workspace.cntl[0]) {
+            return false;
+         }
+         workspace.cntl[0] = std::min(0.5, 10. * static_cast<double>(workspace.cntl[0]));
+         DEBUG << "MUMPS: pivoting threshold increased to " << workspace.cntl[0] << '\n';
+         return true;
+      }
 
-      /*
-      // debug for MUMPS team
-      this->workspace.icntl[1] = 6; // ICNTL(2)=6
-      this->workspace.icntl[2] = 6; // ICNTL(3)=6
-      this->workspace.icntl[3] = 6; // ICNTL(4)=2
-       */
+#if defined(HAS_MPI) && defined(MUMPS_PARALLEL)
+      // the host broadcasts a message before each collective call of MUMPS: instance, job, par, number of entries and
+      // precision (1: single, 0: double)
+      using Message = std::array<int, 5>;
+      constexpr int RELEASE_WORKERS = 0; // not a MUMPS job
+      int number_created_instances = 0;
+
+      template <typename RealType>
+      MPI_Datatype mpi_type() {
+         return std::is_same_v<RealType, float> ? MPI_FLOAT : MPI_DOUBLE;
+      }
+
+      // split the entries into contiguous blocks of (almost) equal sizes. The host does not hold entries if it does not
+      // participate in the factorization (par = 0)
+      template <typename RealType>
+      void partition_entries(MUMPSDistributedMatrix<RealType>& matrix, int number_entries, int par) {
+         int number_processes;
+         MPI_Comm_size(MPI_COMM_WORLD, &number_processes);
+         matrix.number_local_entries.resize(static_cast<size_t>(number_processes));
+         matrix.offsets.resize(static_cast<size_t>(number_processes));
+         const int first_working_process = (par == 1 || number_processes == 1) ? 0 : 1;
+         const int number_working_processes = number_processes - first_working_process;
+         int offset = 0;
+         for (int process = 0; process < number_processes; ++process) {
+            int number_local_entries = 0;
+            if (first_working_process <= process) {
+               const int working_process = process - first_working_process;
+               number_local_entries = number_entries / number_working_processes +
+                  (working_process < number_entries % number_working_processes ? 1 : 0);
+            }
+            matrix.number_local_entries[static_cast<size_t>(process)] = number_local_entries;
+            matrix.offsets[static_cast<size_t>(process)] = offset;
+            offset += number_local_entries;
+         }
+      }
+
+      // perform a MUMPS job on all the processes. The sparsity pattern and the values are read on the host only
+      template <typename Workspace>
+      void execute_job(MUMPSInstance<Workspace>& instance, int job, int number_entries, const int* row_indices,
+            const int* column_indices, const typename MUMPSInstance<Workspace>::RealType* matrix_values) {
+         using RealType = typename MUMPSInstance<Workspace>::RealType;
+         Workspace& workspace = instance.workspace;
+         MUMPSDistributedMatrix<RealType>& matrix = instance.distributed_matrix;
+         int rank;
+         MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+         const size_t process = static_cast<size_t>(rank);
+         if (job == 1 || job == 2) {
+            // the control parameters and the out-of-core directory are set on the host
+            MPI_Bcast(workspace.icntl, static_cast<int>(sizeof(workspace.icntl) / sizeof(int)), MPI_INT, 0, MPI_COMM_WORLD);
+            MPI_Bcast(workspace.cntl, static_cast<int>(sizeof(workspace.cntl) / sizeof(RealType)), mpi_type<RealType>(), 0,
+               MPI_COMM_WORLD);
+            MPI_Bcast(workspace.ooc_tmpdir, static_cast<int>(sizeof(workspace.ooc_tmpdir)), MPI_CHAR, 0, MPI_COMM_WORLD);
+         }
+         if (job == 1) { // analysis
+            partition_entries(matrix, number_entries, workspace.par);
+            const int number_local_entries = matrix.number_local_entries[process];
+            matrix.row_indices.resize(static_cast<size_t>(number_local_entries));
+            matrix.column_indices.resize(static_cast<size_t>(number_local_entries));
+            matrix.values.resize(static_cast<size_t>(number_local_entries));
+            MPI_Scatterv(row_indices, matrix.number_local_entries.data(), matrix.offsets.data(), MPI_INT,
+               matrix.row_indices.data(), number_local_entries, MPI_INT, 0, MPI_COMM_WORLD);
+            MPI_Scatterv(column_indices, matrix.number_local_entries.data(), matrix.offsets.data(), MPI_INT,
+               matrix.column_indices.data(), number_local_entries, MPI_INT, 0, MPI_COMM_WORLD);
+            workspace.nnz_loc = number_local_entries;
+            workspace.irn_loc = matrix.row_indices.data();
+            workspace.jcn_loc = matrix.column_indices.data();
+            workspace.a_loc = matrix.values.data();
+         }
+         else if (job == 2) { // factorization
+            MPI_Scatterv(matrix_values, matrix.number_local_entries.data(), matrix.offsets.data(), mpi_type<RealType>(),
+               matrix.values.data(), matrix.number_local_entries[process], mpi_type<RealType>(), 0, MPI_COMM_WORLD);
+         }
+         workspace.job = job;
+         call_mumps(workspace);
+         if (job == 1) {
+            workspace.icntl[7] = 8; // ICNTL(8) = 8: recompute scaling before factorization
+         }
+      }
+#endif
+   } // namespace
+
+   MUMPSSolver::MUMPSSolver(const Options& options): DirectSymmetricIndefiniteLinearSolver(options),
+         use_single_precision(options.get_string("MUMPS_precision") == "single"),
+#if defined(HAS_MPI) && defined(MUMPS_PARALLEL)
+         // the host participates in the factorization and the solve (par = 1) or only distributes the work (par = 0)
+         host_participates(options.get_bool("MUMPS_host_participates") ? 1 : 0),
+#else
+         host_participates(1),
+#endif
+         memory_budget(options.get_unsigned_int("MUMPS_memory_budget")),
+         out_of_core_directory(options.get_string("MUMPS_out_of_core_directory")) {
+      const std::string& precision = options.get_string("MUMPS_precision");
+      if (precision != "single" && precision != "double") {
+         throw std::invalid_argument("The MUMPS precision " + precision + " is unknown");
+      }
+      // directory of the factor files in out-of-core mode (default: MUMPS_OOC_TMPDIR environment variable or /tmp)
+      if (sizeof(this->double_precision.workspace.ooc_tmpdir) <= this->out_of_core_directory.size()) {
+         throw std::invalid_argument("The MUMPS out-of-core directory " + this->out_of_core_directory + " is too long");
+      }
+      if (this->use_single_precision) {
+#ifdef HAS_SMUMPS
+         this->initialize_instance(this->single_precision);
+#else
+         throw std::invalid_argument("Uno was not compiled with the single-precision MUMPS library (libsmumps)");
+#endif
+      }
+      else {
+         this->initialize_instance(this->double_precision);
+      }
    }
 
    MUMPSSolver::~MUMPSSolver() {
-      this->workspace.job = MUMPSSolver::JOB_END;
-      dmumps_c(&this->workspace);
+      this->terminate_instance(this->double_precision);
+#ifdef HAS_SMUMPS
+      this->terminate_instance(this->single_precision);
+#endif
    }
 
    void MUMPSSolver::initialize_hessian(const Subproblem& subproblem) {
       this->evaluation_space.initialize_hessian(subproblem);
-
-      // workspace*
-      const size_t dimension = subproblem.number_variables;
-      this->workspace.n = static_cast<int>(dimension);
-      this->workspace.nnz = static_cast<int>(this->evaluation_space.number_matrix_nonzeros);
+      this->dimension = this->evaluation_space.dimension;
+      this->number_nonzeros = this->evaluation_space.number_matrix_nonzeros;
    }
 
    void MUMPSSolver::initialize_augmented_system(const Subproblem& subproblem) {
       this->evaluation_space.initialize_augmented_system(subproblem);
-
-      // workspace
-      const size_t dimension = subproblem.number_variables + subproblem.number_constraints;
-      this->workspace.n = static_cast<int>(dimension);
-      this->workspace.nnz = static_cast<int>(this->evaluation_space.number_matrix_nonzeros);
+      this->dimension = this->evaluation_space.dimension;
+      this->number_nonzeros = this->evaluation_space.number_matrix_nonzeros;
    }
 
    void MUMPSSolver::do_symbolic_analysis() {
-      assert(!this->analysis_performed);
-
-      this->workspace.job = MUMPSSolver::JOB_ANALYSIS;
-      // connect the local sparsity with the pointers in the workspace
-      this->workspace.irn = this->evaluation_space.matrix_row_indices.data();
-      this->workspace.jcn = this->evaluation_space.matrix_column_indices.data();
-      dmumps_c(&this->workspace);
-      this->workspace.icntl[7] = 8; // ICNTL(8) = 8: recompute scaling before factorization
-      this->analysis_performed = true;
+#ifdef HAS_SMUMPS
+      if (this->use_single_precision) {
+         this->analyze(this->single_precision);
+         return;
+      }
+#endif
+      this->analyze(this->double_precision);
    }
 
    void MUMPSSolver::do_numerical_factorization(const double* matrix_values) {
-      assert(this->analysis_performed);
-
-      this->workspace.job = MUMPSSolver::JOB_FACTORIZATION;
-      this->workspace.a = const_cast<double*>(matrix_values);
-      dmumps_c(&this->workspace);
+#ifdef HAS_SMUMPS
+      if (this->use_single_precision) {
+         assert(this->single_precision.analysis_performed);
+         this->single_precision_matrix_values.resize(this->number_nonzeros);
+         std::copy_n(matrix_values, this->number_nonzeros, this->single_precision_matrix_values.begin());
+         this->execute(this->single_precision, MUMPSSolver::JOB_FACTORIZATION, this->single_precision_matrix_values.data());
+         this->check_error(this->single_precision.workspace, "factorization");
+         this->factorization_performed = true;
+         return;
+      }
+#endif
+      assert(this->double_precision.analysis_performed);
+      this->execute(this->double_precision, MUMPSSolver::JOB_FACTORIZATION, matrix_values);
+      this->check_error(this->double_precision.workspace, "factorization");
       this->factorization_performed = true;
    }
 
-   void MUMPSSolver::solve_indefinite_system(const Vector<double>& /*matrix_values*/, const Vector<double>& rhs, Vector<double>& result) {
-      assert(this->factorization_performed);
-
-      result = rhs;
-      this->workspace.rhs = result.data();
-      this->workspace.job = MUMPSSolver::JOB_SOLVE;
-      dmumps_c(&this->workspace);
-   }
-
    void MUMPSSolver::solve_indefinite_system(Statistics& statistics, const Subproblem& subproblem, Direction& direction,
          const WarmstartInformation& warmstart_information) {
       // set up the linear system by evaluating the functions at the current iterate
       this->evaluation_space.set_up_linear_system(statistics, subproblem, *this, warmstart_information);
       // solve the linear system
       this->solve_indefinite_system(this->evaluation_space.matrix_values, this->evaluation_space.rhs, this->evaluation_space.solution);
+      this->report_refinement(statistics);
       // assemble the full primal-dual direction
-      subproblem.assemble_primal_dual_direction(this->evaluation_space.solution, direction);
+      this->evaluation_space.assemble_primal_dual_direction(subproblem, direction);
       if (this->matrix_is_singular()) {
          direction.status = SubproblemStatus::INFEASIBLE;
       }
    }
 
+   void MUMPSSolver::solve_augmented_system(const Vector<double>& rhs, Vector<double>& result) {
+      this->evaluation_space.solve_augmented_system(*this, rhs, result);
+   }
+
    Inertia MUMPSSolver::get_inertia() const {
       // rank = number_positive_eigenvalues + number_negative_eigenvalues
       // n = rank + number_zero_eigenvalues
       const size_t number_negative_eigenvalues = this->number_negative_eigenvalues();
       const size_t number_zero_eigenvalues = this->number_zero_eigenvalues();
-      const size_t number_positive_eigenvalues = static_cast<size_t>(this->workspace.n) - (number_negative_eigenvalues + number_zero_eigenvalues);
+      const size_t number_positive_eigenvalues = this->dimension - (number_negative_eigenvalues + number_zero_eigenvalues);
       return {number_positive_eigenvalues, number_negative_eigenvalues, number_zero_eigenvalues};
    }
 
    size_t MUMPSSolver::number_negative_eigenvalues() const {
       // INFOG(12)
-      return static_cast<size_t>(this->workspace.infog[11]);
+      return static_cast<size_t>(this->global_information()[11]);
    }
 
    size_t MUMPSSolver::number_zero_eigenvalues() const {
       // INFOG(28)
-      return static_cast<size_t>(this->workspace.infog[27]);
+      return static_cast<size_t>(this->global_information()[27]);
    }
 
    bool MUMPSSolver::matrix_is_singular() const {
@@ -131,10 +266,247 @@ namespace uno {
    }
 
    size_t MUMPSSolver::rank() const {
-      return this->workspace.n - this->number_zero_eigenvalues();
+      return this->dimension - this->number_zero_eigenvalues();
    }
 
    EvaluationSpace& MUMPSSolver::get_evaluation_space() {
       return this->evaluation_space;
    }
-} // namespace
\ No newline at end of file
+
+#if defined(HAS_MPI) && defined(MUMPS_PARALLEL)
+   void MUMPSSolver::run_worker_loop() {
+      // MUMPS instances created on the host, indexed by their identifiers
+      std::map<int, MUMPSInstance<DMUMPS_STRUC_C>> double_precision_instances{};
+   #ifdef HAS_SMUMPS
+      std::map<int, MUMPSInstance<SMUMPS_STRUC_C>> single_precision_instances{};
+   #endif
+      // perform the job of the message on a worker process
+      Message message{};
+      const auto work = [&message](auto& instances) {
+         const auto [instance_identifier, job, par, number_entries, precision] = message;
+         auto& instance = instances[instance_identifier];
+         if (job == MUMPSSolver::JOB_INIT) {
+            instance.workspace.sym = MUMPSSolver::GENERAL_SYMMETRIC;
+            instance.workspace.par = par;
+            instance.workspace.comm_fortran = USE_COMM_WORLD;
+         }
+         execute_job(instance, job, number_entries, nullptr, nullptr, nullptr);
+         if (job == MUMPSSolver::JOB_INIT) {
+            set_control_parameters(instance.workspace);
+         }
+         else if (job == MUMPSSolver::JOB_END) {
+            instances.erase(instance_identifier);
+         }
+      };
+      while (true) {
+         MPI_Bcast(message.data(), static_cast<int>(message.size()), MPI_INT, 0, MPI_COMM_WORLD);
+         if (message[1] == RELEASE_WORKERS) {
+            return;
+         }
+   #ifdef HAS_SMUMPS
+         if (message[4] == 1) {
+            work(single_precision_instances);
+            continue;
+         }
+   #endif
+         assert(message[4] == 0 && "MUMPSSolver: the single-precision MUMPS library is not available");
+         work(double_precision_instances);
+      }
+   }
+
+   void MUMPSSolver::release_workers() {
+      Message message{0, RELEASE_WORKERS, 0, 0, 0};
+      MPI_Bcast(message.data(), static_cast<int>(message.size()), MPI_INT, 0, MPI_COMM_WORLD);
+   }
+#endif
+
+   // protected member functions
+
+   void MUMPSSolver::solve_with_factorization(const Vector<double>& /*matrix_values*/, const Vector<double>& rhs,
+         Vector<double>& result) {
+      assert(this->factorization_performed);
+
+      // the right-hand side and the solution are centralized on the host
+#ifdef HAS_SMUMPS
+      if (this->use_single_precision) {
+         this->single_precision_solution.resize(this->dimension);
+         std::copy_n(rhs.data(), this->dimension, this->single_precision_solution.begin());
+         this->single_precision.workspace.rhs = this->single_precision_solution.data();
+         this->execute(this->single_precision, MUMPSSolver::JOB_SOLVE, nullptr);
+         std::copy_n(this->single_precision_solution.data(), this->dimension, result.data());
+         return;
+      }
+#endif
+      result = rhs;
+      this->double_precision.workspace.rhs = result.data();
+      this->execute(this->double_precision, MUMPSSolver::JOB_SOLVE, nullptr);
+   }
+
+   void MUMPSSolver::compute_residual(const Vector<double>& matrix_values, const Vector<double>& rhs, const Vector<double>& solution,
+         Vector<double>& residual, Vector<double>& scaling) const {
+      this->evaluation_space.compute_residual(matrix_values, rhs, solution, residual, scaling);
+   }
+
+   // fall back to a double-precision factorization for the rest of the optimization. The single-precision instance is
+   // released
+   bool MUMPSSolver::increase_precision() {
+#ifdef HAS_SMUMPS
+      if (!this->use_single_precision) {
+         return false;
+      }
+      WARNING << "MUMPS: the refinement of the single-precision solution does not converge. The matrix is now factorized " <<
+         "in double precision\n";
+      this->use_single_precision = false;
+      this->terminate_instance(this->single_precision);
+      this->initialize_instance(this->double_precision);
+      this->analyze(this->double_precision);
+      return true;
+#else
+      return false;
+#endif
+   }
+
+   bool MUMPSSolver::tighten_pivoting() {
+#ifdef HAS_SMUMPS
+      if (this->use_single_precision) {
+         return tighten_pivoting_threshold(this->single_precision.workspace);
+      }
+#endif
+      return tighten_pivoting_threshold(this->double_precision.workspace);
+   }
+
+   void MUMPSSolver::restore_pivoting() {
+#ifdef HAS_SMUMPS
+      if (this->use_single_precision) {
+         this->single_precision.workspace.cntl[0] = this->single_precision.configured_pivoting_threshold;
+         return;
+      }
+#endif
+      this->double_precision.workspace.cntl[0] = this->double_precision.configured_pivoting_threshold;
+   }
+
+   const int* MUMPSSolver::global_information() const {
+#ifdef HAS_SMUMPS
+      if (this->use_single_precision) {
+         return this->single_precision.workspace.infog;
+      }
+#endif
+      return this->double_precision.workspace.infog;
+   }
+
+   template <typename Workspace>
+   void MUMPSSolver::initialize_instance(MUMPSInstance<Workspace>& instance) {
+      if (instance.initialized) {
+         return;
+      }
+      instance.workspace.sym = MUMPSSolver::GENERAL_SYMMETRIC;
+      instance.workspace.par = this->host_participates;
+      instance.workspace.comm_fortran = USE_COMM_WORLD;
+#if defined(HAS_MPI) && defined(MUMPS_PARALLEL)
+      instance.identifier = ++number_created_instances;
+#endif
+      this->execute(instance, MUMPSSolver::JOB_INIT, nullptr);
+      // control parameters
+      set_control_parameters(instance.workspace);
+      instance.configured_pivoting_threshold = instance.workspace.cntl[0];
+      std::strncpy(instance.workspace.ooc_tmpdir, this->out_of_core_directory.c_str(), sizeof(instance.workspace.ooc_tmpdir));
+      instance.initialized = true;
+   }
+
+   template <typename Workspace>
+   void MUMPSSolver::terminate_instance(MUMPSInstance<Workspace>& instance) {
+      if (instance.initialized) {
+         this->execute(instance, MUMPSSolver::JOB_END, nullptr);
+         instance.initialized = false;
+         instance.analysis_performed = false;
+      }
+   }
+
+   template <typename Workspace>
+   void MUMPSSolver::analyze(MUMPSInstance<Workspace>& instance) {
+      assert(!instance.analysis_performed);
+
+      instance.workspace.n = static_cast<int>(this->dimension);
+      instance.workspace.nnz = static_cast<MUMPS_INT8>(this->number_nonzeros);
+      this->execute(instance, MUMPSSolver::JOB_ANALYSIS, nullptr);
+      this->check_error(instance.workspace, "analysis");
+      this->set_memory_parameters(instance.workspace);
+      instance.analysis_performed = true;
+   }
+
+   template <typename Workspace>
+   void MUMPSSolver::execute(MUMPSInstance<Workspace>& instance, int job,
+         const typename MUMPSInstance<Workspace>::RealType* matrix_values) {
+#if defined(HAS_MPI) && defined(MUMPS_PARALLEL)
+      // the entries are distributed with MPI, whose counts are int
+      if (static_cast<MUMPS_INT8>(std::numeric_limits<int>::max()) < instance.workspace.nnz) {
+         throw std::overflow_error("MUMPSSolver: the number of nonzeros exceeds the capacity of the distributed matrix");
+      }
+      const int number_entries = static_cast<int>(instance.workspace.nnz);
+      // broadcast the job to the worker processes, then perform it on all the processes
+      Message message{instance.identifier, job, instance.workspace.par, number_entries,
+         MUMPSInstance<Workspace>::single_precision ? 1 : 0};
+      MPI_Bcast(message.data(), static_cast<int>(message.size()), MPI_INT, 0, MPI_COMM_WORLD);
+      execute_job(instance, job, number_entries, this->evaluation_space.matrix_row_indices.data(),
+         this->evaluation_space.matrix_column_indices.data(), matrix_values);
+#else
+      Workspace& workspace = instance.workspace;
+      workspace.job = job;
+      if (job == MUMPSSolver::JOB_ANALYSIS) {
+         // connect the local sparsity with the pointers in the workspace
+         workspace.irn = this->evaluation_space.matrix_row_indices.data();
+         workspace.jcn = this->evaluation_space.matrix_column_indices.data();
+      }
+      else if (job == MUMPSSolver::JOB_FACTORIZATION) {
+         workspace.a = const_cast<typename MUMPSInstance<Workspace>::RealType*>(matrix_values);
+      }
+      call_mumps(workspace);
+      if (job == MUMPSSolver::JOB_ANALYSIS) {
+         workspace.icntl[7] = 8; // ICNTL(8) = 8: recompute scaling before factorization
+      }
+#endif
+   }
+
+   // with a memory budget, the factorization is performed out of core if the in-core estimate of the analysis exceeds
+   // the budget. The remaining memory is given to MUMPS as workspace relaxation, so that the factorization does not run
+   // out of workspace
+   template <typename Workspace>
+   void MUMPSSolver::set_memory_parameters(Workspace& workspace) const {
+      if (this->memory_budget == 0) {
+         return;
+      }
+      // INFOG(16) and INFOG(26): estimated memory (MB, maximum over the processes) of the in-core and out-of-core
+      // factorizations, computed with the relaxation percentage ICNTL(14)
+      const double relaxation_factor = 1. + static_cast<double>(workspace.icntl[13]) / 100.;
+      const double in_core_estimate = static_cast<double>(std::max(1, workspace.infog[15])) / relaxation_factor;
+      const double out_of_core_estimate = static_cast<double>(std::max(1, workspace.infog[25])) / relaxation_factor;
+      const double budget = static_cast<double>(this->memory_budget);
+      const bool out_of_core = (budget < in_core_estimate);
+      const double estimate = out_of_core ? out_of_core_estimate : in_core_estimate;
+      if (budget < estimate) {
+         WARNING << "MUMPS: the memory budget (" << this->memory_budget << " MB) is below the estimated memory of the " <<
+            "out-of-core factorization (" << estimate << " MB)\n";
+      }
+      workspace.icntl[21] = out_of_core ? 1 : 0; // ICNTL(22): in-core (0) or out-of-core (1) factorization
+      workspace.icntl[22] = static_cast<int>(this->memory_budget); // ICNTL(23): maximum memory (MB) per process
+      workspace.icntl[13] = static_cast<int>(std::max(0., std::floor(100. * (budget / estimate - 1.)))); // ICNTL(14)
+      DEBUG << "MUMPS: " << (out_of_core ? "out-of-core" : "in-core") << " factorization with " << workspace.icntl[13] <<
+         "% workspace relaxation\n";
+   }
+
+   // INFOG(1) < 0 signals an error on one of the processes
+   template <typename Workspace>
+   void MUMPSSolver::check_error(const Workspace& workspace, const std::string& phase) const {
+      const int error = workspace.infog[0];
+      if (error < 0) {
+         std::string message = "MUMPS: the " + phase + " failed with INFOG(1) = " + std::to_string(error) +
+            " and INFOG(2) = " + std::to_string(workspace.infog[1]);
+         // -8, -9, -11, -13, -14, -15, -17, -19, -20: insufficient workspace or memory
+         if (error == -8 || error == -9 || error == -11 || error == -13 || error == -14 || error == -15 ||
+               error == -17 || error == -19 || error == -20) {
+            message += ". The factorization ran out of memory: increase the option MUMPS_memory_budget";
+         }
+         throw std::runtime_error(message);
+      }
+   }
+} // namespace
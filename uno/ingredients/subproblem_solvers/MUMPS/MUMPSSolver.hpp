@@ -4,15 +4,57 @@
 #ifndef UNO_MUMPSSOLVER_H
 #define UNO_MUMPSSOLVER_H
 
+#include <string>
+#include <type_traits>
+#include <vector>
 #include "../DirectSymmetricIndefiniteLinearSolver.hpp"
 #include "dmumps_c.h"
+#ifdef HAS_SMUMPS
+#include "smumps_c.h"
+#endif
 #include "../COOEvaluationSpace.hpp"
 #include "linear_algebra/Vector.hpp"
 
 namespace uno {
+   // forward declaration
+   class Options;
+
+#if defined(HAS_MPI) && defined(MUMPS_PARALLEL)
+   // entries of the matrix held by the current process (distributed assembled format, ICNTL(18) = 3)
+   template <typename RealType>
+   struct MUMPSDistributedMatrix {
+      // partition of the entries among the processes
+      std::vector<int> number_local_entries{};
+      std::vector<int> offsets{};
+      std::vector<int> row_indices{};
+      std::vector<int> column_indices{};
+      std::vector<RealType> values{};
+   };
+#endif
+
+   // MUMPS instance in double (DMUMPS_STRUC_C) or single (SMUMPS_STRUC_C) precision
+   template <typename Workspace>
+   struct MUMPSInstance {
+      using RealType = std::remove_pointer_t<decltype(Workspace::a)>;
+      static constexpr bool single_precision = std::is_same_v<RealType, float>;
+
+      Workspace workspace{};
+      bool initialized{false};
+      bool analysis_performed{false};
+      // CNTL(1) set at the initialization of the instance
+      RealType configured_pivoting_threshold{};
+#if defined(HAS_MPI) && defined(MUMPS_PARALLEL)
+      int identifier{0};
+      MUMPSDistributedMatrix<RealType> distributed_matrix{};
+#endif
+   };
+
+   // with an MPI build of MUMPS, the optimizer runs on the host (rank 0) only. The other processes call
+   // MUMPSSolver::run_worker_loop() and join the analysis, factorization and solve phases of every MUMPS instance
+   // created on the host, until the host calls MUMPSSolver::release_workers()
    class MUMPSSolver : public DirectSymmetricIndefiniteLinearSolver<double> {
    public:
-      MUMPSSolver();
+      explicit MUMPSSolver(const Options& options);
       ~MUMPSSolver() override;
 
       void initialize_hessian(const Subproblem& subproblem) override;
@@ -20,9 +62,10 @@ namespace uno {
 
       void do_symbolic_analysis() override;
       void do_numerical_factorization(const double* matrix_values) override;
-      void solve_indefinite_system(const Vector<double>& matrix_values, const Vector<double>& rhs, Vector<double>& result) override;
       void solve_indefinite_system(Statistics& statistics, const Subproblem& subproblem, Direction& direction,
          const WarmstartInformation& warmstart_information) override;
+      using DirectSymmetricIndefiniteLinearSolver<double>::solve_indefinite_system;
+      void solve_augmented_system(const Vector<double>& rhs, Vector<double>& result) override;
 
       [[nodiscard]] Inertia get_inertia() const override;
       [[nodiscard]] size_t number_negative_eigenvalues() const override;
@@ -33,9 +76,30 @@ namespace uno {
 
       [[nodiscard]] EvaluationSpace& get_evaluation_space() override;
 
+#if defined(HAS_MPI) && defined(MUMPS_PARALLEL)
+      // processes other than the host
+      static void run_worker_loop();
+      // host
+      static void release_workers();
+#endif
+
    protected:
-      DMUMPS_STRUC_C workspace{};
       COOEvaluationSpace evaluation_space{};
+      MUMPSInstance<DMUMPS_STRUC_C> double_precision{};
+#ifdef HAS_SMUMPS
+      // with the option MUMPS_precision = single, the matrix is factorized in single precision and the solution is
+      // refined in double precision. The factorization switches to double precision when the refinement does not converge
+      MUMPSInstance<SMUMPS_STRUC_C> single_precision{};
+      // scratch space for the single-precision factorization and solve
+      std::vector<float> single_precision_matrix_values{};
+      std::vector<float> single_precision_solution{};
+#endif
+      bool use_single_precision;
+      const int host_participates; // PAR
+      const size_t memory_budget; // MB per process (0: no budget)
+      const std::string out_of_core_directory;
+      size_t dimension{0};
+      size_t number_nonzeros{0};
 
       static const int JOB_INIT = -1;
       static const int JOB_END = -2;
@@ -45,8 +109,29 @@ namespace uno {
 
       static const int GENERAL_SYMMETRIC = 2;
 
-      bool analysis_performed{false};
       bool factorization_performed{false};
+
+      void solve_with_factorization(const Vector<double>& matrix_values, const Vector<double>& rhs, Vector<double>& result) override;
+      void compute_residual(const Vector<double>& matrix_values, const Vector<double>& rhs, const Vector<double>& solution,
+         Vector<double>& residual, Vector<double>& scaling) const override;
+      [[nodiscard]] bool increase_precision() override;
+      [[nodiscard]] bool tighten_pivoting() override;
+      void restore_pivoting() override;
+      // INFOG array of the instance that performs the factorizations
+      [[nodiscard]] const int* global_information() const;
+
+      template <typename Workspace>
+      void initialize_instance(MUMPSInstance<Workspace>& instance);
+      template <typename Workspace>
+      void terminate_instance(MUMPSInstance<Workspace>& instance);
+      template <typename Workspace>
+      void analyze(MUMPSInstance<Workspace>& instance);
+      template <typename Workspace>
+      void execute(MUMPSInstance<Workspace>& instance, int job, const typename MUMPSInstance<Workspace>::RealType* matrix_values);
+      template <typename Workspace>
+      void set_memory_parameters(Workspace& workspace) const;
+      template <typename Workspace>
+      void check_error(const Workspace& workspace, const std::string& phase) const;
    };
 } // namespace
 
@@ -0,0 +1,188 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include "MatrixFreeEvaluationSpace.hpp"
+#include "ingredients/subproblem/Subproblem.hpp"
+#include "linear_algebra/COOMatrix.hpp"
+#include "linear_algebra/Indexing.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "optimization/WarmstartInformation.hpp"
+
+namespace uno {
+   void MatrixFreeEvaluationSpace::initialize_hessian(const Subproblem& subproblem) {
+      if (!subproblem.has_hessian_operator()) {
+         throw std::runtime_error("The subproblem does not have a Hessian operator and cannot be solved with an iterative linear solver");
+      }
+      this->number_variables = subproblem.number_variables;
+      this->number_constraints = 0;
+      this->number_jacobian_nonzeros = 0;
+      this->primal_product.resize(this->number_variables);
+      this->hessian_diagonal.resize(this->number_variables);
+      this->probing_vector.resize(this->number_variables);
+      this->rhs.resize(this->number_variables);
+      this->solution.resize(this->number_variables);
+   }
+
+   void MatrixFreeEvaluationSpace::initialize_augmented_system(const Subproblem& subproblem) {
+      if (!subproblem.has_hessian_operator()) {
+         throw std::runtime_error("The subproblem does not have a Hessian operator and cannot be solved with an iterative linear solver");
+      }
+      this->number_variables = subproblem.number_variables;
+      this->number_constraints = subproblem.number_constraints;
+      const size_t dimension = subproblem.number_variables + subproblem.number_constraints;
+
+      // evaluations
+      this->objective_gradient.resize(subproblem.number_variables);
+      this->constraints.resize(subproblem.number_constraints);
+
+      // Jacobian
+      this->number_jacobian_nonzeros = subproblem.number_jacobian_nonzeros();
+      this->jacobian_row_indices.resize(this->number_jacobian_nonzeros);
+      this->jacobian_column_indices.resize(this->number_jacobian_nonzeros);
+      subproblem.compute_constraint_jacobian_sparsity(this->jacobian_row_indices.data(), this->jacobian_column_indices.data(),
+         Indexing::C_indexing, MatrixOrder::COLUMN_MAJOR);
+      this->jacobian_values.resize(this->number_jacobian_nonzeros);
+
+      this->primal_product.resize(this->number_variables);
+      this->hessian_diagonal.resize(this->number_variables);
+      this->probing_vector.resize(this->number_variables);
+      this->rhs.resize(dimension);
+      this->solution.resize(dimension);
+   }
+
+   void MatrixFreeEvaluationSpace::evaluate_constraint_jacobian(const OptimizationProblem& problem, Iterate& iterate) {
+      problem.evaluate_constraint_jacobian(iterate, this->jacobian_values.data());
+   }
+
+   void MatrixFreeEvaluationSpace::compute_constraint_jacobian_vector_product(const Vector<double>& vector, Vector<double>& result) const {
+      result.fill(0.);
+      for (size_t nonzero_index: Range(this->number_jacobian_nonzeros)) {
+         const size_t constraint_index = static_cast<size_t>(this->jacobian_row_indices[nonzero_index]);
+         const size_t variable_index = static_cast<size_t>(this->jacobian_column_indices[nonzero_index]);
+         if (constraint_index < result.size() && variable_index < vector.size()) {
+            result[constraint_index] += this->jacobian_values[nonzero_index] * vector[variable_index];
+         }
+      }
+   }
+
+   void MatrixFreeEvaluationSpace::compute_constraint_jacobian_transposed_vector_product(const Vector<double>& vector,
+         Vector<double>& result) const {
+      result.fill(0.);
+      for (size_t nonzero_index: Range(this->number_jacobian_nonzeros)) {
+         const size_t constraint_index = static_cast<size_t>(this->jacobian_row_indices[nonzero_index]);
+         const size_t variable_index = static_cast<size_t>(this->jacobian_column_indices[nonzero_index]);
+         if (variable_index < result.size() && constraint_index < vector.size()) {
+            result[variable_index] += this->jacobian_values[nonzero_index] * vector[constraint_index];
+         }
+      }
+   }
+
+   double MatrixFreeEvaluationSpace::compute_hessian_quadratic_product(const Vector<double>& /*vector*/) const {
+      return 0.;
+   }
+
+   void MatrixFreeEvaluationSpace::compute_augmented_matrix_vector_product(const Subproblem& subproblem,
+         const Vector<double>& vector, Vector<double>& result) {
+      // (1, 1) block: the regularized Hessian operator only writes the entries of the variables it knows about (e.g. not
+      // the elastics)
+      this->primal_product.fill(0.);
+      subproblem.compute_hessian_vector_product(subproblem.current_iterate.primals.data(), vector.data(), this->primal_product.data());
+      for (size_t variable_index: Range(this->number_variables)) {
+         result[variable_index] = this->primal_product[variable_index];
+      }
+
+      // (2, 1) and (1, 2) blocks
+      for (size_t constraint_index: Range(this->number_constraints)) {
+         result[this->number_variables + constraint_index] = 0.;
+      }
+      for (size_t nonzero_index: Range(this->number_jacobian_nonzeros)) {
+         const size_t constraint_index = static_cast<size_t>(this->jacobian_row_indices[nonzero_index]);
+         const size_t variable_index = static_cast<size_t>(this->jacobian_column_indices[nonzero_index]);
+         const double derivative = this->jacobian_values[nonzero_index];
+         result[variable_index] += derivative * vector[this->number_variables + constraint_index];
+         result[this->number_variables + constraint_index] += derivative * vector[variable_index];
+      }
+   }
+
+   // the Hessian is only available as an operator: its diagonal is estimated by probing with the vector of ones and the
+   // vector of alternating signs. The average of the two probes cancels the couplings between variables at odd distances,
+   // which makes it exact for diagonal and tridiagonal Hessians. The terms known in closed form (e.g. the barrier terms)
+   // are always accounted for
+   void MatrixFreeEvaluationSpace::estimate_hessian_diagonal(const Subproblem& subproblem) {
+      this->hessian_diagonal.fill(0.);
+      this->primal_product.fill(0.);
+      this->probing_vector.fill(1.);
+      subproblem.compute_hessian_vector_product(subproblem.current_iterate.primals.data(), this->probing_vector.data(),
+         this->hessian_diagonal.data());
+      for (size_t variable_index: Range(this->number_variables)) {
+         this->probing_vector[variable_index] = (variable_index % 2 == 0) ? 1. : -1.;
+      }
+      subproblem.compute_hessian_vector_product(subproblem.current_iterate.primals.data(), this->probing_vector.data(),
+         this->primal_product.data());
+      for (size_t variable_index: Range(this->number_variables)) {
+         this->hessian_diagonal[variable_index] = 0.5 * (this->hessian_diagonal[variable_index] +
+            this->probing_vector[variable_index] * this->primal_product[variable_index]);
+      }
+      this->primal_product.fill(0.);
+      subproblem.evaluate_diagonal_hessian_terms(this->primal_product.data());
+      double largest_diagonal_term = 0.;
+      for (size_t variable_index: Range(this->number_variables)) {
+         this->hessian_diagonal[variable_index] = std::max(std::abs(this->hessian_diagonal[variable_index]),
+            std::abs(this->primal_product[variable_index]));
+         largest_diagonal_term = std::max(largest_diagonal_term, this->hessian_diagonal[variable_index]);
+      }
+      // the probing may cancel out (or the Hessian may vanish): the diagonal is bounded away from 0 relative to its scale
+      const double smallest_diagonal_term = (0. < largest_diagonal_term) ?
+         MatrixFreeEvaluationSpace::relative_diagonal_floor * largest_diagonal_term : 1.;
+      for (size_t variable_index: Range(this->number_variables)) {
+         this->hessian_diagonal[variable_index] = std::max(this->hessian_diagonal[variable_index], smallest_diagonal_term);
+      }
+   }
+
+   void MatrixFreeEvaluationSpace::compute_block_diagonal_preconditioner(const Subproblem& /*subproblem*/, double primal_shift,
+         Vector<double>& preconditioner) {
+      // primal block: estimated diagonal of the (shifted) Hessian
+      for (size_t variable_index: Range(this->number_variables)) {
+         preconditioner[variable_index] = this->hessian_diagonal[variable_index] + primal_shift;
+      }
+
+      // dual block: diagonal of the Schur complement J D^{-1} J^T
+      for (size_t constraint_index: Range(this->number_constraints)) {
+         preconditioner[this->number_variables + constraint_index] = 0.;
+      }
+      for (size_t nonzero_index: Range(this->number_jacobian_nonzeros)) {
+         const size_t constraint_index = static_cast<size_t>(this->jacobian_row_indices[nonzero_index]);
+         const size_t variable_index = static_cast<size_t>(this->jacobian_column_indices[nonzero_index]);
+         const double derivative = this->jacobian_values[nonzero_index];
+         preconditioner[this->number_variables + constraint_index] += derivative * derivative / preconditioner[variable_index];
+      }
+      for (size_t constraint_index: Range(this->number_constraints)) {
+         // empty constraint rows
+         if (preconditioner[this->number_variables + constraint_index] == 0.) {
+            preconditioner[this->number_variables + constraint_index] = 1.;
+         }
+      }
+   }
+
+   void MatrixFreeEvaluationSpace::set_up_linear_system(const Subproblem& subproblem, const WarmstartInformation& warmstart_information) {
+      // evaluate the functions at the current iterate
+      if (warmstart_information.objective_changed) {
+         subproblem.problem.evaluate_objective_gradient(subproblem.current_iterate, this->objective_gradient.data());
+      }
+      if (warmstart_information.constraints_changed) {
+         subproblem.problem.evaluate_constraints(subproblem.current_iterate, this->constraints);
+      }
+
+      if (warmstart_information.objective_changed || warmstart_information.constraints_changed) {
+         this->evaluate_constraint_jacobian(subproblem.problem, subproblem.current_iterate);
+
+         // assemble the RHS
+         const COOMatrix jacobian{this->jacobian_row_indices.data(), this->jacobian_column_indices.data(),
+            this->jacobian_values.data()};
+         subproblem.assemble_augmented_rhs(this->objective_gradient, this->constraints, jacobian, this->rhs);
+      }
+   }
+} // namespace
@@ -0,0 +1,62 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_MATRIXFREEEVALUATIONSPACE_H
+#define UNO_MATRIXFREEEVALUATIONSPACE_H
+
+#include <cstddef>
+#include <vector>
+#include "linear_algebra/Vector.hpp"
+#include "optimization/EvaluationSpace.hpp"
+
+namespace uno {
+   // evaluation space of the iterative solvers: the Lagrangian Hessian is never formed and is only accessed through
+   // Hessian-vector products. The (sparse) constraint Jacobian is stored as an operator
+   class MatrixFreeEvaluationSpace: public EvaluationSpace {
+   public:
+      MatrixFreeEvaluationSpace() = default;
+      ~MatrixFreeEvaluationSpace() override = default;
+
+      void initialize_hessian(const Subproblem& subproblem);
+      void initialize_augmented_system(const Subproblem& subproblem);
+
+      void evaluate_constraint_jacobian(const OptimizationProblem& problem, Iterate& iterate) override;
+      void compute_constraint_jacobian_vector_product(const Vector<double>& vector, Vector<double>& result) const override;
+      void compute_constraint_jacobian_transposed_vector_product(const Vector<double>& vector,
+         Vector<double>& result) const override;
+      [[nodiscard]] double compute_hessian_quadratic_product(const Vector<double>& vector) const override;
+
+      // product of the augmented matrix [W + delta*I, J^T; J, 0] with a vector of size n+m, where the primal regularization
+      // delta is that of the regularization strategy
+      void compute_augmented_matrix_vector_product(const Subproblem& subproblem, const Vector<double>& vector,
+         Vector<double>& result);
+      // estimate of |diag(W)| with two Hessian-vector products, computed once per linear system
+      void estimate_hessian_diagonal(const Subproblem& subproblem);
+      // SPD block-diagonal approximation diag(D, J D^{-1} J^T) of the augmented matrix, where D approximates |diag(W)|
+      void compute_block_diagonal_preconditioner(const Subproblem& subproblem, double primal_shift, Vector<double>& preconditioner);
+      void set_up_linear_system(const Subproblem& subproblem, const WarmstartInformation& warmstart_information);
+
+      Vector<double> objective_gradient{}; /*!< Dense objective gradient */
+      Vector<double> constraints{}; /*!< Constraint values (size \f$m)\f$ */
+
+      // Jacobian
+      size_t number_jacobian_nonzeros{};
+      std::vector<int> jacobian_row_indices{};
+      std::vector<int> jacobian_column_indices{};
+      Vector<double> jacobian_values{};
+
+      Vector<double> rhs{};
+      Vector<double> solution{};
+
+   protected:
+      size_t number_variables{};
+      size_t number_constraints{};
+      Vector<double> primal_product{};
+      Vector<double> hessian_diagonal{};
+      Vector<double> probing_vector{};
+
+      static constexpr double relative_diagonal_floor{1e-8};
+   };
+} // namespace
+
+#endif // UNO_MATRIXFREEEVALUATIONSPACE_H
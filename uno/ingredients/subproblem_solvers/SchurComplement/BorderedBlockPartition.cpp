@@ -0,0 +1,147 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include "BorderedBlockPartition.hpp"
+#include "symbolic/Range.hpp"
+#include "tools/Logger.hpp"
+
+namespace uno {
+   void BorderedBlockPartition::compute(size_t dimension, const std::vector<int>& row_indices,
+         const std::vector<int>& column_indices, size_t number_unregularized_nonzeros, const std::vector<size_t>& declared_blocks,
+         double linking_degree_ratio) {
+      // border rows: declared or detected from the number of off-diagonal entries
+      std::vector<bool> in_border(dimension, false);
+      const bool blocks_declared = std::any_of(declared_blocks.begin(), declared_blocks.end(), [](size_t block) {
+         return block != BorderedBlockPartition::undeclared;
+      });
+      if (blocks_declared) {
+         for (size_t row_index: Range(dimension)) {
+            in_border[row_index] = (declared_blocks[row_index] == BorderedBlockPartition::border);
+         }
+      }
+      else {
+         std::vector<size_t> number_off_diagonal_entries(dimension, 0);
+         size_t total_number_off_diagonal_entries = 0;
+         for (size_t nonzero_index: Range(row_indices.size())) {
+            const size_t row_index = static_cast<size_t>(row_indices[nonzero_index] - 1);
+            const size_t column_index = static_cast<size_t>(column_indices[nonzero_index] - 1);
+            if (row_index != column_index) {
+               ++number_off_diagonal_entries[row_index];
+               ++number_off_diagonal_entries[column_index];
+               total_number_off_diagonal_entries += 2;
+            }
+         }
+         const double threshold = linking_degree_ratio * static_cast<double>(total_number_off_diagonal_entries) /
+            static_cast<double>(std::max(dimension, size_t(1)));
+         for (size_t row_index: Range(dimension)) {
+            in_border[row_index] = (threshold < static_cast<double>(number_off_diagonal_entries[row_index]));
+         }
+      }
+
+      // blocks: connected components of the rows outside the border
+      this->parents.resize(dimension);
+      for (size_t row_index: Range(dimension)) {
+         this->parents[row_index] = row_index;
+      }
+      for (size_t nonzero_index: Range(row_indices.size())) {
+         const size_t row_index = static_cast<size_t>(row_indices[nonzero_index] - 1);
+         const size_t column_index = static_cast<size_t>(column_indices[nonzero_index] - 1);
+         if (!in_border[row_index] && !in_border[column_index]) {
+            this->merge(row_index, column_index);
+         }
+      }
+      if (blocks_declared) {
+         // first row of each declared block
+         std::vector<size_t> representatives;
+         for (size_t row_index: Range(dimension)) {
+            const size_t block = declared_blocks[row_index];
+            if (!in_border[row_index] && block != BorderedBlockPartition::undeclared) {
+               if (representatives.size() <= block) {
+                  representatives.resize(block + 1, BorderedBlockPartition::undeclared);
+               }
+               if (representatives[block] == BorderedBlockPartition::undeclared) {
+                  representatives[block] = row_index;
+               }
+               this->merge(row_index, representatives[block]);
+            }
+         }
+      }
+
+      // singleton blocks without a structural diagonal entry are moved into the border
+      std::vector<size_t> component_sizes(dimension, 0);
+      std::vector<bool> has_structural_diagonal(dimension, false);
+      std::vector<bool> has_neighbors(dimension, false);
+      for (size_t row_index: Range(dimension)) {
+         if (!in_border[row_index]) {
+            ++component_sizes[this->find_root(row_index)];
+         }
+      }
+      for (size_t nonzero_index: Range(row_indices.size())) {
+         const size_t row_index = static_cast<size_t>(row_indices[nonzero_index] - 1);
+         const size_t column_index = static_cast<size_t>(column_indices[nonzero_index] - 1);
+         if (row_index == column_index) {
+            if (nonzero_index < number_unregularized_nonzeros) {
+               has_structural_diagonal[row_index] = true;
+            }
+         }
+         else {
+            has_neighbors[row_index] = true;
+            has_neighbors[column_index] = true;
+         }
+      }
+      for (size_t row_index: Range(dimension)) {
+         if (!in_border[row_index] && component_sizes[this->find_root(row_index)] == 1 && !has_structural_diagonal[row_index] &&
+               has_neighbors[row_index]) {
+            in_border[row_index] = true;
+         }
+      }
+
+      // number the blocks and the rows within the blocks and the border
+      this->number_blocks = 0;
+      this->row_blocks.assign(dimension, BorderedBlockPartition::border);
+      this->local_indices.resize(dimension);
+      this->block_dimensions.clear();
+      this->border_dimension = 0;
+      std::vector<size_t> block_of_root(dimension, BorderedBlockPartition::border);
+      for (size_t row_index: Range(dimension)) {
+         if (in_border[row_index]) {
+            this->local_indices[row_index] = this->border_dimension;
+            ++this->border_dimension;
+         }
+         else {
+            const size_t root = this->find_root(row_index);
+            if (block_of_root[root] == BorderedBlockPartition::border) {
+               block_of_root[root] = this->number_blocks;
+               this->block_dimensions.push_back(0);
+               ++this->number_blocks;
+            }
+            const size_t block = block_of_root[root];
+            this->row_blocks[row_index] = block;
+            this->local_indices[row_index] = this->block_dimensions[block];
+            ++this->block_dimensions[block];
+         }
+      }
+      DEBUG << "Bordered block partition: " << this->number_blocks << " blocks and a border of dimension " <<
+         this->border_dimension << '\n';
+   }
+
+   // protected member functions
+
+   size_t BorderedBlockPartition::find_root(size_t row_index) {
+      while (this->parents[row_index] != row_index) {
+         // path halving
+         this->parents[row_index] = this->parents[this->parents[row_index]];
+         row_index = this->parents[row_index];
+      }
+      return row_index;
+   }
+
+   void BorderedBlockPartition::merge(size_t row_index, size_t other_row_index) {
+      const size_t root = this->find_root(row_index);
+      const size_t other_root = this->find_root(other_row_index);
+      if (root != other_root) {
+         this->parents[std::max(root, other_root)] = std::min(root, other_root);
+      }
+   }
+} // namespace
@@ -0,0 +1,48 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_BORDEREDBLOCKPARTITION_H
+#define UNO_BORDEREDBLOCKPARTITION_H
+
+#include <cstddef>
+#include <vector>
+
+namespace uno {
+   // partition of the rows of a symmetric matrix into independent diagonal blocks A_b and a border:
+   //   [A_1             C_1^T]
+   //   [     ...         ... ]
+   //   [          A_k   C_k^T]
+   //   [C_1  ...  C_k   D    ]
+   // Two rows outside the border belong to the same block if they are coupled by an off-diagonal entry
+   class BorderedBlockPartition {
+   public:
+      static constexpr size_t border = static_cast<size_t>(-1);
+      static constexpr size_t undeclared = static_cast<size_t>(-2);
+
+      BorderedBlockPartition() = default;
+
+      // the sparsity pattern is given in Fortran indexing. declared_blocks is either empty or contains the declared block
+      // of each row (a block index, border or undeclared): the rows declared in the same block end up in the same block.
+      // If no block is declared, the border is detected: it contains the rows whose number of off-diagonal entries
+      // exceeds linking_degree_ratio times the average (e.g. the first-stage variables of a stochastic model).
+      // The entries from number_unregularized_nonzeros on are regularization entries: a row whose only diagonal entry is
+      // a regularization entry (e.g. an equality constraint) and whose neighbors are all in the border would form a
+      // structurally singular 1x1 block. Such rows are moved into the border
+      void compute(size_t dimension, const std::vector<int>& row_indices, const std::vector<int>& column_indices,
+         size_t number_unregularized_nonzeros, const std::vector<size_t>& declared_blocks, double linking_degree_ratio);
+
+      size_t number_blocks{0};
+      std::vector<size_t> row_blocks{}; /*!< Block of each row (or border) */
+      std::vector<size_t> local_indices{}; /*!< Index of each row within its block (or within the border) */
+      std::vector<size_t> block_dimensions{};
+      size_t border_dimension{0};
+
+   protected:
+      std::vector<size_t> parents{}; // union-find forest
+
+      [[nodiscard]] size_t find_root(size_t row_index);
+      void merge(size_t row_index, size_t other_row_index);
+   };
+} // namespace
+
+#endif // UNO_BORDEREDBLOCKPARTITION_H
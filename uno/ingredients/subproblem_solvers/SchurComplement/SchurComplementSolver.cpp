@@ -0,0 +1,402 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include "SchurComplementSolver.hpp"
+#include "ingredients/subproblem/Subproblem.hpp"
+#include "ingredients/subproblem_solvers/SymmetricIndefiniteLinearSolverFactory.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "model/BlockPartition.hpp"
+#include "model/Model.hpp"
+#include "optimization/Direction.hpp"
+#include "optimization/OptimizationProblem.hpp"
+#include "options/Options.hpp"
+#include "symbolic/Range.hpp"
+#include "tools/Logger.hpp"
+
+namespace uno {
+   namespace {
+      size_t get_number_threads(const Options& options) {
+         const size_t number_threads = options.get_unsigned_int("SchurComplement_number_threads");
+         if (number_threads == 0) {
+            // one thread per hardware thread (hardware_concurrency may be unknown)
+            return std::max(size_t(1), static_cast<size_t>(std::thread::hardware_concurrency()));
+         }
+         return number_threads;
+      }
+
+      // first sparse direct solver (if any)
+      std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<double>> create_sparse_solver(const Options& options) {
+         for (const std::string& linear_solver: SymmetricIndefiniteLinearSolverFactory::available_solvers()) {
+            if (linear_solver != "DenseLDL" && linear_solver != "SchurComplement" && linear_solver != "MINRES") {
+               return SymmetricIndefiniteLinearSolverFactory::create(linear_solver, options);
+            }
+         }
+         return nullptr;
+      }
+   } // namespace
+
+   SchurComplementSolver::SchurComplementSolver(const Options& options): DirectSymmetricIndefiniteLinearSolver(options),
+         options(options),
+         linking_degree_ratio(options.get_double("SchurComplement_linking_degree_ratio")),
+         maximum_dense_dimension(options.get_unsigned_int("DenseLDL_max_dimension")),
+         worker_pool(get_number_threads(options)),
+         sparse_solver(create_sparse_solver(options)) {
+   }
+
+   void SchurComplementSolver::initialize_hessian(const Subproblem& subproblem) {
+      this->evaluation_space.initialize_hessian(subproblem);
+      this->declare_blocks(subproblem, false);
+   }
+
+   void SchurComplementSolver::initialize_augmented_system(const Subproblem& subproblem) {
+      this->evaluation_space.initialize_augmented_system(subproblem);
+      this->declare_blocks(subproblem, true);
+   }
+
+   // partition the rows and distribute the entries of the matrix among the blocks, the coupling matrices and the border
+   void SchurComplementSolver::do_symbolic_analysis() {
+      const std::vector<int>& row_indices = this->evaluation_space.matrix_row_indices;
+      const std::vector<int>& column_indices = this->evaluation_space.matrix_column_indices;
+      this->partition.compute(this->evaluation_space.dimension, row_indices, column_indices,
+         this->evaluation_space.number_unregularized_nonzeros(), this->declared_blocks, this->linking_degree_ratio);
+      this->use_sparse_solver = false;
+      if (this->partition.number_blocks <= 1) {
+         if (this->sparse_solver != nullptr) {
+            WARNING << "The Schur-complement decomposition found no block structure: the matrix is factorized with a sparse direct solver\n";
+            auto& sparse_evaluation_space = dynamic_cast<COOEvaluationSpace&>(this->sparse_solver->get_evaluation_space());
+            sparse_evaluation_space.dimension = this->evaluation_space.dimension;
+            sparse_evaluation_space.number_matrix_nonzeros = this->evaluation_space.number_matrix_nonzeros;
+            sparse_evaluation_space.matrix_row_indices = row_indices;
+            sparse_evaluation_space.matrix_column_indices = column_indices;
+            this->sparse_solver->do_symbolic_analysis();
+            this->use_sparse_solver = true;
+            return;
+         }
+         if (this->maximum_dense_dimension < this->evaluation_space.dimension) {
+            throw std::runtime_error("The Schur-complement decomposition found no block structure and no sparse direct solver "
+               "is available to factorize the matrix of dimension " + std::to_string(this->evaluation_space.dimension));
+         }
+         WARNING << "The Schur-complement decomposition found no block structure: the matrix is factorized as a single dense block\n";
+      }
+
+      this->blocks.clear();
+      this->blocks.resize(this->partition.number_blocks);
+      this->border_rows.resize(this->partition.border_dimension);
+      this->border_entries.clear();
+      for (size_t row_index: Range(this->evaluation_space.dimension)) {
+         const size_t block_index = this->partition.row_blocks[row_index];
+         if (block_index == BorderedBlockPartition::border) {
+            this->border_rows[this->partition.local_indices[row_index]] = row_index;
+         }
+         else {
+            this->blocks[block_index].rows.push_back(row_index);
+         }
+      }
+      for (size_t nonzero_index: Range(row_indices.size())) {
+         const size_t row_index = static_cast<size_t>(row_indices[nonzero_index] - 1);
+         const size_t column_index = static_cast<size_t>(column_indices[nonzero_index] - 1);
+         const size_t row_block = this->partition.row_blocks[row_index];
+         const size_t column_block = this->partition.row_blocks[column_index];
+         const size_t local_row_index = this->partition.local_indices[row_index];
+         const size_t local_column_index = this->partition.local_indices[column_index];
+         if (row_block == BorderedBlockPartition::border && column_block == BorderedBlockPartition::border) {
+            this->border_entries.push_back({nonzero_index, local_row_index, local_column_index});
+         }
+         else if (row_block == BorderedBlockPartition::border) {
+            this->blocks[column_block].coupling_entries.push_back({nonzero_index, local_column_index, local_row_index});
+         }
+         else if (column_block == BorderedBlockPartition::border) {
+            this->blocks[row_block].coupling_entries.push_back({nonzero_index, local_row_index, local_column_index});
+         }
+         else {
+            this->blocks[row_block].entries.push_back({nonzero_index, local_row_index, local_column_index});
+         }
+      }
+
+      // restrict the coupling matrices to the border rows coupled to each block and allocate the dense storage
+      std::vector<size_t> coupled_position(this->partition.border_dimension, BorderedBlockPartition::border);
+      for (Block& block: this->blocks) {
+         for (LocalEntry& entry: block.coupling_entries) {
+            if (coupled_position[entry.column_index] == BorderedBlockPartition::border) {
+               coupled_position[entry.column_index] = block.coupled_border_indices.size();
+               block.coupled_border_indices.push_back(entry.column_index);
+            }
+            entry.column_index = coupled_position[entry.column_index];
+         }
+         for (size_t border_index: block.coupled_border_indices) {
+            coupled_position[border_index] = BorderedBlockPartition::border;
+         }
+         this->analyze_block(block);
+         const size_t dimension = block.rows.size();
+         const size_t number_coupled_rows = block.coupled_border_indices.size();
+         block.coupling.resize(dimension * number_coupled_rows);
+         block.solved_coupling.resize(dimension * number_coupled_rows);
+         block.schur_contribution.resize(number_coupled_rows * number_coupled_rows);
+         block.solution.resize(dimension);
+         block.border_correction.resize(number_coupled_rows);
+      }
+      this->schur_complement.resize(this->partition.border_dimension);
+      this->border_solution.resize(this->partition.border_dimension);
+   }
+
+   void SchurComplementSolver::do_numerical_factorization(const double* matrix_values) {
+      if (this->use_sparse_solver) {
+         this->sparse_solver->do_numerical_factorization(matrix_values);
+         return;
+      }
+      this->for_each_block([&](Block& block) {
+         this->factorize_block(block, matrix_values);
+      });
+      // assemble and factorize the Schur complement S = D - sum_b C_b A_b^{-1} C_b^T (lower triangle)
+      this->schur_complement.clear();
+      for (const LocalEntry& entry: this->border_entries) {
+         this->schur_complement.add(entry.row_index, entry.column_index, matrix_values[entry.nonzero_index]);
+      }
+      for (const Block& block: this->blocks) {
+         const size_t number_coupled_rows = block.coupled_border_indices.size();
+         for (size_t position: Range(number_coupled_rows)) {
+            for (size_t other_position: Range(position + 1)) {
+               this->schur_complement.add(block.coupled_border_indices[position], block.coupled_border_indices[other_position],
+                  -block.schur_contribution[position * number_coupled_rows + other_position]);
+            }
+         }
+      }
+      this->schur_complement.factorize();
+      UNO_LOG(DEBUG) << "Schur-complement factorization with inertia " << this->get_inertia() << '\n';
+   }
+
+   void SchurComplementSolver::solve_indefinite_system(Statistics& statistics, const Subproblem& subproblem, Direction& direction,
+         const WarmstartInformation& warmstart_information) {
+      // set up the linear system by evaluating the functions at the current iterate
+      this->evaluation_space.set_up_linear_system(statistics, subproblem, *this, warmstart_information);
+      // solve the linear system
+      this->solve_indefinite_system(this->evaluation_space.matrix_values, this->evaluation_space.rhs, this->evaluation_space.solution);
+      this->report_refinement(statistics);
+      // assemble the full primal-dual direction
+      this->evaluation_space.assemble_primal_dual_direction(subproblem, direction);
+      if (this->matrix_is_singular()) {
+         direction.status = SubproblemStatus::INFEASIBLE;
+      }
+   }
+
+   void SchurComplementSolver::solve_augmented_system(const Vector<double>& rhs, Vector<double>& result) {
+      this->evaluation_space.solve_augmented_system(*this, rhs, result);
+   }
+
+   Inertia SchurComplementSolver::get_inertia() const {
+      if (this->use_sparse_solver) {
+         return this->sparse_solver->get_inertia();
+      }
+      const Inertia schur_complement_inertia = this->schur_complement.get_inertia();
+      size_t number_positive_eigenvalues = schur_complement_inertia.positive;
+      size_t number_negative_eigenvalues = schur_complement_inertia.negative;
+      size_t number_zero_eigenvalues = schur_complement_inertia.zero;
+      for (const Block& block: this->blocks) {
+         const Inertia block_inertia = SchurComplementSolver::get_block_inertia(block);
+         number_positive_eigenvalues += block_inertia.positive;
+         number_negative_eigenvalues += block_inertia.negative;
+         number_zero_eigenvalues += block_inertia.zero;
+      }
+      return {number_positive_eigenvalues, number_negative_eigenvalues, number_zero_eigenvalues};
+   }
+
+   size_t SchurComplementSolver::number_negative_eigenvalues() const {
+      return this->get_inertia().negative;
+   }
+
+   bool SchurComplementSolver::matrix_is_singular() const {
+      return (0 < this->get_inertia().zero);
+   }
+
+   size_t SchurComplementSolver::rank() const {
+      return this->evaluation_space.dimension - this->get_inertia().zero;
+   }
+
+   EvaluationSpace& SchurComplementSolver::get_evaluation_space() {
+      return this->evaluation_space;
+   }
+
+   const BorderedBlockPartition& SchurComplementSolver::get_partition() const {
+      return this->partition;
+   }
+
+   // private member functions
+
+   // map the block partition of the model (if any) onto the rows of the linear system: the variables, then the constraints
+   // (augmented system). The variables added by the reformulations (e.g. the elastic variables) are not declared
+   void SchurComplementSolver::declare_blocks(const Subproblem& subproblem, bool augmented_system) {
+      this->declared_blocks.clear();
+      const Model& model = subproblem.problem.model;
+      const BlockPartition& block_partition = model.get_block_partition();
+      if (block_partition.is_empty()) {
+         return;
+      }
+      this->declared_blocks.resize(this->evaluation_space.dimension, BorderedBlockPartition::undeclared);
+      const auto declare = [&](size_t augmented_row, size_t block_index) {
+         const size_t row_index = this->evaluation_space.linear_system_row(augmented_row);
+         if (row_index != AugmentedSystemCondensation::eliminated) {
+            this->declared_blocks[row_index] = (block_index == BlockPartition::linking) ? BorderedBlockPartition::border : block_index;
+         }
+      };
+      for (size_t variable_index: Range(model.number_variables)) {
+         declare(variable_index, block_partition.variable_blocks[variable_index]);
+      }
+      if (augmented_system) {
+         for (size_t constraint_index: Range(model.number_constraints)) {
+            declare(subproblem.number_variables + constraint_index, block_partition.constraint_blocks[constraint_index]);
+         }
+      }
+   }
+
+   // a block of dimension at most DenseLDL_max_dimension is stored densely. A larger block is given its own sparse solver:
+   // the instances are independent, which allows the blocks to be factorized in parallel
+   void SchurComplementSolver::analyze_block(Block& block) {
+      const size_t dimension = block.rows.size();
+      if (dimension <= this->maximum_dense_dimension) {
+         block.factorization.resize(dimension);
+         return;
+      }
+      block.sparse_solver = create_sparse_solver(this->options);
+      if (block.sparse_solver == nullptr) {
+         throw std::runtime_error("The Schur-complement decomposition found a block of dimension " + std::to_string(dimension) +
+            ", larger than DenseLDL_max_dimension, and no sparse direct solver is available to factorize it");
+      }
+      auto& sparse_evaluation_space = dynamic_cast<COOEvaluationSpace&>(block.sparse_solver->get_evaluation_space());
+      sparse_evaluation_space.dimension = dimension;
+      sparse_evaluation_space.number_matrix_nonzeros = block.entries.size();
+      sparse_evaluation_space.matrix_row_indices.resize(block.entries.size());
+      sparse_evaluation_space.matrix_column_indices.resize(block.entries.size());
+      for (size_t entry_index: Range(block.entries.size())) {
+         sparse_evaluation_space.matrix_row_indices[entry_index] = static_cast<int>(block.entries[entry_index].row_index + 1);
+         sparse_evaluation_space.matrix_column_indices[entry_index] = static_cast<int>(block.entries[entry_index].column_index + 1);
+      }
+      block.sparse_solver->do_symbolic_analysis();
+      block.values.resize(block.entries.size());
+      block.sparse_rhs.resize(dimension);
+      block.sparse_solution.resize(dimension);
+   }
+
+   // factorize A_b and compute the contribution C_b A_b^{-1} C_b^T of the block to the Schur complement
+   void SchurComplementSolver::factorize_block(Block& block, const double* matrix_values) {
+      if (block.sparse_solver != nullptr) {
+         for (size_t entry_index: Range(block.entries.size())) {
+            block.values[entry_index] = matrix_values[block.entries[entry_index].nonzero_index];
+         }
+         block.sparse_solver->do_numerical_factorization(block.values.data());
+      }
+      else {
+         block.factorization.clear();
+         for (const LocalEntry& entry: block.entries) {
+            block.factorization.add(entry.row_index, entry.column_index, matrix_values[entry.nonzero_index]);
+         }
+         block.factorization.factorize();
+      }
+
+      const size_t dimension = block.rows.size();
+      const size_t number_coupled_rows = block.coupled_border_indices.size();
+      std::fill(block.coupling.begin(), block.coupling.end(), 0.);
+      for (const LocalEntry& entry: block.coupling_entries) {
+         block.coupling[entry.column_index * dimension + entry.row_index] += matrix_values[entry.nonzero_index];
+      }
+      block.solved_coupling = block.coupling;
+      for (size_t position: Range(number_coupled_rows)) {
+         this->solve_block(block, block.solved_coupling.data() + position * dimension);
+      }
+      for (size_t position: Range(number_coupled_rows)) {
+         for (size_t other_position: Range(position + 1)) {
+            double product = 0.;
+            for (size_t index: Range(dimension)) {
+               product += block.coupling[position * dimension + index] * block.solved_coupling[other_position * dimension + index];
+            }
+            block.schur_contribution[position * number_coupled_rows + other_position] = product;
+         }
+      }
+   }
+
+   // solve in place with the factorization of A_b
+   void SchurComplementSolver::solve_block(Block& block, double* vector) {
+      if (block.sparse_solver != nullptr) {
+         std::copy_n(vector, block.sparse_rhs.size(), block.sparse_rhs.data());
+         block.sparse_solver->solve_indefinite_system(block.values, block.sparse_rhs, block.sparse_solution);
+         std::copy_n(block.sparse_solution.data(), block.sparse_solution.size(), vector);
+      }
+      else {
+         block.factorization.solve(vector);
+      }
+   }
+
+   Inertia SchurComplementSolver::get_block_inertia(const Block& block) {
+      if (block.sparse_solver != nullptr) {
+         return block.sparse_solver->get_inertia();
+      }
+      return block.factorization.get_inertia();
+   }
+
+   // apply a function to all blocks. The blocks are distributed dynamically among the threads of the pool
+   template <typename Function>
+   void SchurComplementSolver::for_each_block(const Function& function) {
+      this->worker_pool.run(this->blocks.size(), [&](size_t block_index) {
+         function(this->blocks[block_index]);
+      });
+   }
+
+   // block elimination:
+   // - y_b = A_b^{-1} r_b for each block
+   // - S x_S = r_S - sum_b C_b y_b
+   // - x_b = y_b - A_b^{-1} C_b^T x_S for each block
+   void SchurComplementSolver::solve_with_factorization(const Vector<double>& matrix_values, const Vector<double>& rhs,
+         Vector<double>& result) {
+      if (this->use_sparse_solver) {
+         this->sparse_solver->solve_indefinite_system(matrix_values, rhs, result);
+         return;
+      }
+      this->for_each_block([&](Block& block) {
+         const size_t dimension = block.rows.size();
+         for (size_t index: Range(dimension)) {
+            block.solution[index] = rhs[block.rows[index]];
+         }
+         this->solve_block(block, block.solution.data());
+         for (size_t position: Range(block.coupled_border_indices.size())) {
+            double product = 0.;
+            for (size_t index: Range(dimension)) {
+               product += block.coupling[position * dimension + index] * block.solution[index];
+            }
+            block.border_correction[position] = product;
+         }
+      });
+      for (size_t border_index: Range(this->border_rows.size())) {
+         this->border_solution[border_index] = rhs[this->border_rows[border_index]];
+      }
+      for (const Block& block: this->blocks) {
+         for (size_t position: Range(block.coupled_border_indices.size())) {
+            this->border_solution[block.coupled_border_indices[position]] -= block.border_correction[position];
+         }
+      }
+      this->schur_complement.solve(this->border_solution.data());
+      this->for_each_block([&](Block& block) {
+         const size_t dimension = block.rows.size();
+         for (size_t position: Range(block.coupled_border_indices.size())) {
+            const double border_value = this->border_solution[block.coupled_border_indices[position]];
+            for (size_t index: Range(dimension)) {
+               block.solution[index] -= block.solved_coupling[position * dimension + index] * border_value;
+            }
+         }
+         // the blocks write disjoint components of the result
+         for (size_t index: Range(dimension)) {
+            result[block.rows[index]] = block.solution[index];
+         }
+      });
+      for (size_t border_index: Range(this->border_rows.size())) {
+         result[this->border_rows[border_index]] = this->border_solution[border_index];
+      }
+   }
+
+   void SchurComplementSolver::compute_residual(const Vector<double>& matrix_values, const Vector<double>& rhs,
+         const Vector<double>& solution, Vector<double>& residual, Vector<double>& scaling) const {
+      this->evaluation_space.compute_residual(matrix_values, rhs, solution, residual, scaling);
+   }
+} // namespace
@@ -0,0 +1,109 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_SCHURCOMPLEMENTSOLVER_H
+#define UNO_SCHURCOMPLEMENTSOLVER_H
+
+#include <memory>
+#include <vector>
+#include "BorderedBlockPartition.hpp"
+#include "WorkerPool.hpp"
+#include "ingredients/subproblem_solvers/DirectSymmetricIndefiniteLinearSolver.hpp"
+#include "ingredients/subproblem_solvers/COOEvaluationSpace.hpp"
+#include "ingredients/subproblem_solvers/DenseLDL/DenseLDLFactorization.hpp"
+#include "linear_algebra/Vector.hpp"
+
+namespace uno {
+   // forward declarations
+   class Options;
+   class Statistics;
+   class Subproblem;
+
+   // Schur-complement decomposition of a block-bordered matrix (e.g. the KKT matrix of a two-stage stochastic or a
+   // multiperiod model). The rows are partitioned into independent blocks A_b and a border (see BorderedBlockPartition),
+   // either from the block partition declared by the model or detected from the sparsity pattern. The blocks are
+   // factorized in parallel threads and the dense Schur complement S = D - sum_b C_b A_b^{-1} C_b^T of the border is
+   // factorized last. By Haynsworth's inertia additivity, the inertia of the matrix is the sum of the inertias of the
+   // blocks and of S. The blocks of dimension at most DenseLDL_max_dimension are factorized with the dense LDL^T
+   // factorization, the larger blocks with their own instance of a sparse direct solver.
+   // Without a block structure, the whole matrix would be factorized as a single dense block: the solver then falls back
+   // to a sparse direct solver, if one is available, or to the dense factorization for small systems only
+   class SchurComplementSolver : public DirectSymmetricIndefiniteLinearSolver<double> {
+   public:
+      explicit SchurComplementSolver(const Options& options);
+      ~SchurComplementSolver() override = default;
+
+      void initialize_hessian(const Subproblem& subproblem) override;
+      void initialize_augmented_system(const Subproblem& subproblem) override;
+
+      void do_symbolic_analysis() override;
+      void do_numerical_factorization(const double* matrix_values) override;
+      void solve_indefinite_system(Statistics& statistics, const Subproblem& subproblem, Direction& direction,
+         const WarmstartInformation& warmstart_information) override;
+      using DirectSymmetricIndefiniteLinearSolver<double>::solve_indefinite_system;
+      void solve_augmented_system(const Vector<double>& rhs, Vector<double>& result) override;
+
+      [[nodiscard]] Inertia get_inertia() const override;
+      [[nodiscard]] size_t number_negative_eigenvalues() const override;
+      [[nodiscard]] bool matrix_is_singular() const override;
+      [[nodiscard]] size_t rank() const override;
+
+      [[nodiscard]] EvaluationSpace& get_evaluation_space() override;
+      [[nodiscard]] const BorderedBlockPartition& get_partition() const;
+
+   private:
+      // entry of the matrix: nonzero index and local row and column
+      struct LocalEntry {
+         size_t nonzero_index;
+         size_t row_index;
+         size_t column_index;
+      };
+
+      struct Block {
+         std::vector<size_t> rows{}; // rows of the matrix in the block
+         DenseLDLFactorization factorization{}; // small blocks
+         std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<double>> sparse_solver{}; // large blocks
+         std::vector<LocalEntry> entries{}; // entries of A_b
+         Vector<double> values{}; // values of the entries of A_b (sparse solver)
+         Vector<double> sparse_rhs{}; // right-hand side and solution of the sparse solver
+         Vector<double> sparse_solution{};
+         std::vector<size_t> coupled_border_indices{}; // indices (within the border) of the border rows coupled to the block
+         std::vector<LocalEntry> coupling_entries{}; // entries of C_b^T (the column index is the position of the coupled border row)
+         std::vector<double> coupling{}; // C_b^T restricted to the coupled border rows, stored column-major
+         std::vector<double> solved_coupling{}; // A_b^{-1} C_b^T
+         std::vector<double> schur_contribution{}; // C_b A_b^{-1} C_b^T, restricted to the coupled border rows
+         std::vector<double> solution{};
+         std::vector<double> border_correction{}; // C_b A_b^{-1} r_b, restricted to the coupled border rows
+      };
+
+      const Options& options; // copy of the options for delayed allocation of the sparse solvers of the blocks
+      COOEvaluationSpace evaluation_space{};
+      const double linking_degree_ratio;
+      const size_t maximum_dense_dimension;
+      WorkerPool worker_pool;
+      // sparse direct solver used when no block structure is found (if available)
+      std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<double>> sparse_solver;
+      bool use_sparse_solver{false};
+      std::vector<size_t> declared_blocks{}; // block of each row declared by the model (if any)
+      BorderedBlockPartition partition{};
+      std::vector<Block> blocks{};
+      std::vector<size_t> border_rows{};
+      std::vector<LocalEntry> border_entries{}; // entries of D
+      DenseLDLFactorization schur_complement{};
+      std::vector<double> border_solution{};
+
+      void declare_blocks(const Subproblem& subproblem, bool augmented_system);
+      void analyze_block(Block& block);
+      void factorize_block(Block& block, const double* matrix_values);
+      void solve_block(Block& block, double* vector);
+      [[nodiscard]] static Inertia get_block_inertia(const Block& block);
+      template <typename Function>
+      void for_each_block(const Function& function);
+
+      void solve_with_factorization(const Vector<double>& matrix_values, const Vector<double>& rhs, Vector<double>& result) override;
+      void compute_residual(const Vector<double>& matrix_values, const Vector<double>& rhs, const Vector<double>& solution,
+         Vector<double>& residual, Vector<double>& scaling) const override;
+   };
+} // namespace
+
+#endif // UNO_SCHURCOMPLEMENTSOLVER_H
@@ -0,0 +1,87 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include "WorkerPool.hpp"
+#include "symbolic/Range.hpp"
+
+namespace uno {
+   WorkerPool::WorkerPool(size_t number_threads): maximum_number_threads(std::max(size_t(1), number_threads)) {
+   }
+
+   WorkerPool::~WorkerPool() {
+      {
+         std::lock_guard<std::mutex> lock(this->mutex);
+         this->terminate = true;
+      }
+      this->loop_started.notify_all();
+      for (std::thread& worker: this->workers) {
+         worker.join();
+      }
+   }
+
+   size_t WorkerPool::number_threads() const {
+      return this->maximum_number_threads;
+   }
+
+   // protected member functions
+
+   // the workers are started at the first parallel loop (the calling thread is the last worker)
+   void WorkerPool::start_workers() {
+      this->workers.reserve(this->maximum_number_threads - 1);
+      for ([[maybe_unused]] size_t _: Range(this->maximum_number_threads - 1)) {
+         this->workers.emplace_back(&WorkerPool::work, this);
+      }
+   }
+
+   void WorkerPool::work() {
+      size_t last_generation = 0;
+      while (true) {
+         {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->loop_started.wait(lock, [&]() { return this->terminate || last_generation != this->generation; });
+            if (this->terminate) {
+               return;
+            }
+            last_generation = this->generation;
+         }
+         this->execute_tasks();
+         {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            --this->number_busy_workers;
+         }
+         this->loop_finished.notify_one();
+      }
+   }
+
+   void WorkerPool::execute_tasks() {
+      for (size_t task_index = this->next_task_index++; task_index < this->number_tasks; task_index = this->next_task_index++) {
+         this->invoke_task(this->task, task_index);
+      }
+   }
+
+   void WorkerPool::run(size_t new_number_tasks, const void* new_task, void (*new_invoke_task)(const void*, size_t)) {
+      if (this->maximum_number_threads <= 1 || new_number_tasks <= 1) {
+         for (size_t task_index: Range(new_number_tasks)) {
+            new_invoke_task(new_task, task_index);
+         }
+         return;
+      }
+      if (this->workers.empty()) {
+         this->start_workers();
+      }
+      {
+         std::lock_guard<std::mutex> lock(this->mutex);
+         this->number_tasks = new_number_tasks;
+         this->next_task_index = 0;
+         this->task = new_task;
+         this->invoke_task = new_invoke_task;
+         this->number_busy_workers = this->workers.size();
+         ++this->generation;
+      }
+      this->loop_started.notify_all();
+      this->execute_tasks();
+      std::unique_lock<std::mutex> lock(this->mutex);
+      this->loop_finished.wait(lock, [&]() { return this->number_busy_workers == 0; });
+   }
+} // namespace
@@ -0,0 +1,61 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_WORKERPOOL_H
+#define UNO_WORKERPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace uno {
+   // persistent pool of worker threads that execute the tasks 0, ..., number_tasks-1 of a parallel loop. The threads are
+   // created once and wait between two loops, which avoids spawning and joining threads at each factorization and solve.
+   // The calling thread takes part in the loop and the tasks are distributed dynamically
+   class WorkerPool {
+   public:
+      explicit WorkerPool(size_t number_threads);
+      ~WorkerPool();
+      WorkerPool(const WorkerPool&) = delete;
+      WorkerPool& operator=(const WorkerPool&) = delete;
+
+      [[nodiscard]] size_t number_threads() const;
+
+      // the task is called as task(task_index). The call returns when all tasks have been executed
+      template <typename Task>
+      void run(size_t number_tasks, const Task& task);
+
+   protected:
+      const size_t maximum_number_threads;
+      std::vector<std::thread> workers{};
+      std::mutex mutex{};
+      std::condition_variable loop_started{};
+      std::condition_variable loop_finished{};
+      size_t generation{0};
+      size_t number_busy_workers{0};
+      bool terminate{false};
+
+      // current loop (type-erased task, so that no allocation is performed)
+      size_t number_tasks{0};
+      std::atomic<size_t> next_task_index{0};
+      const void* task{nullptr};
+      void (*invoke_task)(const void* task, size_t task_index){nullptr};
+
+      void start_workers();
+      void work();
+      void execute_tasks();
+      void run(size_t number_tasks, const void* task, void (*invoke_task)(const void*, size_t));
+   };
+
+   template <typename Task>
+   void WorkerPool::run(size_t number_tasks, const Task& task) {
+      this->run(number_tasks, static_cast<const void*>(&task), [](const void* erased_task, size_t task_index) {
+         (*static_cast<const Task*>(erased_task))(task_index);
+      });
+   }
+} // namespace
+
+#endif // UNO_WORKERPOOL_H
@@ -0,0 +1,237 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include "SteihaugCGSolver.hpp"
+#include "ingredients/subproblem/Subproblem.hpp"
+#include "linear_algebra/SparseVector.hpp"
+#include "optimization/Direction.hpp"
+#include "options/Options.hpp"
+#include "tools/Infinity.hpp"
+#include "tools/Logger.hpp"
+#include "tools/Statistics.hpp"
+
+namespace uno {
+   double SteihaugCGEvaluationSpace::compute_hessian_quadratic_product(const Vector<double>& vector) const {
+      return dot(vector, this->hessian_direction_product);
+   }
+
+   SteihaugCGSolver::SteihaugCGSolver(const Options& options): InequalityConstrainedSolver(),
+         maximum_number_iterations(options.get_unsigned_int("SteihaugCG_max_iterations")),
+         forcing_term_max(options.get_double("SteihaugCG_forcing_term_max")) {
+   }
+
+   void SteihaugCGSolver::initialize_memory(const Subproblem& subproblem) {
+      if (!subproblem.has_hessian_operator()) {
+         throw std::runtime_error("The subproblem does not have a Hessian operator and cannot be solved with SteihaugCG");
+      }
+      this->variable_lower_bounds.resize(subproblem.number_variables);
+      this->variable_upper_bounds.resize(subproblem.number_variables);
+      this->evaluation_space.objective_gradient.resize(subproblem.number_variables);
+      this->evaluation_space.hessian_direction_product.resize(subproblem.number_variables);
+      this->residual.resize(subproblem.number_variables);
+      this->conjugate_direction.resize(subproblem.number_variables);
+      this->hessian_product.resize(subproblem.number_variables);
+      this->is_free.resize(subproblem.number_variables);
+   }
+
+   void SteihaugCGSolver::initialize_statistics(Statistics& statistics, const Options& options) {
+      this->iterations_column = statistics.add_column("CG it", Statistics::int_width, options.get_int("statistics_linear_solver_iterations_column_order"));
+   }
+
+   void SteihaugCGSolver::solve(Statistics& statistics, Subproblem& subproblem, const Vector<double>& /*initial_point*/,
+         Direction& direction, const WarmstartInformation& /*warmstart_information*/) {
+      if (0 < subproblem.number_constraints) {
+         throw std::runtime_error("SteihaugCGSolver cannot solve problems with general constraints");
+      }
+      const Vector<double>& objective_gradient = this->evaluation_space.objective_gradient;
+      Vector<double>& hessian_direction_product = this->evaluation_space.hessian_direction_product;
+      Vector<double>& primal_direction = direction.primals;
+
+      // compute the objective gradient
+      subproblem.problem.evaluate_objective_gradient(subproblem.current_iterate, this->evaluation_space.objective_gradient.data());
+
+      // compute the variables bounds
+      subproblem.set_variables_bounds(this->variable_lower_bounds, this->variable_upper_bounds);
+
+      // start from the projection of 0 onto the bounds
+      bool zero_initial_point = true;
+      for (size_t variable_index: Range(subproblem.number_variables)) {
+         primal_direction[variable_index] = std::min(std::max(0., this->variable_lower_bounds[variable_index]),
+            this->variable_upper_bounds[variable_index]);
+         zero_initial_point = zero_initial_point && (primal_direction[variable_index] == 0.);
+      }
+      if (zero_initial_point) {
+         hessian_direction_product.fill(0.);
+      }
+      else {
+         this->compute_hessian_vector_product(subproblem, primal_direction, hessian_direction_product);
+      }
+
+      size_t number_iterations = 0;
+      double tolerance = 0.;
+      bool termination = false;
+      while (!termination) {
+         // (re)start CG on the free variables: the residual is the negative gradient of the model
+         this->determine_free_variables(primal_direction);
+         for (size_t variable_index: Range(subproblem.number_variables)) {
+            this->residual[variable_index] = this->is_free[variable_index] ?
+               -(objective_gradient[variable_index] + hessian_direction_product[variable_index]) : 0.;
+         }
+         double residual_squared_norm = dot(this->residual, this->residual);
+         if (number_iterations == 0) {
+            // the forcing term decreases with the projected gradient: superlinear convergence of the truncated Newton method
+            const double residual_norm = std::sqrt(residual_squared_norm);
+            tolerance = std::min(this->forcing_term_max, std::sqrt(residual_norm)) * residual_norm;
+         }
+         if (std::sqrt(residual_squared_norm) <= tolerance) {
+            break;
+         }
+         this->conjugate_direction = this->residual;
+
+         bool restart = false;
+         while (!termination && !restart) {
+            if (number_iterations == this->maximum_number_iterations) {
+               WARNING << "SteihaugCG reached the maximum number of iterations\n";
+               termination = true;
+               break;
+            }
+            ++number_iterations;
+            this->compute_hessian_vector_product(subproblem, this->conjugate_direction, this->hessian_product);
+            const double curvature = dot(this->conjugate_direction, this->hessian_product);
+            const double step_to_boundary = this->compute_step_to_boundary(primal_direction);
+
+            if (curvature <= 0.) {
+               DEBUG << "SteihaugCG: nonpositive curvature " << curvature << " along the conjugate direction\n";
+               if (!is_finite(step_to_boundary)) {
+                  // the model is unbounded along the conjugate direction: stop with the current direction or, if no progress was
+                  // made, with the steepest-descent direction
+                  if (number_iterations == 1) {
+                     this->take_step(primal_direction, 1.);
+                  }
+                  termination = true;
+               }
+               else {
+                  this->take_step(primal_direction, step_to_boundary);
+                  restart = true;
+               }
+            }
+            else {
+               const double step_length = residual_squared_norm / curvature;
+               if (step_to_boundary <= step_length) {
+                  // truncate the step at the boundary and fix the variables that hit their bounds
+                  this->take_step(primal_direction, step_to_boundary);
+                  restart = true;
+               }
+               else {
+                  this->take_step(primal_direction, step_length);
+                  for (size_t variable_index: Range(subproblem.number_variables)) {
+                     if (this->is_free[variable_index]) {
+                        this->residual[variable_index] -= step_length * this->hessian_product[variable_index];
+                     }
+                  }
+                  const double new_residual_squared_norm = dot(this->residual, this->residual);
+                  if (std::sqrt(new_residual_squared_norm) <= tolerance) {
+                     termination = true;
+                  }
+                  else {
+                     const double beta = new_residual_squared_norm / residual_squared_norm;
+                     for (size_t variable_index: Range(subproblem.number_variables)) {
+                        this->conjugate_direction[variable_index] = this->residual[variable_index] +
+                           beta * this->conjugate_direction[variable_index];
+                     }
+                     residual_squared_norm = new_residual_squared_norm;
+                  }
+               }
+            }
+         }
+      }
+      DEBUG << "SteihaugCG: " << number_iterations << " iterations\n";
+      statistics.set(this->iterations_column, number_iterations);
+
+      this->compute_bound_multipliers(direction);
+      direction.subproblem_objective = dot(objective_gradient, primal_direction) + 0.5 * dot(primal_direction, hessian_direction_product);
+      direction.status = SubproblemStatus::OPTIMAL;
+   }
+
+   EvaluationSpace& SteihaugCGSolver::get_evaluation_space() {
+      return this->evaluation_space;
+   }
+
+   // protected member functions
+
+   void SteihaugCGSolver::compute_hessian_vector_product(const Subproblem& subproblem, const Vector<double>& vector,
+         Vector<double>& result) const {
+      // the Hessian operator only writes the entries of the variables it knows about
+      result.fill(0.);
+      subproblem.compute_hessian_vector_product(subproblem.current_iterate.primals.data(), vector.data(), result.data());
+   }
+
+   // a variable is fixed if it sits at one of its bounds and the gradient of the model pushes it outwards
+   void SteihaugCGSolver::determine_free_variables(const Vector<double>& primal_direction) {
+      for (size_t variable_index: Range(this->variable_lower_bounds.size())) {
+         const double model_gradient = this->evaluation_space.objective_gradient[variable_index] +
+            this->evaluation_space.hessian_direction_product[variable_index];
+         const bool at_lower_bound = (primal_direction[variable_index] <= this->variable_lower_bounds[variable_index] + this->activity_tolerance);
+         const bool at_upper_bound = (this->variable_upper_bounds[variable_index] - this->activity_tolerance <= primal_direction[variable_index]);
+         this->is_free[variable_index] = !(at_lower_bound && at_upper_bound) && !(at_lower_bound && 0. < model_gradient) &&
+            !(at_upper_bound && model_gradient < 0.);
+      }
+   }
+
+   // largest step along the conjugate direction that remains within the bounds
+   double SteihaugCGSolver::compute_step_to_boundary(const Vector<double>& primal_direction) const {
+      double step_to_boundary = INF<double>;
+      for (size_t variable_index: Range(this->variable_lower_bounds.size())) {
+         const double component = this->conjugate_direction[variable_index];
+         if (0. < component) {
+            step_to_boundary = std::min(step_to_boundary,
+               (this->variable_upper_bounds[variable_index] - primal_direction[variable_index]) / component);
+         }
+         else if (component < 0.) {
+            step_to_boundary = std::min(step_to_boundary,
+               (this->variable_lower_bounds[variable_index] - primal_direction[variable_index]) / component);
+         }
+      }
+      return std::max(0., step_to_boundary);
+   }
+
+   // move along the conjugate direction and update the product of the Hessian with the primal direction
+   void SteihaugCGSolver::take_step(Vector<double>& primal_direction, double step_length) {
+      for (size_t variable_index: Range(this->variable_lower_bounds.size())) {
+         // projection onto the bounds gets rid of the roundoff errors at the boundary
+         const double lower_bound = this->variable_lower_bounds[variable_index];
+         const double upper_bound = this->variable_upper_bounds[variable_index];
+         double& component = primal_direction[variable_index];
+         component = std::min(std::max(lower_bound, component + step_length * this->conjugate_direction[variable_index]), upper_bound);
+         if (component <= lower_bound + this->activity_tolerance) {
+            component = lower_bound;
+         }
+         else if (upper_bound - this->activity_tolerance <= component) {
+            component = upper_bound;
+         }
+         this->evaluation_space.hessian_direction_product[variable_index] += step_length * this->hessian_product[variable_index];
+      }
+   }
+
+   // the bound multipliers are the components of the model gradient at the active bounds
+   void SteihaugCGSolver::compute_bound_multipliers(Direction& direction) const {
+      for (size_t variable_index: Range(this->variable_lower_bounds.size())) {
+         const double model_gradient = this->evaluation_space.objective_gradient[variable_index] +
+            this->evaluation_space.hessian_direction_product[variable_index];
+         direction.multipliers.lower_bounds[variable_index] = 0.;
+         direction.multipliers.upper_bounds[variable_index] = 0.;
+         if (direction.primals[variable_index] <= this->variable_lower_bounds[variable_index] + this->activity_tolerance &&
+               0. < model_gradient) {
+            direction.multipliers.lower_bounds[variable_index] = model_gradient;
+         }
+         else if (this->variable_upper_bounds[variable_index] - this->activity_tolerance <= direction.primals[variable_index] &&
+               model_gradient < 0.) {
+            direction.multipliers.upper_bounds[variable_index] = model_gradient;
+         }
+      }
+   }
+} // namespace
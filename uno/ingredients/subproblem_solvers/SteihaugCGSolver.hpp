@@ -0,0 +1,73 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_STEIHAUGCGSOLVER_H
+#define UNO_STEIHAUGCGSOLVER_H
+
+#include <vector>
+#include "InequalityConstrainedSolver.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "optimization/EvaluationSpace.hpp"
+#include "tools/Statistics.hpp"
+
+namespace uno {
+   // forward declaration
+   class Options;
+
+   class SteihaugCGEvaluationSpace: public EvaluationSpace {
+   public:
+      SteihaugCGEvaluationSpace() = default;
+
+      void evaluate_constraint_jacobian(const OptimizationProblem& /*problem*/, Iterate& /*iterate*/) override { }
+      void compute_constraint_jacobian_vector_product(const Vector<double>& /*vector*/, Vector<double>& /*result*/) const override { }
+      void compute_constraint_jacobian_transposed_vector_product(const Vector<double>& /*vector*/,
+         Vector<double>& /*result*/) const override { }
+      // the Hessian is not available: the product H*d along the last direction d is used instead
+      [[nodiscard]] double compute_hessian_quadratic_product(const Vector<double>& vector) const override;
+
+      Vector<double> objective_gradient{};
+      Vector<double> hessian_direction_product{};
+   };
+
+   // Steihaug-Toint truncated conjugate gradient method for QP subproblems with bound constraints only.
+   // The Hessian is accessed through Hessian-vector products only. The iterations are projected onto the variable bounds
+   // (intersected with the trust region): when a CG step leaves the box, the direction is truncated at the boundary, the
+   // variables that hit a bound are fixed and CG is restarted on the free variables. Directions of nonpositive curvature
+   // are followed up to the boundary of the box
+   class SteihaugCGSolver: public InequalityConstrainedSolver {
+   public:
+      explicit SteihaugCGSolver(const Options& options);
+      ~SteihaugCGSolver() override = default;
+
+      void initialize_memory(const Subproblem& subproblem) override;
+      void initialize_statistics(Statistics& statistics, const Options& options) override;
+
+      void solve(Statistics& statistics, Subproblem& subproblem, const Vector<double>& initial_point,
+         Direction& direction, const WarmstartInformation& warmstart_information) override;
+
+      [[nodiscard]] EvaluationSpace& get_evaluation_space() override;
+
+   protected:
+      const size_t maximum_number_iterations;
+      const double forcing_term_max;
+      // tolerance below which a variable is considered at one of its bounds
+      static constexpr double activity_tolerance{1e-12};
+      std::vector<double> variable_lower_bounds{};
+      std::vector<double> variable_upper_bounds{};
+      SteihaugCGEvaluationSpace evaluation_space{};
+      // CG vectors
+      Vector<double> residual{};
+      Vector<double> conjugate_direction{};
+      Vector<double> hessian_product{};
+      std::vector<bool> is_free{};
+      Statistics::ColumnHandle iterations_column{};
+
+      void compute_hessian_vector_product(const Subproblem& subproblem, const Vector<double>& vector, Vector<double>& result) const;
+      void determine_free_variables(const Vector<double>& primal_direction);
+      [[nodiscard]] double compute_step_to_boundary(const Vector<double>& primal_direction) const;
+      void take_step(Vector<double>& primal_direction, double step_length);
+      void compute_bound_multipliers(Direction& direction) const;
+   };
+} // namespace
+
+#endif // UNO_STEIHAUGCGSOLVER_H
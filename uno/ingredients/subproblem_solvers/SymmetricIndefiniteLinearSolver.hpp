@@ -5,11 +5,13 @@
 #define UNO_SYMMETRICINDEFINITELINEARSOLVER_H
 
 #include <cstddef>
+#include <stdexcept>
 
 namespace uno {
    // forward declarations
    class Direction;
    class EvaluationSpace;
+   class Options;
    class Statistics;
    class Subproblem;
    template <typename ElementType>
@@ -24,11 +26,17 @@ namespace uno {
 
       virtual void initialize_hessian(const Subproblem& subproblem) = 0;
       virtual void initialize_augmented_system(const Subproblem& subproblem) = 0;
+      virtual void initialize_statistics(Statistics& /*statistics*/, const Options& /*options*/) { }
 
       virtual void solve_indefinite_system(const Vector<double>& matrix_values, const Vector<ElementType>& rhs,
          Vector<ElementType>& result) = 0;
       virtual void solve_indefinite_system(Statistics& statistics, const Subproblem& subproblem, Direction& direction,
          const WarmstartInformation& warmstart_information) = 0;
+      // solve the last factorized augmented system with another right-hand side (e.g. for a sensitivity analysis)
+      virtual void solve_augmented_system(const Vector<ElementType>& /*rhs*/, Vector<ElementType>& /*result*/) {
+         throw std::runtime_error("The linear solver cannot solve the last augmented system with another right-hand side");
+      }
+      [[nodiscard]] virtual bool matrix_is_singular() const = 0;
 
       [[nodiscard]] virtual EvaluationSpace& get_evaluation_space() = 0;
    };
@@ -5,7 +5,12 @@
 #include <string>
 #include "SymmetricIndefiniteLinearSolverFactory.hpp"
 #include "DirectSymmetricIndefiniteLinearSolver.hpp"
+#include "DenseLDL/DenseLDLSolver.hpp"
+#include "MINRES/MINRESSolver.hpp"
+#include "SchurComplement/SchurComplementSolver.hpp"
 #include "linear_algebra/Vector.hpp"
+#include "options/Options.hpp"
+#include "tools/Logger.hpp"
 
 #if defined(HAS_HSL) || defined(HAS_MA57)
 #include "ingredients/subproblem_solvers/MA57/MA57Solver.hpp"
@@ -28,14 +33,37 @@ namespace uno {
 #endif
 
 namespace uno {
-   std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<double>> SymmetricIndefiniteLinearSolverFactory::create(const std::string& linear_solver) {
+   std::unique_ptr<SymmetricIndefiniteLinearSolver<double>> SymmetricIndefiniteLinearSolverFactory::create(const Options& options,
+         size_t dimension, size_t number_nonzeros) {
+      const std::string& linear_solver = options.get_string("linear_solver");
+      if (linear_solver == "MINRES") {
+         return std::make_unique<MINRESSolver>(options);
+      }
+      return SymmetricIndefiniteLinearSolverFactory::create(linear_solver, options, dimension, number_nonzeros);
+   }
+
+   std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<double>> SymmetricIndefiniteLinearSolverFactory::create(const std::string& linear_solver,
+         const Options& options, size_t dimension, size_t number_nonzeros) {
+      // the setup cost of a sparse solver (symbolic analysis, workspaces) dominates for small and dense systems.
+      // The Schur-complement decomposition is kept when requested, since it exploits the structure of the model
+      const double size_lower_triangle = static_cast<double>(dimension * (dimension + 1)) / 2.;
+      if (linear_solver != "MINRES" && linear_solver != "SchurComplement" && dimension <= options.get_unsigned_int("DenseLDL_max_dimension") &&
+            options.get_double("DenseLDL_min_density") * size_lower_triangle <= static_cast<double>(number_nonzeros)) {
+         DEBUG << "The linear system of dimension " << dimension << " is factorized with the dense LDL^T solver\n";
+         return std::make_unique<DenseLDLSolver>(options);
+      }
+      return SymmetricIndefiniteLinearSolverFactory::create(linear_solver, options);
+   }
+
+   std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<double>> SymmetricIndefiniteLinearSolverFactory::create(const std::string& linear_solver,
+         [[maybe_unused]] const Options& options) {
 #if defined(HAS_HSL) || defined(HAS_MA57)
       if (linear_solver == "MA57"
    #ifdef HAS_HSL
          && LIBHSL_isfunctional()
    #endif
             ) {
-         return std::make_unique<MA57Solver>();
+         return std::make_unique<MA57Solver>(options);
       }
 #endif
 
@@ -45,15 +73,24 @@ namespace uno {
          && LIBHSL_isfunctional()
    # endif
       ) {
-         return std::make_unique<MA27Solver>();
+         return std::make_unique<MA27Solver>(options);
       }
 #endif // HAS_HSL || HAS_MA27
 
 #ifdef HAS_MUMPS
       if (linear_solver == "MUMPS") {
-         return std::make_unique<MUMPSSolver>();
+         return std::make_unique<MUMPSSolver>(options);
       }
 #endif
+      if (linear_solver == "DenseLDL") {
+         return std::make_unique<DenseLDLSolver>(options);
+      }
+      if (linear_solver == "SchurComplement") {
+         return std::make_unique<SchurComplementSolver>(options);
+      }
+      if (linear_solver == "MINRES") {
+         throw std::invalid_argument("The linear solver MINRES is iterative and does not compute the inertia of the matrix");
+      }
       std::string message = "The linear solver ";
       message.append(linear_solver).append(" is unknown").append("\n").append("The following values are available: ")
             .append(join(SymmetricIndefiniteLinearSolverFactory::available_solvers(), ", "));
@@ -80,6 +117,13 @@ namespace uno {
 #ifdef HAS_MUMPS
       solvers.emplace_back("MUMPS");
 #endif
+      // the dense solver is the default only when no sparse direct solver is available. Otherwise, it replaces the sparse
+      // direct solvers for small and dense systems
+      solvers.emplace_back("DenseLDL");
+      // the Schur-complement decomposition is not a default: it pays off only for block-bordered systems
+      solvers.emplace_back("SchurComplement");
+      // iterative solvers come last and are never picked by default: they require a Hessian operator
+      solvers.emplace_back("MINRES");
       return solvers;
    }
 } // namespace
@@ -4,18 +4,30 @@
 #ifndef UNO_LINEARSOLVERFACTORY_H
 #define UNO_LINEARSOLVERFACTORY_H
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <vector>
 
 namespace uno {
-   // forward declaration
+   // forward declarations
    template <class ElementType>
    class DirectSymmetricIndefiniteLinearSolver;
+   class Options;
+   template <class ElementType>
+   class SymmetricIndefiniteLinearSolver;
 
    class SymmetricIndefiniteLinearSolverFactory {
    public:
-      static std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<double>> create(const std::string& linear_solver);
+      // direct or iterative solver. A small and dense system of the given size is solved with the dense LDL^T solver
+      // instead of a sparse direct solver
+      static std::unique_ptr<SymmetricIndefiniteLinearSolver<double>> create(const Options& options, size_t dimension,
+         size_t number_nonzeros);
+      // direct solver (computes the inertia)
+      static std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<double>> create(const std::string& linear_solver,
+         const Options& options);
+      static std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<double>> create(const std::string& linear_solver,
+         const Options& options, size_t dimension, size_t number_nonzeros);
 
       // return the list of available solvers
       static std::vector<std::string> available_solvers();
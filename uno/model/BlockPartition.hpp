@@ -0,0 +1,26 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_BLOCKPARTITION_H
+#define UNO_BLOCKPARTITION_H
+
+#include <cstddef>
+#include <vector>
+
+namespace uno {
+   // partition of the variables and constraints of a model into independent blocks (e.g. the scenarios of a two-stage
+   // stochastic model or the periods of a multiperiod model), coupled only by linking variables and linking constraints.
+   // An empty partition means that the model does not declare a block structure
+   class BlockPartition {
+   public:
+      static constexpr size_t linking = static_cast<size_t>(-1);
+
+      size_t number_blocks{0};
+      std::vector<size_t> variable_blocks{}; /*!< Block of each variable (or linking) */
+      std::vector<size_t> constraint_blocks{}; /*!< Block of each constraint (or linking) */
+
+      [[nodiscard]] bool is_empty() const { return this->number_blocks == 0; }
+   };
+} // namespace
+
+#endif // UNO_BLOCKPARTITION_H
@@ -97,6 +97,7 @@ namespace uno {
 
       [[nodiscard]] size_t number_jacobian_nonzeros() const override { return this->model.number_jacobian_nonzeros(); }
       [[nodiscard]] size_t number_hessian_nonzeros() const override { return this->model.number_hessian_nonzeros(); }
+      [[nodiscard]] const BlockPartition& get_block_partition() const override { return this->model.get_block_partition(); }
 
    private:
       const Model& model;
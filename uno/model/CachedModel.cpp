@@ -0,0 +1,108 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <string_view>
+#include "CachedModel.hpp"
+
+namespace uno {
+   CachedModel::Entry::Entry(size_t number_variables, size_t number_constraints, size_t number_jacobian_nonzeros):
+         point(number_variables), constraints(number_constraints), objective_gradient(number_variables),
+         constraint_jacobian(number_jacobian_nonzeros) {
+   }
+
+   CachedModel::CachedModel(const Model& original_model, size_t cache_size):
+         Model(original_model.name, original_model.number_variables, original_model.number_constraints,
+            original_model.optimization_sense),
+         model(original_model) {
+      if (cache_size == 0) {
+         throw std::invalid_argument("The evaluation cache should contain at least one point");
+      }
+      this->entries.reserve(cache_size);
+      for (size_t entry_index = 0; entry_index < cache_size; ++entry_index) {
+         this->entries.emplace_back(original_model.number_variables, original_model.number_constraints,
+            original_model.number_jacobian_nonzeros());
+      }
+   }
+
+   double CachedModel::evaluate_objective(const Vector<double>& x) const {
+      Entry& entry = this->find_entry(x);
+      this->count(entry.is_objective_computed);
+      if (!entry.is_objective_computed) {
+         entry.objective = this->model.evaluate_objective(x);
+         entry.is_objective_computed = true;
+      }
+      return entry.objective;
+   }
+
+   void CachedModel::evaluate_constraints(const Vector<double>& x, Vector<double>& constraints) const {
+      Entry& entry = this->find_entry(x);
+      this->count(entry.are_constraints_computed);
+      if (!entry.are_constraints_computed) {
+         this->model.evaluate_constraints(x, entry.constraints);
+         entry.are_constraints_computed = true;
+      }
+      std::copy_n(entry.constraints.data(), this->number_constraints, constraints.data());
+   }
+
+   void CachedModel::evaluate_objective_gradient(const Vector<double>& x, Vector<double>& gradient) const {
+      Entry& entry = this->find_entry(x);
+      this->count(entry.is_objective_gradient_computed);
+      if (!entry.is_objective_gradient_computed) {
+         this->model.evaluate_objective_gradient(x, entry.objective_gradient);
+         entry.is_objective_gradient_computed = true;
+      }
+      std::copy_n(entry.objective_gradient.data(), this->number_variables, gradient.data());
+   }
+
+   void CachedModel::evaluate_constraint_jacobian(const Vector<double>& x, double* jacobian_values) const {
+      Entry& entry = this->find_entry(x);
+      this->count(entry.is_constraint_jacobian_computed);
+      if (!entry.is_constraint_jacobian_computed) {
+         this->model.evaluate_constraint_jacobian(x, entry.constraint_jacobian.data());
+         entry.is_constraint_jacobian_computed = true;
+      }
+      std::copy_n(entry.constraint_jacobian.data(), entry.constraint_jacobian.size(), jacobian_values);
+   }
+
+   // private member functions
+
+   // hash of the bytes of the (original) variables; the vector may contain additional variables (e.g. elastics)
+   size_t CachedModel::hash(const Vector<double>& x) const {
+      const std::string_view bytes{reinterpret_cast<const char*>(x.data()), this->number_variables * sizeof(double)};
+      return std::hash<std::string_view>{}(bytes);
+   }
+
+   // return the entry of the point x. If x is not in the cache, the oldest entry is recycled
+   CachedModel::Entry& CachedModel::find_entry(const Vector<double>& x) const {
+      const size_t hash = this->hash(x);
+      for (Entry& entry: this->entries) {
+         if (entry.is_used && entry.hash == hash &&
+               std::memcmp(entry.point.data(), x.data(), this->number_variables * sizeof(double)) == 0) {
+            return entry;
+         }
+      }
+      Entry& entry = this->entries[this->next_entry_index];
+      this->next_entry_index = (this->next_entry_index + 1) % this->entries.size();
+      entry.hash = hash;
+      entry.is_used = true;
+      std::copy_n(x.data(), this->number_variables, entry.point.data());
+      entry.is_objective_computed = false;
+      entry.are_constraints_computed = false;
+      entry.is_objective_gradient_computed = false;
+      entry.is_constraint_jacobian_computed = false;
+      return entry;
+   }
+
+   void CachedModel::count(bool hit) const {
+      if (hit) {
+         ++this->number_hits;
+      }
+      else {
+         ++this->number_misses;
+      }
+   }
+} // namespace
@@ -0,0 +1,126 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_CACHEDMODEL_H
+#define UNO_CACHEDMODEL_H
+
+#include <vector>
+#include "Model.hpp"
+#include "linear_algebra/Vector.hpp"
+
+namespace uno {
+   // decorator that remembers the evaluations (objective, constraints, objective gradient and constraint Jacobian) at the
+   // last few points, so that a function is not evaluated twice at the same x. This happens when a new Iterate is created at
+   // a known point (phase switches, termination tests, restoration of the current iterate after a rejected step).
+   // The points are identified by a hash of x, then compared bitwise. The Hessian and the linear operators depend on the
+   // multipliers and are not cached
+   class CachedModel: public Model {
+   public:
+      CachedModel(const Model& original_model, size_t cache_size);
+
+      // availability of linear operators
+      [[nodiscard]] bool has_jacobian_operator() const override {
+         return this->model.has_jacobian_operator();
+      }
+
+      [[nodiscard]] bool has_jacobian_transposed_operator() const override {
+         return this->model.has_jacobian_transposed_operator();
+      }
+
+      [[nodiscard]] bool has_hessian_operator() const override {
+         return this->model.has_hessian_operator();
+      }
+
+      [[nodiscard]] bool has_hessian_matrix() const override {
+         return this->model.has_hessian_matrix();
+      }
+
+      // function evaluations (cached)
+      [[nodiscard]] double evaluate_objective(const Vector<double>& x) const override;
+      void evaluate_constraints(const Vector<double>& x, Vector<double>& constraints) const override;
+      void evaluate_objective_gradient(const Vector<double>& x, Vector<double>& gradient) const override;
+      void evaluate_constraint_jacobian(const Vector<double>& x, double* jacobian_values) const override;
+
+      // sparsity patterns of Jacobian and Hessian
+      void compute_constraint_jacobian_sparsity(int* row_indices, int* column_indices, int solver_indexing,
+            MatrixOrder matrix_order) const override {
+         this->model.compute_constraint_jacobian_sparsity(row_indices, column_indices, solver_indexing, matrix_order);
+      }
+
+      void compute_hessian_sparsity(int* row_indices, int* column_indices, int solver_indexing) const override {
+         this->model.compute_hessian_sparsity(row_indices, column_indices, solver_indexing);
+      }
+
+      void evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+            double* hessian_values) const override {
+         this->model.evaluate_lagrangian_hessian(x, objective_multiplier, multipliers, hessian_values);
+      }
+
+      void compute_jacobian_vector_product(const double* x, const double* vector, double* result) const override {
+         this->model.compute_jacobian_vector_product(x, vector, result);
+      }
+
+      void compute_jacobian_transposed_vector_product(const double* x, const double* vector, double* result) const override {
+         this->model.compute_jacobian_transposed_vector_product(x, vector, result);
+      }
+
+      void compute_hessian_vector_product(const double* x, const double* vector, double objective_multiplier,
+            const Vector<double>& multipliers, double* result) const override {
+         this->model.compute_hessian_vector_product(x, vector, objective_multiplier, multipliers, result);
+      }
+
+      [[nodiscard]] double variable_lower_bound(size_t variable_index) const override { return this->model.variable_lower_bound(variable_index); }
+      [[nodiscard]] double variable_upper_bound(size_t variable_index) const override { return this->model.variable_upper_bound(variable_index); }
+      [[nodiscard]] const SparseVector<size_t>& get_slacks() const override { return this->model.get_slacks(); }
+      [[nodiscard]] const Vector<size_t>& get_fixed_variables() const override { return this->model.get_fixed_variables(); }
+
+      [[nodiscard]] double constraint_lower_bound(size_t constraint_index) const override { return this->model.constraint_lower_bound(constraint_index); }
+      [[nodiscard]] double constraint_upper_bound(size_t constraint_index) const override { return this->model.constraint_upper_bound(constraint_index); }
+      [[nodiscard]] const Collection<size_t>& get_equality_constraints() const override { return this->model.get_equality_constraints(); }
+      [[nodiscard]] const Collection<size_t>& get_inequality_constraints() const override { return this->model.get_inequality_constraints(); }
+      [[nodiscard]] const Collection<size_t>& get_linear_constraints() const override { return this->model.get_linear_constraints(); }
+
+      void initial_primal_point(Vector<double>& x) const override { this->model.initial_primal_point(x); }
+      void initial_dual_point(Vector<double>& multipliers) const override { this->model.initial_dual_point(multipliers); }
+      void postprocess_solution(Iterate& iterate) const override {
+         this->model.postprocess_solution(iterate);
+      }
+
+      [[nodiscard]] size_t number_jacobian_nonzeros() const override { return this->model.number_jacobian_nonzeros(); }
+      [[nodiscard]] size_t number_hessian_nonzeros() const override { return this->model.number_hessian_nonzeros(); }
+      [[nodiscard]] const BlockPartition& get_block_partition() const override { return this->model.get_block_partition(); }
+
+      [[nodiscard]] size_t get_number_hits() const { return this->number_hits; }
+      [[nodiscard]] size_t get_number_misses() const { return this->number_misses; }
+
+   private:
+      struct Entry {
+         size_t hash{0};
+         bool is_used{false};
+         Vector<double> point;
+         bool is_objective_computed{false};
+         double objective{0.};
+         bool are_constraints_computed{false};
+         Vector<double> constraints;
+         bool is_objective_gradient_computed{false};
+         Vector<double> objective_gradient;
+         bool is_constraint_jacobian_computed{false};
+         Vector<double> constraint_jacobian;
+
+         Entry(size_t number_variables, size_t number_constraints, size_t number_jacobian_nonzeros);
+      };
+
+      const Model& model;
+      // the entries are allocated once and for all and recycled in a round-robin fashion
+      mutable std::vector<Entry> entries{};
+      mutable size_t next_entry_index{0};
+      mutable size_t number_hits{0};
+      mutable size_t number_misses{0};
+
+      [[nodiscard]] size_t hash(const Vector<double>& x) const;
+      [[nodiscard]] Entry& find_entry(const Vector<double>& x) const;
+      void count(bool hit) const;
+   };
+} // namespace
+
+#endif // UNO_CACHEDMODEL_H
@@ -13,6 +13,14 @@ namespace uno {
          model(original_model),
          equality_constraints(concatenate(this->model.get_equality_constraints(), Range(this->model.number_constraints, this->number_constraints))),
          linear_constraints(concatenate(this->model.get_linear_constraints(), Range(this->model.number_constraints, this->number_constraints))) {
+      // the constraint of a fixed variable belongs to the block of the variable
+      const BlockPartition& original_partition = this->model.get_block_partition();
+      if (!original_partition.is_empty()) {
+         this->block_partition = original_partition;
+         for (size_t fixed_variable_index: this->model.get_fixed_variables()) {
+            this->block_partition.constraint_blocks.push_back(original_partition.variable_blocks[fixed_variable_index]);
+         }
+      }
    }
 
    bool FixedBoundsConstraintsModel::has_jacobian_operator() const {
@@ -197,6 +205,8 @@ namespace uno {
          }
          ++current_constraint;
       }
+      // discard the constraints of the fixed variables
+      iterate.number_constraints = this->model.number_constraints;
       this->model.postprocess_solution(iterate);
    }
 
@@ -207,4 +217,8 @@ namespace uno {
    size_t FixedBoundsConstraintsModel::number_hessian_nonzeros() const {
       return this->model.number_hessian_nonzeros();
    }
+
+   const BlockPartition& FixedBoundsConstraintsModel::get_block_partition() const {
+      return this->block_partition;
+   }
 } // namespace
\ No newline at end of file
@@ -4,6 +4,7 @@
 #ifndef UNO_FIXEDBOUNDSCONSTRAINTSMODEL_H
 #define UNO_FIXEDBOUNDSCONSTRAINTSMODEL_H
 
+#include "BlockPartition.hpp"
 #include "Model.hpp"
 #include "linear_algebra/Vector.hpp"
 #include "symbolic/Concatenation.hpp"
@@ -67,12 +68,14 @@ namespace uno {
 
       [[nodiscard]] size_t number_jacobian_nonzeros() const override;
       [[nodiscard]] size_t number_hessian_nonzeros() const override;
+      [[nodiscard]] const BlockPartition& get_block_partition() const override;
 
    private:
       const Model& model;
       Vector<size_t> fixed_variables{};
       Concatenation<const Collection<size_t>&, ForwardRange> equality_constraints;
       Concatenation<const Collection<size_t>&, ForwardRange> linear_constraints;
+      BlockPartition block_partition{};
    };
 } // namespace
 
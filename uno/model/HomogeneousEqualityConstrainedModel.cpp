@@ -28,6 +28,14 @@ namespace uno {
          this->slacks.insert(constraint_index, slack_variable_index);
          ++inequality_index;
       }
+      // the slack of a constraint belongs to the block of the constraint
+      const BlockPartition& original_partition = this->model.get_block_partition();
+      if (!original_partition.is_empty()) {
+         this->block_partition = original_partition;
+         for (const size_t constraint_index: this->constraint_index_of_inequality_index) {
+            this->block_partition.variable_blocks.push_back(original_partition.constraint_blocks[constraint_index]);
+         }
+      }
    }
 
    bool HomogeneousEqualityConstrainedModel::has_jacobian_operator() const {
@@ -200,4 +208,8 @@ namespace uno {
    size_t HomogeneousEqualityConstrainedModel::number_hessian_nonzeros() const {
       return this->model.number_hessian_nonzeros();
    }
+
+   const BlockPartition& HomogeneousEqualityConstrainedModel::get_block_partition() const {
+      return this->block_partition;
+   }
 } // namespace
\ No newline at end of file
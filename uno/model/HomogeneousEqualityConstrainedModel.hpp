@@ -4,6 +4,7 @@
 #ifndef UNO_HOMOGENEOUSEQUALITYCONSTRAINEDMODEL_H
 #define UNO_HOMOGENEOUSEQUALITYCONSTRAINEDMODEL_H
 
+#include "BlockPartition.hpp"
 #include "Model.hpp"
 #include "linear_algebra/SparseVector.hpp"
 
@@ -62,6 +63,7 @@ namespace uno {
 
       [[nodiscard]] size_t number_jacobian_nonzeros() const override;
       [[nodiscard]] size_t number_hessian_nonzeros() const override;
+      [[nodiscard]] const BlockPartition& get_block_partition() const override;
 
    protected:
       const Model& model;
@@ -71,6 +73,7 @@ namespace uno {
       ForwardRange equality_constraints;
       ForwardRange inequality_constraints;
       SparseVector<size_t> slacks;
+      BlockPartition block_partition{};
    };
 } // namespace
 
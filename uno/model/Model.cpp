@@ -4,6 +4,7 @@
 #include <cmath>
 #include <utility>
 #include "Model.hpp"
+#include "BlockPartition.hpp"
 #include "linear_algebra/Vector.hpp"
 #include "tools/Infinity.hpp"
 #include "tools/Logger.hpp"
@@ -21,6 +22,11 @@ namespace uno {
       }
    }
 
+   const BlockPartition& Model::get_block_partition() const {
+      static const BlockPartition empty_partition{};
+      return empty_partition;
+   }
+
    bool Model::is_constrained() const {
       return (0 < this->number_constraints);
    }
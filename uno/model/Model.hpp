@@ -13,6 +13,7 @@
 
 namespace uno {
    // forward declarations
+   class BlockPartition;
    template <typename ElementType>
    class Collection;
    template <typename ElementType>
@@ -84,6 +85,9 @@ namespace uno {
       [[nodiscard]] virtual size_t number_jacobian_nonzeros() const = 0;
       [[nodiscard]] virtual size_t number_hessian_nonzeros() const = 0;
 
+      // block structure of the variables and constraints (empty by default)
+      [[nodiscard]] virtual const BlockPartition& get_block_partition() const;
+
       // auxiliary functions
       void project_onto_variable_bounds(Vector<double>& x) const;
       [[nodiscard]] bool is_constrained() const;
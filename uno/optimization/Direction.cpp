@@ -29,6 +29,8 @@ namespace uno {
             return "unbounded subproblem";
          case SubproblemStatus::INFEASIBLE:
             return "infeasible subproblem";
+         case SubproblemStatus::ERROR:
+            return "solver error";
          default:
             return "unknown status, something went wrong";
       }
@@ -14,6 +14,7 @@ namespace uno {
             Vector<double> constraints; /*!< Constraint values (size \f$m)\f$ */
             std::vector<double> linearized_constraints;
             Vector<double> objective_gradient; /*!< Sparse Jacobian of the objective */
+            Vector<double> constraint_jacobian{}; /*!< Values of the constraint Jacobian of the model (sized upon evaluation) */
 
             Evaluations(size_t number_variables, size_t number_constraints):
                   constraints(number_constraints),
@@ -8,10 +8,10 @@
 #include "optimization/EvaluationErrors.hpp"
 
 namespace uno {
-   size_t Iterate::number_eval_objective = 0;
-   size_t Iterate::number_eval_constraints = 0;
-   size_t Iterate::number_eval_objective_gradient = 0;
-   size_t Iterate::number_eval_jacobian = 0;
+   thread_local size_t Iterate::number_eval_objective = 0;
+   thread_local size_t Iterate::number_eval_constraints = 0;
+   thread_local size_t Iterate::number_eval_objective_gradient = 0;
+   thread_local size_t Iterate::number_eval_jacobian = 0;
 
    Iterate::Iterate(size_t number_variables, size_t number_constraints) :
          number_variables(number_variables), number_constraints(number_constraints),
@@ -58,6 +58,19 @@ namespace uno {
       }
    }
 
+   // the Jacobian values are stored in the iterate, so that the problems of the different phases (e.g. optimality and
+   // feasibility restoration) share a single evaluation
+   void Iterate::evaluate_constraint_jacobian(const Model& model) {
+      if (!this->is_constraint_jacobian_computed) {
+         if (model.is_constrained()) {
+            this->evaluations.constraint_jacobian.resize(model.number_jacobian_nonzeros());
+            model.evaluate_constraint_jacobian(this->primals, this->evaluations.constraint_jacobian.data());
+            ++Iterate::number_eval_jacobian;
+         }
+         this->is_constraint_jacobian_computed = true;
+      }
+   }
+
    void Iterate::set_number_variables(size_t new_number_variables) {
       this->number_variables = new_number_variables;
       this->primals.resize(new_number_variables);
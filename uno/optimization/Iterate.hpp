@@ -29,10 +29,11 @@ namespace uno {
 
       // evaluations
       Evaluations evaluations;
-      static size_t number_eval_objective;
-      static size_t number_eval_constraints;
-      static size_t number_eval_objective_gradient;
-      static size_t number_eval_jacobian;
+      // evaluation counters (per thread, so that several models can be solved concurrently)
+      static thread_local size_t number_eval_objective;
+      static thread_local size_t number_eval_constraints;
+      static thread_local size_t number_eval_objective_gradient;
+      static thread_local size_t number_eval_jacobian;
       // lazy evaluation flags
       bool is_objective_computed{false};
       bool are_constraints_computed{false};
@@ -44,7 +45,7 @@ namespace uno {
       DualResiduals residuals;
 
       // measures of progress (infeasibility, objective, auxiliary)
-      ProgressMeasures progress{INF<double>, {}, INF<double>};
+      ProgressMeasures progress{INF<double>, {0., INF<double>}, INF<double>};
 
       // status
       SolutionStatus status{SolutionStatus::NOT_OPTIMAL};
@@ -52,6 +53,7 @@ namespace uno {
       void evaluate_objective(const Model& model);
       void evaluate_constraints(const Model& model);
       void evaluate_objective_gradient(const Model& model);
+      void evaluate_constraint_jacobian(const Model& model);
 
       void set_number_variables(size_t number_variables);
 
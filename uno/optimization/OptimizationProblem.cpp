@@ -59,7 +59,10 @@ namespace uno {
    }
 
    void OptimizationProblem::evaluate_constraint_jacobian(Iterate& iterate, double* jacobian_values) const {
-      this->model.evaluate_constraint_jacobian(iterate.primals, jacobian_values);
+      iterate.evaluate_constraint_jacobian(this->model);
+      for (size_t nonzero_index: Range(this->model.number_jacobian_nonzeros())) {
+         jacobian_values[nonzero_index] = iterate.evaluations.constraint_jacobian[nonzero_index];
+      }
    }
 
    // Lagrangian gradient ∇f(x_k) - ∇c(x_k) y_k - z_k
@@ -96,6 +99,13 @@ namespace uno {
          multipliers.constraints, result);
    }
 
+   void OptimizationProblem::evaluate_diagonal_hessian_terms(const double* /*x*/, const Multipliers& /*multipliers*/,
+         double* diagonal) const {
+      for (size_t variable_index: Range(this->number_variables)) {
+         diagonal[variable_index] = 0.;
+      }
+   }
+
    size_t OptimizationProblem::get_number_original_variables() const {
       return this->model.number_variables;
    }
@@ -136,6 +146,10 @@ namespace uno {
       return this->dual_regularization_constraints;
    }
 
+   const Collection<size_t>& OptimizationProblem::get_condensable_variables() const {
+      return this->condensable_variables;
+   }
+
    void OptimizationProblem::assemble_primal_dual_direction(const Iterate& /*current_iterate*/, const Vector<double>& /*solution*/,
          Direction& /*direction*/) const {
    }
@@ -58,6 +58,8 @@ namespace uno {
          const Multipliers& multipliers, double* hessian_values) const;
       virtual void compute_hessian_vector_product(HessianModel& hessian_model, const double* x, const double* vector,
          const Multipliers& multipliers, double* result) const;
+      // diagonal terms of the Lagrangian Hessian known in closed form (e.g. barrier terms), without evaluating the Hessian
+      virtual void evaluate_diagonal_hessian_terms(const double* x, const Multipliers& multipliers, double* diagonal) const;
 
       [[nodiscard]] size_t get_number_original_variables() const;
       [[nodiscard]] virtual double variable_lower_bound(size_t variable_index) const;
@@ -70,6 +72,9 @@ namespace uno {
       [[nodiscard]] virtual const Collection<size_t>& get_equality_constraints() const;
       [[nodiscard]] virtual const Collection<size_t>& get_inequality_constraints() const;
       [[nodiscard]] virtual const Collection<size_t>& get_dual_regularization_constraints() const;
+      // variables that appear linearly in a single constraint and whose Hessian term is diagonal (e.g. elastic variables).
+      // They can be eliminated from the augmented system
+      [[nodiscard]] virtual const Collection<size_t>& get_condensable_variables() const;
 
       virtual void assemble_primal_dual_direction(const Iterate& current_iterate, const Vector<double>& solution, Direction& direction) const;
       [[nodiscard]] virtual double dual_regularization_factor() const;
@@ -85,6 +90,7 @@ namespace uno {
    protected:
       const ForwardRange primal_regularization_variables;
       const ForwardRange dual_regularization_constraints;
+      const ForwardRange condensable_variables{0};
    };
 } // namespace
 
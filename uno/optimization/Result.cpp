@@ -28,6 +28,7 @@ namespace uno {
                this->number_variables));
       }
 
+      DISCRETE << "Wall-clock time:\t\t\t" << this->wall_time << "s\n";
       DISCRETE << "CPU time:\t\t\t\t" << this->cpu_time << "s\n";
       DISCRETE << "Iterations:\t\t\t\t" << this->number_iterations << '\n';
       DISCRETE << "Objective evaluations:\t\t\t" << this->number_objective_evaluations << '\n';
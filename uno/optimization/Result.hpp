@@ -24,6 +24,7 @@ namespace uno {
       Vector<double> lower_bound_dual_solution;
       Vector<double> upper_bound_dual_solution;
       const size_t number_iterations;
+      const double wall_time;
       const double cpu_time;
       const size_t number_objective_evaluations;
       const size_t number_constraint_evaluations;
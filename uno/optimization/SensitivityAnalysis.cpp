@@ -0,0 +1,125 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <stdexcept>
+#include "SensitivityAnalysis.hpp"
+#include "ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategy.hpp"
+#include "linear_algebra/SparseVector.hpp"
+#include "model/Model.hpp"
+#include "optimization/Iterate.hpp"
+#include "optimization/Multipliers.hpp"
+#include "symbolic/Range.hpp"
+#include "tools/Infinity.hpp"
+
+namespace uno {
+   void SensitivityAnalysis::reset() {
+      this->initialized = false;
+      this->number_original_variables = 0;
+      this->number_original_constraints = 0;
+      this->fixed_variables.clear();
+   }
+
+   void SensitivityAnalysis::initialize(const Model& reformulated_model, const Iterate& solution) {
+      this->number_variables = reformulated_model.number_variables;
+      this->number_constraints = reformulated_model.number_constraints;
+      this->lower_bound_barrier_terms.resize(this->number_variables);
+      this->upper_bound_barrier_terms.resize(this->number_variables);
+      for (size_t variable_index: Range(this->number_variables)) {
+         const double lower_bound = reformulated_model.variable_lower_bound(variable_index);
+         const double upper_bound = reformulated_model.variable_upper_bound(variable_index);
+         const double primal = solution.primals[variable_index];
+         this->lower_bound_barrier_terms[variable_index] = is_finite(lower_bound) ?
+            solution.multipliers.lower_bounds[variable_index] / (primal - lower_bound) : 0.;
+         this->upper_bound_barrier_terms[variable_index] = is_finite(upper_bound) ?
+            solution.multipliers.upper_bounds[variable_index] / (primal - upper_bound) : 0.;
+      }
+      this->slack_of_constraint.assign(this->number_constraints, SensitivityAnalysis::no_slack);
+      for (const auto [constraint_index, slack_index]: reformulated_model.get_slacks()) {
+         this->slack_of_constraint[constraint_index] = slack_index;
+      }
+      this->constraint_multipliers = solution.multipliers.constraints;
+      this->rhs.resize(this->number_variables + this->number_constraints);
+      this->solution.resize(this->number_variables + this->number_constraints);
+      this->initialized = true;
+   }
+
+   void SensitivityAnalysis::set_original_model(const Model& original_model) {
+      this->number_original_variables = original_model.number_variables;
+      this->number_original_constraints = original_model.number_constraints;
+      const Vector<size_t>& model_fixed_variables = original_model.get_fixed_variables();
+      this->fixed_variables.assign(model_fixed_variables.begin(), model_fixed_variables.end());
+   }
+
+   bool SensitivityAnalysis::is_available() const {
+      return this->initialized;
+   }
+
+   void SensitivityAnalysis::compute(ConstraintRelaxationStrategy& constraint_relaxation_strategy,
+         const BoundPerturbation& perturbation, Vector<double>& primal_sensitivity, Multipliers& dual_sensitivity) {
+      if (!this->initialized) {
+         throw std::runtime_error("The sensitivity analysis is not available: the KKT matrix was not factorized at the solution");
+      }
+      const size_t n = this->number_original_variables;
+      const size_t m = this->number_original_constraints;
+      if (perturbation.variables_lower_bounds.size() != n || perturbation.variables_upper_bounds.size() != n ||
+            perturbation.constraints_lower_bounds.size() != m || perturbation.constraints_upper_bounds.size() != m) {
+         throw std::runtime_error("The dimensions of the bound perturbation do not match those of the model");
+      }
+
+      // right-hand side: the original variables are the first variables of the reformulated model. The fixed variables
+      // have infinite bounds (no barrier terms) and their perturbation is that of the right-hand side of their constraint
+      this->rhs.fill(0.);
+      for (size_t variable_index: Range(n)) {
+         this->rhs[variable_index] = this->lower_bound_barrier_terms[variable_index] * perturbation.variables_lower_bounds[variable_index] +
+            this->upper_bound_barrier_terms[variable_index] * perturbation.variables_upper_bounds[variable_index];
+      }
+      for (size_t constraint_index: Range(m)) {
+         const size_t slack_index = this->slack_of_constraint[constraint_index];
+         if (slack_index == SensitivityAnalysis::no_slack) {
+            // equality constraint
+            this->rhs[this->number_variables + constraint_index] = perturbation.constraints_lower_bounds[constraint_index];
+         }
+         else {
+            // the bounds of an inequality constraint are those of its slack
+            this->rhs[slack_index] = this->lower_bound_barrier_terms[slack_index] * perturbation.constraints_lower_bounds[constraint_index] +
+               this->upper_bound_barrier_terms[slack_index] * perturbation.constraints_upper_bounds[constraint_index];
+         }
+      }
+      for (size_t fixed_index: Range(this->fixed_variables.size())) {
+         const size_t variable_index = this->fixed_variables[fixed_index];
+         this->rhs[this->number_variables + m + fixed_index] = perturbation.variables_lower_bounds[variable_index];
+      }
+
+      // single solve with the factorization of the KKT matrix at the solution: the solution is [dx; -dy]
+      constraint_relaxation_strategy.solve_optimality_kkt_system(this->rhs, this->solution);
+
+      primal_sensitivity.resize(n);
+      dual_sensitivity.lower_bounds.resize(n);
+      dual_sensitivity.upper_bounds.resize(n);
+      dual_sensitivity.constraints.resize(m);
+      for (size_t variable_index: Range(n)) {
+         const double primal_direction = this->solution[variable_index];
+         primal_sensitivity[variable_index] = primal_direction;
+         // linearized complementarity: dz = -Sigma (dx - dx_bound)
+         dual_sensitivity.lower_bounds[variable_index] = -this->lower_bound_barrier_terms[variable_index] *
+            (primal_direction - perturbation.variables_lower_bounds[variable_index]);
+         dual_sensitivity.upper_bounds[variable_index] = -this->upper_bound_barrier_terms[variable_index] *
+            (primal_direction - perturbation.variables_upper_bounds[variable_index]);
+      }
+      for (size_t constraint_index: Range(m)) {
+         dual_sensitivity.constraints[constraint_index] = -this->solution[this->number_variables + constraint_index];
+      }
+      // the multipliers of the fixed variables are those of their constraints (see FixedBoundsConstraintsModel)
+      for (size_t fixed_index: Range(this->fixed_variables.size())) {
+         const size_t variable_index = this->fixed_variables[fixed_index];
+         const size_t constraint_index = m + fixed_index;
+         const double dual_direction = -this->solution[this->number_variables + constraint_index];
+         if (0. < this->constraint_multipliers[constraint_index]) {
+            dual_sensitivity.lower_bounds[variable_index] = dual_direction;
+         }
+         else {
+            dual_sensitivity.upper_bounds[variable_index] = dual_direction;
+         }
+      }
+   }
+} // namespace
@@ -0,0 +1,70 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_SENSITIVITYANALYSIS_H
+#define UNO_SENSITIVITYANALYSIS_H
+
+#include <cstddef>
+#include <vector>
+#include "linear_algebra/Vector.hpp"
+
+namespace uno {
+   // forward declarations
+   class ConstraintRelaxationStrategy;
+   class Iterate;
+   class Model;
+   class Multipliers;
+
+   // perturbation of the bounds of the original model. The perturbation of an equality constraint or of a fixed variable
+   // (e.g. a parameter) is that of its lower bound
+   struct BoundPerturbation {
+      Vector<double> variables_lower_bounds{};
+      Vector<double> variables_upper_bounds{};
+      Vector<double> constraints_lower_bounds{};
+      Vector<double> constraints_upper_bounds{};
+   };
+
+   // first-order sensitivity of the primal-dual solution of the interior-point method with respect to the bounds (as in
+   // sIPOPT). A perturbation of the bounds only changes the right-hand side of the KKT system of the barrier problem:
+   //   [W + Sigma  J^T] [ dx]   [Sigma_L dx_L + Sigma_U dx_U]
+   //   [J          0  ] [-dy] = [dc                         ]
+   // where Sigma_L = z_L / (x - x_L) and Sigma_U = z_U / (x - x_U) are the barrier terms (slacks included) and dc is the
+   // perturbation of the right-hand sides of the equality constraints. Each perturbation is thus a single solve with the
+   // factorization of the KKT matrix at the solution. The bound multipliers follow from the linearized complementarity
+   class SensitivityAnalysis {
+   public:
+      SensitivityAnalysis() = default;
+
+      void reset();
+      // record the barrier terms at the solution of the reformulated model (before postprocessing)
+      void initialize(const Model& reformulated_model, const Iterate& solution);
+      // record the dimensions and the fixed variables of the original model. The fixed variables were moved to the
+      // general constraints (after the original constraints) by the reformulation
+      void set_original_model(const Model& original_model);
+      [[nodiscard]] bool is_available() const;
+
+      void compute(ConstraintRelaxationStrategy& constraint_relaxation_strategy, const BoundPerturbation& perturbation,
+         Vector<double>& primal_sensitivity, Multipliers& dual_sensitivity);
+
+   protected:
+      static constexpr size_t no_slack = static_cast<size_t>(-1);
+
+      bool initialized{false};
+      // reformulated model
+      size_t number_variables{0};
+      size_t number_constraints{0};
+      Vector<double> lower_bound_barrier_terms{}; /*!< Sigma_L */
+      Vector<double> upper_bound_barrier_terms{}; /*!< Sigma_U */
+      std::vector<size_t> slack_of_constraint{};
+      Vector<double> constraint_multipliers{};
+      // original model
+      size_t number_original_variables{0};
+      size_t number_original_constraints{0};
+      std::vector<size_t> fixed_variables{};
+      // KKT system
+      Vector<double> rhs{};
+      Vector<double> solution{};
+   };
+} // namespace
+
+#endif // UNO_SENSITIVITYANALYSIS_H
@@ -21,8 +21,10 @@ namespace uno {
       options.set("loose_tolerance_consecutive_iteration_threshold", "15");
       // maximum outer iterations
       options.set("max_iterations", "2000");
-      // CPU time limit (in seconds)
+      // wall-clock time limit (in seconds)
       options.set("time_limit", "inf");
+      // CPU time limit (in seconds), summed over all threads
+      options.set("cpu_time_limit", "inf");
       // print optimal solution (yes|no)
       options.set("print_solution", "no");
       // threshold on objective to declare unbounded NLP
@@ -40,6 +42,9 @@ namespace uno {
       options.set("statistics_LS_step_length_column_order", "10");
       options.set("statistics_restoration_phase_column_order", "20");
       options.set("statistics_regularization_column_order", "21");
+      options.set("statistics_linear_solver_iterations_column_order", "22");
+      options.set("statistics_refinement_steps_column_order", "23");
+      options.set("statistics_backward_error_column_order", "24");
       options.set("statistics_funnel_width_column_order", "25");
       options.set("statistics_step_norm_column_order", "31");
       options.set("statistics_objective_column_order", "100");
@@ -48,10 +53,20 @@ namespace uno {
       options.set("statistics_stationarity_column_order", "104");
       options.set("statistics_complementarity_column_order", "105");
       options.set("statistics_status_column_order", "200");
+      // file into which the iterations are logged in a machine-readable format (empty: no log)
+      options.set("iteration_log_file", "");
+      // format of the iteration log (json|csv)
+      options.set("iteration_log_format", "json");
 
       /** main options **/
       // logging level (SILENT|DISCRETE|WARNING|INFO|DEBUG|DEBUG2|DEBUG3)
       options.set("logger", "INFO");
+      // file into which the messages are logged (empty: standard output)
+      options.set("log_file", "");
+      // number of points at which the evaluations are remembered (0: no evaluation cache)
+      options.set("evaluation_cache_size", "0");
+      // factorize the KKT matrix at the solution to compute parametric sensitivities after the solve (yes|no)
+      options.set("sensitivity_analysis", "no");
       // Hessian model (exact|zero)
       options.set("hessian_model", "exact");
       options.set("regularization_strategy", "primal");
@@ -162,10 +177,77 @@ namespace uno {
       options.set("barrier_push_variable_to_interior_k1", "1e-2");
       options.set("barrier_push_variable_to_interior_k2", "1e-2");
       options.set("barrier_damping_factor", "1e-5");
+      // eliminate the elastic variables of the l1 relaxation from the augmented system (direct linear solvers only)
+      options.set("barrier_condense_elastic_variables", "yes");
+      // eliminate the slacks of the inequality constraints from the augmented system (direct linear solvers only).
+      // The condensed slacks are not regularized
+      options.set("barrier_condense_slacks", "no");
       options.set("least_square_multiplier_max_norm", "1e3");
 
+      /** MINRES options **/
+      options.set("MINRES_max_iterations", "1000");
+      // the relative residual tolerance is min(max, ||residual of the optimality conditions||), bounded below by min
+      options.set("MINRES_forcing_term_max", "0.1");
+      options.set("MINRES_forcing_term_min", "1e-10");
+      // inertia-free regularization (the factors are picked by the regularization strategy): minimum curvature
+      // d^T (W + delta I) d / ||d||^2 along the primal direction
+      options.set("MINRES_curvature_threshold", "1e-8");
+
+      /** SteihaugCG options **/
+      // QP solver for subproblems with bound constraints only: SteihaugCG or none (the general QP solver is used)
+      options.set("box_QP_solver", "SteihaugCG");
+      options.set("SteihaugCG_max_iterations", "1000");
+      // the relative residual tolerance is min(max, sqrt(||projected gradient||))
+      options.set("SteihaugCG_forcing_term_max", "0.5");
+
+      /** direct linear solver options **/
+      // the solution of a linear system is refined while its componentwise backward error exceeds the tolerance
+      options.set("linear_solver_refinement_tolerance", "1e-10");
+      // maximum number of iterative refinement steps per linear solve (0: no refinement)
+      options.set("linear_solver_max_refinement_steps", "10");
+      // the refinement stalls when a step does not reduce the backward error by this factor. The matrix is then
+      // factorized again with a tighter pivoting threshold
+      options.set("linear_solver_refinement_stall_factor", "0.5");
+
+      /** DenseLDL options **/
+      // a system of dimension at most DenseLDL_max_dimension whose density (nonzeros / size of the lower triangle) is
+      // at least DenseLDL_min_density is factorized with the dense LDL^T solver instead of the sparse direct solver
+      options.set("DenseLDL_max_dimension", "100");
+      options.set("DenseLDL_min_density", "0.1");
+
+      /** SchurComplement options **/
+      // number of threads that factorize the diagonal blocks (0: one per hardware thread). The blocks larger than
+      // DenseLDL_max_dimension are factorized with a sparse direct solver
+      options.set("SchurComplement_number_threads", "0");
+      // without a block partition declared by the model, the rows with more than SchurComplement_linking_degree_ratio
+      // times the average number of off-diagonal entries are moved to the border. A linking row of a model with k
+      // scenarios has about k times as many entries as a scenario row: the ratio 2 detects the linking rows from two
+      // scenarios on, while the rows of a generic sparse matrix seldom exceed twice the average (the border is dense)
+      options.set("SchurComplement_linking_degree_ratio", "2");
+
+      /** MUMPS options **/
+      // MPI build of MUMPS: the host (rank 0) participates in the factorization and the solve, in addition to
+      // distributing the work among the processes
+      options.set("MUMPS_host_participates", "yes");
+      // maximum memory (MB) per process. The factorization is performed out of core if it does not fit (0: no budget)
+      options.set("MUMPS_memory_budget", "0");
+      // directory of the factor files in out-of-core mode (empty: MUMPS_OOC_TMPDIR environment variable or /tmp)
+      options.set("MUMPS_out_of_core_directory", "");
+      // precision of the factorization (double or single). In single precision, the solution is refined in double
+      // precision and the factorization switches to double precision when the refinement does not converge
+      options.set("MUMPS_precision", "double");
+
       /** BQPD options **/
+      // initial maximum dimension of the nullspace. It increases when BQPD runs out of space
       options.set("BQPD_kmax", "500");
+      // increase factor of kmax and of the workspaces when BQPD runs out of space
+      options.set("BQPD_workspace_increase_factor", "1.333");
+
+      /** AMPL options **/
+      // expose the ASL Jacobian- and Hessian-vector products to the ingredients (yes|no). They steer the choice of the
+      // ingredients (e.g. the Steihaug CG subproblem solver for bound-constrained models) away from the matrix-based
+      // paths. Opt-in until they are validated on the AMPL test sets
+      options.set("AMPL_linear_operators", "no");
    }
 
    // determine default subproblem solvers, based on the available external dependencies
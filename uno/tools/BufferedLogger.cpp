@@ -0,0 +1,174 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <iostream>
+#include <stdexcept>
+#include "BufferedLogger.hpp"
+
+namespace uno {
+   namespace {
+      thread_local BufferedLogger* current_logger = nullptr;
+   }
+
+   void StandardOutputLogSink::write(std::string_view messages) {
+      std::cout.write(messages.data(), static_cast<std::streamsize>(messages.size()));
+   }
+
+   void StandardOutputLogSink::flush() {
+      std::cout.flush();
+   }
+
+   FileLogSink::FileLogSink(const std::string& file_name): file(file_name, std::ios::out | std::ios::trunc) {
+      if (!this->file.is_open()) {
+         throw std::runtime_error("The log file " + file_name + " could not be opened");
+      }
+   }
+
+   void FileLogSink::write(std::string_view messages) {
+      this->file.write(messages.data(), static_cast<std::streamsize>(messages.size()));
+   }
+
+   void FileLogSink::flush() {
+      this->file.flush();
+   }
+
+   CallbackLogSink::CallbackLogSink(std::function<void(std::string_view)> callback): callback(std::move(callback)) {
+   }
+
+   void CallbackLogSink::write(std::string_view messages) {
+      this->callback(messages);
+   }
+
+   BufferedLogger::BufferedLogger(std::unique_ptr<LogSink> sink):
+         sink(std::move(sink)), front_stream_buffer(*this), front_stream(&this->front_stream_buffer),
+         last_hand_over(std::chrono::steady_clock::now()), previous_logger(current_logger) {
+      this->front_buffer.reserve(BufferedLogger::buffer_capacity);
+      current_logger = this;
+   }
+
+   BufferedLogger::~BufferedLogger() {
+      current_logger = this->previous_logger;
+      this->hand_over();
+      if (this->writer.joinable()) {
+         {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->stop = true;
+         }
+         this->pending_condition.notify_one();
+         this->writer.join();
+      }
+   }
+
+   std::ostream& BufferedLogger::stream() {
+      return this->front_stream;
+   }
+
+   void BufferedLogger::flush() {
+      this->hand_over();
+      if (!this->writer.joinable()) {
+         return;
+      }
+      std::unique_lock<std::mutex> lock(this->mutex);
+      this->written_condition.wait(lock, [&] { return this->pending_buffer.empty() && !this->writing; });
+   }
+
+   BufferedLogger* BufferedLogger::current() {
+      return current_logger;
+   }
+
+   // private member functions
+
+   void BufferedLogger::end_of_line() {
+      const auto now = std::chrono::steady_clock::now();
+      if (BufferedLogger::buffer_capacity <= this->front_buffer.size() || BufferedLogger::flush_interval <= now - this->last_hand_over) {
+         // the solve lasts long enough to benefit from the writer thread
+         if (!this->writer.joinable()) {
+            this->writer = std::thread(&BufferedLogger::write_pending_messages, this);
+         }
+         this->hand_over();
+         this->last_hand_over = now;
+      }
+   }
+
+   // move the content of the front buffer to the pending buffer and wake up the writer thread. Without a writer thread,
+   // the messages are written by the current thread
+   void BufferedLogger::hand_over() {
+      if (this->front_buffer.empty()) {
+         return;
+      }
+      if (!this->writer.joinable()) {
+         this->write_into_sink(this->front_buffer);
+         this->front_buffer.clear();
+         return;
+      }
+      {
+         std::lock_guard<std::mutex> lock(this->mutex);
+         if (this->pending_buffer.empty()) {
+            std::swap(this->pending_buffer, this->front_buffer);
+         }
+         else {
+            this->pending_buffer.append(this->front_buffer);
+         }
+      }
+      this->front_buffer.clear();
+      this->pending_condition.notify_one();
+   }
+
+   // loop of the writer thread
+   void BufferedLogger::write_pending_messages() {
+      std::string messages;
+      std::unique_lock<std::mutex> lock(this->mutex);
+      while (true) {
+         this->pending_condition.wait(lock, [&] { return !this->pending_buffer.empty() || this->stop; });
+         if (this->pending_buffer.empty()) {
+            // stop was requested and all messages were written
+            break;
+         }
+         std::swap(messages, this->pending_buffer);
+         this->writing = true;
+         lock.unlock();
+         this->write_into_sink(messages);
+         messages.clear();
+         lock.lock();
+         this->writing = false;
+         this->written_condition.notify_all();
+      }
+   }
+
+   void BufferedLogger::write_into_sink(const std::string& messages) {
+      try {
+         this->sink->write(messages);
+         this->sink->flush();
+      }
+      catch (const std::exception&) {
+         // a failing sink must not interrupt the solve: the messages are lost
+      }
+   }
+
+   BufferedLogger::FrontBuffer::FrontBuffer(BufferedLogger& logger): logger(logger) {
+   }
+
+   BufferedLogger::FrontBuffer::int_type BufferedLogger::FrontBuffer::overflow(int_type character) {
+      if (!traits_type::eq_int_type(character, traits_type::eof())) {
+         const char c = traits_type::to_char_type(character);
+         this->logger.front_buffer.push_back(c);
+         if (c == '\n') {
+            this->logger.end_of_line();
+         }
+      }
+      return traits_type::not_eof(character);
+   }
+
+   std::streamsize BufferedLogger::FrontBuffer::xsputn(const char* characters, std::streamsize number_characters) {
+      this->logger.front_buffer.append(characters, static_cast<size_t>(number_characters));
+      if (0 < number_characters && characters[number_characters - 1] == '\n') {
+         this->logger.end_of_line();
+      }
+      return number_characters;
+   }
+
+   int BufferedLogger::FrontBuffer::sync() {
+      this->logger.hand_over();
+      return 0;
+   }
+} // namespace
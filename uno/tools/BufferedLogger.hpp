@@ -0,0 +1,121 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_BUFFEREDLOGGER_H
+#define UNO_BUFFEREDLOGGER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace uno {
+   // destination of the log messages
+   class LogSink {
+   public:
+      LogSink() = default;
+      virtual ~LogSink() = default;
+
+      virtual void write(std::string_view messages) = 0;
+      virtual void flush() { }
+   };
+
+   class StandardOutputLogSink: public LogSink {
+   public:
+      StandardOutputLogSink() = default;
+
+      void write(std::string_view messages) override;
+      void flush() override;
+   };
+
+   class FileLogSink: public LogSink {
+   public:
+      explicit FileLogSink(const std::string& file_name);
+
+      void write(std::string_view messages) override;
+      void flush() override;
+
+   private:
+      std::ofstream file;
+   };
+
+   // the callback is called from the writer thread of the logger, or from the thread of the solve if the writer thread
+   // was not started
+   class CallbackLogSink: public LogSink {
+   public:
+      explicit CallbackLogSink(std::function<void(std::string_view)> callback);
+
+      void write(std::string_view messages) override;
+
+   private:
+      const std::function<void(std::string_view)> callback;
+   };
+
+   // logger owned by a solve: while it is alive, the messages logged by the current thread are formatted into a buffer
+   // that is handed over to a writer thread, which writes it into the sink. The buffer is handed over when it is full,
+   // or at the end of a line when the last hand-over is older than flush_interval. The writer thread is started at the
+   // first such hand-over: the messages of a short solve are written by the thread of the solve, which saves the creation
+   // of a thread per solve
+   class BufferedLogger {
+   public:
+      explicit BufferedLogger(std::unique_ptr<LogSink> sink);
+      ~BufferedLogger();
+      BufferedLogger(const BufferedLogger&) = delete;
+      BufferedLogger& operator=(const BufferedLogger&) = delete;
+
+      [[nodiscard]] std::ostream& stream();
+      // hands over the buffer and waits until all messages were written
+      void flush();
+
+      // logger of the current thread (nullptr if there is none)
+      [[nodiscard]] static BufferedLogger* current();
+
+   private:
+      // stream buffer that accumulates the characters into the front buffer
+      class FrontBuffer: public std::streambuf {
+      public:
+         explicit FrontBuffer(BufferedLogger& logger);
+
+      protected:
+         int_type overflow(int_type character) override;
+         std::streamsize xsputn(const char* characters, std::streamsize number_characters) override;
+         int sync() override;
+
+      private:
+         BufferedLogger& logger;
+      };
+
+      static constexpr size_t buffer_capacity = 1 << 16;
+      static constexpr std::chrono::milliseconds flush_interval{50};
+
+      const std::unique_ptr<LogSink> sink;
+      std::string front_buffer{};
+      FrontBuffer front_stream_buffer;
+      std::ostream front_stream;
+      std::chrono::steady_clock::time_point last_hand_over;
+      // buffer shared with the writer thread
+      std::string pending_buffer{};
+      std::mutex mutex{};
+      std::condition_variable pending_condition{};
+      std::condition_variable written_condition{};
+      bool writing{false};
+      bool stop{false};
+      std::thread writer{};
+      // logger that was current when this logger was created
+      BufferedLogger* const previous_logger;
+
+      void end_of_line();
+      void hand_over();
+      void write_pending_messages();
+      void write_into_sink(const std::string& messages);
+   };
+} // namespace
+
+#endif // UNO_BUFFEREDLOGGER_H
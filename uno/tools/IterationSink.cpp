@@ -0,0 +1,148 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+#include "IterationSink.hpp"
+#include "options/Options.hpp"
+
+namespace uno {
+   IterationSink::IterationSink(const std::string& file_name, Format format): format(format), buffer(IterationSink::buffer_size) {
+      // the buffer must be set before the file is opened
+      this->stream.rdbuf()->pubsetbuf(this->buffer.data(), static_cast<std::streamsize>(this->buffer.size()));
+      this->stream.open(file_name, std::ios::out | std::ios::trunc);
+      if (!this->stream.is_open()) {
+         throw std::runtime_error("The iteration log file " + file_name + " could not be opened");
+      }
+   }
+
+   IterationSink::~IterationSink() {
+      this->stream.flush();
+   }
+
+   std::unique_ptr<IterationSink> IterationSink::create(const Options& options) {
+      const std::string& file_name = options.get_string("iteration_log_file");
+      if (file_name.empty()) {
+         return nullptr;
+      }
+      const std::string& format = options.get_string("iteration_log_format");
+      if (format == "json") {
+         return std::make_unique<IterationSink>(file_name, Format::JSON);
+      }
+      else if (format == "csv") {
+         return std::make_unique<IterationSink>(file_name, Format::CSV);
+      }
+      throw std::invalid_argument("The iteration log format " + format + " is unknown");
+   }
+
+   void IterationSink::write_header(const std::vector<std::string_view>& names) {
+      this->field_names.clear();
+      for (const std::string_view name: names) {
+         this->field_names.emplace_back(name);
+      }
+      this->field_names.emplace_back("time");
+
+      if (this->format == Format::CSV) {
+         this->start_record();
+         for (const std::string& name: this->field_names) {
+            this->write_string(name);
+         }
+         this->stream << '\n';
+      }
+   }
+
+   void IterationSink::start_record() {
+      this->field_index = 0;
+      if (this->format == Format::JSON) {
+         this->stream << '{';
+      }
+   }
+
+   void IterationSink::write_empty_field() {
+      this->write_field_name();
+      if (this->format == Format::JSON) {
+         this->stream << "null";
+      }
+      ++this->field_index;
+   }
+
+   void IterationSink::write_integer(long long value) {
+      this->write_field_name();
+      this->stream << value;
+      ++this->field_index;
+   }
+
+   void IterationSink::write_double(double value) {
+      this->write_field_name();
+      if (this->format == Format::JSON && !std::isfinite(value)) {
+         // JSON has no representation of infinite values and NaNs
+         this->stream << "null";
+      }
+      else {
+         char number[32];
+         const int length = std::snprintf(number, sizeof(number), "%.17g", value);
+         this->stream.write(number, length);
+      }
+      ++this->field_index;
+   }
+
+   void IterationSink::write_string(std::string_view value) {
+      this->write_field_name();
+      if (this->format == Format::JSON) {
+         this->stream << '"';
+         for (const char character: value) {
+            if (character == '"' || character == '\\') {
+               this->stream << '\\' << character;
+            }
+            else if (static_cast<unsigned char>(character) < 0x20) {
+               char escaped_character[8];
+               const int length = std::snprintf(escaped_character, sizeof(escaped_character), "\\u%04x",
+                  static_cast<unsigned int>(static_cast<unsigned char>(character)));
+               this->stream.write(escaped_character, length);
+            }
+            else {
+               this->stream << character;
+            }
+         }
+         this->stream << '"';
+      }
+      else {
+         // quote the field only if it contains a separator, a quote or a line break
+         if (value.find_first_of(",\"\n") == std::string_view::npos) {
+            this->stream << value;
+         }
+         else {
+            this->stream << '"';
+            for (const char character: value) {
+               if (character == '"') {
+                  this->stream << '"';
+               }
+               this->stream << character;
+            }
+            this->stream << '"';
+         }
+      }
+      ++this->field_index;
+   }
+
+   void IterationSink::end_record() {
+      // wall-clock time since the creation of the sink
+      this->write_double(this->timer.get_duration());
+      this->stream << (this->format == Format::JSON ? "}\n" : "\n");
+   }
+
+   // private member functions
+
+   void IterationSink::write_field_name() {
+      if (this->field_names.size() <= this->field_index) {
+         throw std::logic_error("The record of the iteration log has more fields than its header");
+      }
+      if (0 < this->field_index) {
+         this->stream << ',';
+      }
+      if (this->format == Format::JSON) {
+         this->stream << '"' << this->field_names[this->field_index] << "\":";
+      }
+   }
+} // namespace
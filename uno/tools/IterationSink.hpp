@@ -0,0 +1,51 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_ITERATIONSINK_H
+#define UNO_ITERATIONSINK_H
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Timer.hpp"
+
+namespace uno {
+   // forward declaration
+   class Options;
+
+   // machine-readable log of the iterations (one record per major or minor iteration) written to a file.
+   // The records are buffered and flushed when the sink is destroyed or the buffer is full
+   class IterationSink {
+   public:
+      enum class Format {JSON, CSV};
+
+      IterationSink(const std::string& file_name, Format format);
+      ~IterationSink();
+
+      // creates a sink if the option "iteration_log_file" is not empty, nullptr otherwise
+      [[nodiscard]] static std::unique_ptr<IterationSink> create(const Options& options);
+
+      void write_header(const std::vector<std::string_view>& field_names);
+      void start_record();
+      void write_empty_field();
+      void write_integer(long long value);
+      void write_double(double value);
+      void write_string(std::string_view value);
+      void end_record();
+
+   private:
+      static constexpr size_t buffer_size = 1 << 16;
+      const Format format;
+      std::vector<char> buffer;
+      std::ofstream stream{};
+      const Timer timer{};
+      std::vector<std::string> field_names{};
+      size_t field_index{0};
+
+      void write_field_name();
+   };
+} // namespace
+
+#endif // UNO_ITERATIONSINK_H
@@ -2,6 +2,7 @@
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
 #include "Logger.hpp"
+#include "BufferedLogger.hpp"
 
 namespace uno {
    void Logger::set_logger(const std::string& logger_level) {
@@ -30,4 +31,9 @@ namespace uno {
          throw std::out_of_range("The logger level " + logger_level + " was not found");
       }
    }
+
+   std::ostream& Logger::stream() {
+      BufferedLogger* current_logger = BufferedLogger::current();
+      return (current_logger != nullptr) ? current_logger->stream() : std::cout;
+   }
 } // namespace
\ No newline at end of file
@@ -14,25 +14,32 @@ namespace uno {
 
    class Logger {
    public:
-       static Level level;
+       // each thread (e.g. each Python thread that releases the GIL) has its own level, like the evaluation counters
+       static thread_local Level level;
        static void set_logger(const std::string& logger_level);
+       [[nodiscard]] static bool is_enabled(Level level) { return level <= Logger::level; }
+       // stream of the logger owned by the current solve (std::cout outside a solve)
+       [[nodiscard]] static std::ostream& stream();
    };
 
    template <typename T>
    const Level& operator<<(const Level& level, T& element) {
-      if (level <= Logger::level) {
-         std::cout << element;
+      if (Logger::is_enabled(level)) {
+         Logger::stream() << element;
       }
       return level;
    }
 
    template <typename T>
    const Level& operator<<(const Level& level, const T& element) {
-      if (level <= Logger::level) {
-         std::cout << element;
+      if (Logger::is_enabled(level)) {
+         Logger::stream() << element;
       }
       return level;
    }
 } // namespace
 
+// logs a message whose arguments are evaluated only if the level is enabled, e.g. UNO_LOG(DEBUG) << norm_inf(x) << '\n';
+#define UNO_LOG(level) if (!uno::Logger::is_enabled(level)) { } else level
+
 #endif // UNO_LOGGER_H
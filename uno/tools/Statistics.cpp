@@ -1,10 +1,15 @@
 // Copyright (c) 2018-2024 Charlie Vanaret
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
-#include <sstream>
-#include <iostream>
-#include <iomanip>
+#include <algorithm>
+#include <cstdio>
+#include <ostream>
+#include <map>
+#include <stdexcept>
+#include <string>
 #include "Statistics.hpp"
+#include "IterationSink.hpp"
+#include "Logger.hpp"
 #include "options/Options.hpp"
 
 namespace uno {
@@ -14,63 +19,165 @@ namespace uno {
    int Statistics::string_width = 26;
    int Statistics::numerical_format_size = 4;
 
-   void Statistics::add_column(std::string_view name, int width, int order) {
-      this->columns[order] = name;
-      this->widths[name] = width;
+   Statistics::Statistics() = default;
+
+   Statistics::Statistics(bool print_table): print_table(print_table), enabled(print_table) {
+   }
+
+   Statistics::Statistics(Statistics&& other) noexcept = default;
+
+   Statistics::~Statistics() = default;
+
+   void Statistics::set_sink(std::unique_ptr<IterationSink> sink) {
+      this->sink = std::move(sink);
+      this->enabled = this->print_table || (this->sink != nullptr);
    }
-   
+
+   Statistics::ColumnHandle Statistics::add_column(std::string_view name, int width, int order) {
+      // a column may be added several times (e.g. by the ingredients of different phases)
+      for (size_t column_index = 0; column_index < this->columns.size(); column_index++) {
+         if (this->columns[column_index].name == name) {
+            return column_index;
+         }
+      }
+      // the records of the sink must match its header, written at the first record
+      if (this->sink_header_written) {
+         throw std::logic_error("The column " + std::string(name) + " was added after the first record of the iteration log");
+      }
+      const ColumnHandle column_handle = this->columns.size();
+      this->columns.push_back({std::string(name), width, order});
+
+      // a column with the same order replaces the displayed one
+      const auto same_order = std::find_if(this->displayed_columns.begin(), this->displayed_columns.end(),
+         [&](ColumnHandle handle) { return this->columns[handle].order == order; });
+      if (same_order != this->displayed_columns.end()) {
+         *same_order = column_handle;
+      }
+      else {
+         const auto position = std::find_if(this->displayed_columns.begin(), this->displayed_columns.end(),
+            [&](ColumnHandle handle) { return order < this->columns[handle].order; });
+         this->displayed_columns.insert(position, column_handle);
+      }
+      return column_handle;
+   }
+
    void Statistics::start_new_line() {
-      for (const auto& column: this->columns) {
-         this->current_line[column.second] = "-";
+      if (!this->enabled) {
+         return;
+      }
+      for (Column& column: this->columns) {
+         column.type = ValueType::EMPTY;
       }
    }
 
-   void Statistics::set(std::string_view name, std::string value) {
-      this->current_line[name] = std::move(value);
+   void Statistics::set(std::string_view name, std::string_view value) {
+      if (this->enabled) {
+         if (Column* column = this->find_column(name)) {
+            column->type = ValueType::STRING;
+            // the string keeps its capacity from one iteration to the next
+            column->string_value = value;
+         }
+      }
    }
 
    void Statistics::set(std::string_view name, int value) {
-      this->set(name, std::to_string(value));
+      if (this->enabled) {
+         if (Column* column = this->find_column(name)) {
+            column->type = ValueType::INTEGER;
+            column->integer_value = value;
+         }
+      }
    }
 
    void Statistics::set(std::string_view name, size_t value) {
-      this->set(name, std::to_string(value));
+      if (this->enabled) {
+         if (Column* column = this->find_column(name)) {
+            column->type = ValueType::INTEGER;
+            column->integer_value = static_cast<long long>(value);
+         }
+      }
    }
 
    void Statistics::set(std::string_view name, double value) {
-      std::ostringstream stream;
-      stream << std::scientific << std::setprecision(Statistics::numerical_format_size) << value;
-      this->set(name, stream.str());
+      if (this->enabled) {
+         if (Column* column = this->find_column(name)) {
+            column->type = ValueType::DOUBLE;
+            column->double_value = value;
+         }
+      }
+   }
+
+   void Statistics::set(ColumnHandle column_handle, std::string_view value) {
+      if (this->enabled) {
+         Column& column = this->columns[column_handle];
+         column.type = ValueType::STRING;
+         column.string_value = value;
+      }
+   }
+
+   void Statistics::set(ColumnHandle column_handle, int value) {
+      if (this->enabled) {
+         Column& column = this->columns[column_handle];
+         column.type = ValueType::INTEGER;
+         column.integer_value = value;
+      }
    }
-   
+
+   void Statistics::set(ColumnHandle column_handle, size_t value) {
+      if (this->enabled) {
+         Column& column = this->columns[column_handle];
+         column.type = ValueType::INTEGER;
+         column.integer_value = static_cast<long long>(value);
+      }
+   }
+
+   void Statistics::set(ColumnHandle column_handle, double value) {
+      if (this->enabled) {
+         Column& column = this->columns[column_handle];
+         column.type = ValueType::DOUBLE;
+         column.double_value = value;
+      }
+   }
+
+   bool Statistics::is_enabled() const {
+      return this->enabled;
+   }
+
    void Statistics::print_horizontal_line() {
-      for (const auto& element: this->columns) {
-         std::string header = element.second;
-         for (int j = 0; j < this->widths[header]; j++) {
-            std::cout << Statistics::symbol("top");
+      if (!this->print_table) {
+         return;
+      }
+      std::ostream& stream = Logger::stream();
+      for (const ColumnHandle column_handle: this->displayed_columns) {
+         for (int j = 0; j < this->columns[column_handle].width; j++) {
+            stream << Statistics::symbol("top");
          }
       }
-      std::cout << '\n';
+      stream << '\n';
    }
 
    void Statistics::print_header() {
+      if (!this->print_table) {
+         return;
+      }
       /* line above */
       this->print_horizontal_line();
       /* headers */
-      for (const auto& element: this->columns) {
-         const std::string& header = element.second;
-         std::cout << " " << header;
-         for (int j = 0; j < this->widths[header] - static_cast<int>(header.size()) - 1; j++) {
-            std::cout << " ";
+      std::ostream& stream = Logger::stream();
+      for (const ColumnHandle column_handle: this->displayed_columns) {
+         const Column& column = this->columns[column_handle];
+         stream << " " << column.name;
+         for (int j = 0; j < column.width - static_cast<int>(column.name.size()) - 1; j++) {
+            stream << " ";
          }
       }
-      std::cout << '\n';
+      stream << '\n';
       /* line below */
       this->print_horizontal_line();
    }
 
    // https://cplusplus.com/forum/beginner/192031/
-   std::size_t length_utf8(const std::string& str) {
+   std::size_t length_utf8(std::string_view str) {
       size_t length = 0;
       for (char c: str) {
          if ((c & 0xC0) != 0x80) {
@@ -80,40 +187,105 @@ namespace uno {
       return length;
    }
 
+   // prints the current line (if the table is printed) and writes it into the sink (if any)
    void Statistics::print_current_line() {
-      for (const auto& element: this->columns) {
-         const auto& header = element.second;
-         int length;
-         try {
-            const auto& value = this->current_line.at(header);
-            std::cout << " " << value;
-            length = 1 + static_cast<int>(length_utf8(value));
-         }
-         catch (const std::out_of_range&) {
-            std::cout << " -";
-            length = 2;
+      if (this->sink != nullptr) {
+         this->write_current_record();
+      }
+      if (!this->print_table) {
+         return;
+      }
+      std::ostream& stream = Logger::stream();
+      char buffer[32];
+      for (const ColumnHandle column_handle: this->displayed_columns) {
+         const Column& column = this->columns[column_handle];
+         // format the raw value
+         std::string_view value;
+         switch (column.type) {
+            case ValueType::INTEGER:
+               value = std::string_view(buffer, static_cast<size_t>(std::snprintf(buffer, sizeof(buffer), "%lld", column.integer_value)));
+               break;
+            case ValueType::DOUBLE:
+               value = std::string_view(buffer, static_cast<size_t>(std::snprintf(buffer, sizeof(buffer), "%.*e",
+                  Statistics::numerical_format_size, column.double_value)));
+               break;
+            case ValueType::STRING:
+               value = column.string_value;
+               break;
+            default:
+               value = "-";
          }
-         int number_spaces = (length <= this->widths[header]) ? this->widths[header] - length : 0;
+         stream << " " << value;
+         const int length = 1 + static_cast<int>(length_utf8(value));
+         const int number_spaces = (length <= column.width) ? column.width - length : 0;
          for (int j = 0; j < number_spaces; j++) {
-            std::cout << " ";
+            stream << " ";
          }
       }
-      std::cout << '\n';
+      stream << '\n';
    }
 
    void Statistics::print_footer() {
       /*
-      for (const auto& element: this->columns) {
-         const auto& header = element.second;
-         for (int j = 0; j < this->widths[header]; j++) {
-            std::cout << Statistics::symbol("bottom");
+      for (const ColumnHandle column_handle: this->displayed_columns) {
+         for (int j = 0; j < this->columns[column_handle].width; j++) {
+            Logger::stream() << Statistics::symbol("bottom");
          }
       }
-      std::cout << '\n';
+      Logger::stream() << '\n';
       */
       Statistics::print_header();
    }
-   
+
+   void Statistics::write_current_record() {
+      // the header is written before the first record, once all the columns were added
+      if (!this->sink_header_written) {
+         std::vector<std::string_view> names;
+         names.reserve(this->displayed_columns.size());
+         for (const ColumnHandle column_handle: this->displayed_columns) {
+            names.emplace_back(this->columns[column_handle].name);
+         }
+         this->sink->write_header(names);
+         this->sink_header_written = true;
+      }
+      this->sink->start_record();
+      for (const ColumnHandle column_handle: this->displayed_columns) {
+         const Column& column = this->columns[column_handle];
+         switch (column.type) {
+            case ValueType::INTEGER:
+               this->sink->write_integer(column.integer_value);
+               break;
+            case ValueType::DOUBLE:
+               this->sink->write_double(column.double_value);
+               break;
+            case ValueType::STRING:
+               this->sink->write_string(column.string_value);
+               break;
+            default:
+               this->sink->write_empty_field();
+         }
+      }
+      this->sink->end_record();
+   }
+
+   const Statistics::Column* Statistics::find_column(std::string_view name) const {
+      for (const Column& column: this->columns) {
+         if (column.name == name) {
+            return &column;
+         }
+      }
+      return nullptr;
+   }
+
+   Statistics::Column* Statistics::find_column(std::string_view name) {
+      for (Column& column: this->columns) {
+         if (column.name == name) {
+            return &column;
+         }
+      }
+      return nullptr;
+   }
+
    std::string_view Statistics::symbol(std::string_view value) {
       static std::map<std::string_view, std::string_view> symbols = {
             {"top", "─"},
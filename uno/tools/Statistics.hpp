@@ -4,38 +4,77 @@
 #ifndef UNO_STATISTICS_H
 #define UNO_STATISTICS_H
 
+#include <cstddef>
+#include <memory>
+#include <string>
 #include <string_view>
-#include <map>
+#include <vector>
 
 namespace uno {
-   // forward declaration
+   // forward declarations
+   class IterationSink;
    class Options;
 
    class Statistics {
    public:
-      Statistics() = default;
+      // a column is referred to by its name or, more efficiently, by the handle returned by add_column
+      using ColumnHandle = size_t;
+
+      Statistics();
+      // a table that is neither printed nor logged into a sink ignores all the values it is given
+      explicit Statistics(bool print_table);
+      Statistics(Statistics&& other) noexcept;
+      ~Statistics();
 
       static int int_width;
       static int double_width;
       static int string_width;
       static int numerical_format_size;
 
-      void add_column(std::string_view name, int width, int order);
+      // the lines are also written as records into the sink
+      void set_sink(std::unique_ptr<IterationSink> sink);
+      ColumnHandle add_column(std::string_view name, int width, int order);
       void start_new_line();
-      void set(std::string_view name, std::string value);
+      void set(std::string_view name, std::string_view value);
       void set(std::string_view name, int value);
       void set(std::string_view name, size_t value);
       void set(std::string_view name, double value);
-      
+      void set(ColumnHandle column_handle, std::string_view value);
+      void set(ColumnHandle column_handle, int value);
+      void set(ColumnHandle column_handle, size_t value);
+      void set(ColumnHandle column_handle, double value);
+      [[nodiscard]] bool is_enabled() const;
+
       void print_horizontal_line();
       void print_header();
       void print_current_line();
       void print_footer();
 
    private:
-      std::map<int, std::string> columns{};
-      std::map<std::string_view, int> widths{};
-      std::map<std::string_view, std::string> current_line{};
+      // the raw values are stored and formatted only when the line is printed
+      enum class ValueType {EMPTY, INTEGER, DOUBLE, STRING};
+      struct Column {
+         std::string name;
+         int width;
+         int order;
+         ValueType type{ValueType::EMPTY};
+         long long integer_value{0};
+         double double_value{0.};
+         std::string string_value{};
+      };
+
+      bool print_table{true};
+      std::unique_ptr<IterationSink> sink{};
+      bool sink_header_written{false};
+      // true if the values are either printed or logged
+      bool enabled{true};
+      std::vector<Column> columns{};
+      // handles of the displayed columns, sorted by increasing order
+      std::vector<ColumnHandle> displayed_columns{};
+
+      void write_current_record();
+      [[nodiscard]] const Column* find_column(std::string_view name) const;
+      [[nodiscard]] Column* find_column(std::string_view name);
       static std::string_view symbol(std::string_view value);
    };
 } // namespace
@@ -6,11 +6,18 @@
 #include <ctime>
 
 namespace uno {
-   Timer::Timer(): start_time(std::clock()) {
+   Timer::Timer(): start_time(std::chrono::steady_clock::now()), cpu_start_time(std::clock()) {
    }
 
+   // wall-clock time (in seconds) since the creation of the timer
    double Timer::get_duration() const {
-      return static_cast<double>(std::clock() - this->start_time) / static_cast<double>(CLOCKS_PER_SEC);
+      const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - this->start_time;
+      return duration.count();
+   }
+
+   // CPU time (in seconds) since the creation of the timer
+   double Timer::get_cpu_duration() const {
+      return static_cast<double>(std::clock() - this->cpu_start_time) / static_cast<double>(CLOCKS_PER_SEC);
    }
 
    char* Timer::get_current_date() {
@@ -4,19 +4,23 @@
 #ifndef UNO_TIMER_H
 #define UNO_TIMER_H
 
+#include <chrono>
 #include <ctime>
 
 namespace uno {
    // timer starts upon creation
+   // the wall-clock time is measured with a monotonic clock; the CPU time is summed over all threads of the process
    class Timer {
    public:
       Timer();
       [[nodiscard]] double get_duration() const;
+      [[nodiscard]] double get_cpu_duration() const;
       [[nodiscard]] static char* get_current_date();
 
    private:
-      std::clock_t start_time;
+      std::chrono::steady_clock::time_point start_time;
+      std::clock_t cpu_start_time;
    };
 } // namespace
 
-#endif //UNO_TIMER_H
\ No newline at end of file
+#endif //UNO_TIMER_H
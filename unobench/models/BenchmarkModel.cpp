@@ -0,0 +1,138 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include "BenchmarkModel.hpp"
+#include "symbolic/Range.hpp"
+#include "tools/Infinity.hpp"
+
+namespace uno {
+   BenchmarkModel::BenchmarkModel(std::string name, size_t number_variables, size_t number_constraints):
+         Model(std::move(name), number_variables, number_constraints, 1.),
+         variables_lower_bounds(number_variables, -INF<double>),
+         variables_upper_bounds(number_variables, INF<double>),
+         constraints_lower_bounds(number_constraints, -INF<double>),
+         constraints_upper_bounds(number_constraints, INF<double>),
+         initial_point(number_variables),
+         equality_constraints_collection(this->equality_constraints),
+         inequality_constraints_collection(this->inequality_constraints),
+         linear_constraints_collection(this->linear_constraints),
+         point(number_variables) {
+   }
+
+   void BenchmarkModel::compute_constraint_jacobian_sparsity(int* row_indices, int* column_indices, int solver_indexing,
+         MatrixOrder /*matrix_order*/) const {
+      for (size_t nonzero_index: Range(this->jacobian_row_indices.size())) {
+         row_indices[nonzero_index] = this->jacobian_row_indices[nonzero_index] + solver_indexing;
+         column_indices[nonzero_index] = this->jacobian_column_indices[nonzero_index] + solver_indexing;
+      }
+   }
+
+   void BenchmarkModel::compute_hessian_sparsity(int* row_indices, int* column_indices, int solver_indexing) const {
+      for (size_t nonzero_index: Range(this->hessian_row_indices.size())) {
+         row_indices[nonzero_index] = this->hessian_row_indices[nonzero_index] + solver_indexing;
+         column_indices[nonzero_index] = this->hessian_column_indices[nonzero_index] + solver_indexing;
+      }
+   }
+
+   void BenchmarkModel::compute_jacobian_vector_product(const double* x, const double* vector, double* result) const {
+      std::copy_n(x, this->number_variables, this->point.data());
+      this->jacobian_values.resize(this->number_jacobian_nonzeros());
+      this->evaluate_constraint_jacobian(this->point, this->jacobian_values.data());
+      std::fill_n(result, this->number_constraints, 0.);
+      for (size_t nonzero_index: Range(this->jacobian_values.size())) {
+         const size_t row_index = static_cast<size_t>(this->jacobian_row_indices[nonzero_index]);
+         const size_t column_index = static_cast<size_t>(this->jacobian_column_indices[nonzero_index]);
+         result[row_index] += this->jacobian_values[nonzero_index] * vector[column_index];
+      }
+   }
+
+   void BenchmarkModel::compute_jacobian_transposed_vector_product(const double* x, const double* vector, double* result) const {
+      std::copy_n(x, this->number_variables, this->point.data());
+      this->jacobian_values.resize(this->number_jacobian_nonzeros());
+      this->evaluate_constraint_jacobian(this->point, this->jacobian_values.data());
+      std::fill_n(result, this->number_variables, 0.);
+      for (size_t nonzero_index: Range(this->jacobian_values.size())) {
+         const size_t row_index = static_cast<size_t>(this->jacobian_row_indices[nonzero_index]);
+         const size_t column_index = static_cast<size_t>(this->jacobian_column_indices[nonzero_index]);
+         result[column_index] += this->jacobian_values[nonzero_index] * vector[row_index];
+      }
+   }
+
+   void BenchmarkModel::compute_hessian_vector_product(const double* x, const double* vector, double objective_multiplier,
+         const Vector<double>& multipliers, double* result) const {
+      std::copy_n(x, this->number_variables, this->point.data());
+      this->hessian_values.resize(this->number_hessian_nonzeros());
+      this->evaluate_lagrangian_hessian(this->point, objective_multiplier, multipliers, this->hessian_values.data());
+      std::fill_n(result, this->number_variables, 0.);
+      // only the lower triangle is stored
+      for (size_t nonzero_index: Range(this->hessian_values.size())) {
+         const size_t row_index = static_cast<size_t>(this->hessian_row_indices[nonzero_index]);
+         const size_t column_index = static_cast<size_t>(this->hessian_column_indices[nonzero_index]);
+         result[row_index] += this->hessian_values[nonzero_index] * vector[column_index];
+         if (row_index != column_index) {
+            result[column_index] += this->hessian_values[nonzero_index] * vector[row_index];
+         }
+      }
+   }
+
+   double BenchmarkModel::variable_lower_bound(size_t variable_index) const {
+      return this->variables_lower_bounds[variable_index];
+   }
+
+   double BenchmarkModel::variable_upper_bound(size_t variable_index) const {
+      return this->variables_upper_bounds[variable_index];
+   }
+
+   const SparseVector<size_t>& BenchmarkModel::get_slacks() const {
+      return this->slacks;
+   }
+
+   const Vector<size_t>& BenchmarkModel::get_fixed_variables() const {
+      return this->fixed_variables;
+   }
+
+   double BenchmarkModel::constraint_lower_bound(size_t constraint_index) const {
+      return this->constraints_lower_bounds[constraint_index];
+   }
+
+   double BenchmarkModel::constraint_upper_bound(size_t constraint_index) const {
+      return this->constraints_upper_bounds[constraint_index];
+   }
+
+   const Collection<size_t>& BenchmarkModel::get_equality_constraints() const {
+      return this->equality_constraints_collection;
+   }
+
+   const Collection<size_t>& BenchmarkModel::get_inequality_constraints() const {
+      return this->inequality_constraints_collection;
+   }
+
+   const Collection<size_t>& BenchmarkModel::get_linear_constraints() const {
+      return this->linear_constraints_collection;
+   }
+
+   void BenchmarkModel::initial_primal_point(Vector<double>& x) const {
+      x = this->initial_point;
+   }
+
+   void BenchmarkModel::initial_dual_point(Vector<double>& multipliers) const {
+      multipliers.fill(0.);
+   }
+
+   void BenchmarkModel::postprocess_solution(Iterate& /*iterate*/) const {
+   }
+
+   size_t BenchmarkModel::number_jacobian_nonzeros() const {
+      return this->jacobian_row_indices.size();
+   }
+
+   size_t BenchmarkModel::number_hessian_nonzeros() const {
+      return this->hessian_row_indices.size();
+   }
+
+   void BenchmarkModel::partition_model() {
+      this->find_fixed_variables(this->fixed_variables);
+      this->partition_constraints(this->equality_constraints, this->inequality_constraints);
+   }
+} // namespace
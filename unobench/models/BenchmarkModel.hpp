@@ -0,0 +1,83 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_BENCHMARKMODEL_H
+#define UNO_BENCHMARKMODEL_H
+
+#include <vector>
+#include "linear_algebra/SparseVector.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "model/Model.hpp"
+#include "symbolic/CollectionAdapter.hpp"
+
+namespace uno {
+   // generated model whose bounds, sparsity patterns and initial point are stored explicitly.
+   // The Jacobian and Hessian operators are computed from the sparse matrices
+   class BenchmarkModel: public Model {
+   public:
+      BenchmarkModel(std::string name, size_t number_variables, size_t number_constraints);
+
+      [[nodiscard]] bool has_jacobian_operator() const override { return true; }
+      [[nodiscard]] bool has_jacobian_transposed_operator() const override { return true; }
+      [[nodiscard]] bool has_hessian_operator() const override { return true; }
+      [[nodiscard]] bool has_hessian_matrix() const override { return true; }
+
+      void compute_constraint_jacobian_sparsity(int* row_indices, int* column_indices, int solver_indexing,
+         MatrixOrder matrix_order) const override;
+      void compute_hessian_sparsity(int* row_indices, int* column_indices, int solver_indexing) const override;
+
+      void compute_jacobian_vector_product(const double* x, const double* vector, double* result) const override;
+      void compute_jacobian_transposed_vector_product(const double* x, const double* vector, double* result) const override;
+      void compute_hessian_vector_product(const double* x, const double* vector, double objective_multiplier,
+         const Vector<double>& multipliers, double* result) const override;
+
+      [[nodiscard]] double variable_lower_bound(size_t variable_index) const override;
+      [[nodiscard]] double variable_upper_bound(size_t variable_index) const override;
+      [[nodiscard]] const SparseVector<size_t>& get_slacks() const override;
+      [[nodiscard]] const Vector<size_t>& get_fixed_variables() const override;
+
+      [[nodiscard]] double constraint_lower_bound(size_t constraint_index) const override;
+      [[nodiscard]] double constraint_upper_bound(size_t constraint_index) const override;
+      [[nodiscard]] const Collection<size_t>& get_equality_constraints() const override;
+      [[nodiscard]] const Collection<size_t>& get_inequality_constraints() const override;
+      [[nodiscard]] const Collection<size_t>& get_linear_constraints() const override;
+
+      void initial_primal_point(Vector<double>& x) const override;
+      void initial_dual_point(Vector<double>& multipliers) const override;
+      void postprocess_solution(Iterate& iterate) const override;
+
+      [[nodiscard]] size_t number_jacobian_nonzeros() const override;
+      [[nodiscard]] size_t number_hessian_nonzeros() const override;
+
+   protected:
+      Vector<double> variables_lower_bounds;
+      Vector<double> variables_upper_bounds;
+      Vector<double> constraints_lower_bounds;
+      Vector<double> constraints_upper_bounds;
+      Vector<double> initial_point;
+      // COO sparsity patterns (C indexing, lower triangle of the Hessian)
+      std::vector<int> jacobian_row_indices{};
+      std::vector<int> jacobian_column_indices{};
+      std::vector<int> hessian_row_indices{};
+      std::vector<int> hessian_column_indices{};
+      std::vector<size_t> linear_constraints{};
+
+      // must be called by the derived classes once the bounds are set
+      void partition_model();
+
+   private:
+      const SparseVector<size_t> slacks{};
+      Vector<size_t> fixed_variables{};
+      std::vector<size_t> equality_constraints{};
+      CollectionAdapter<std::vector<size_t>> equality_constraints_collection;
+      std::vector<size_t> inequality_constraints{};
+      CollectionAdapter<std::vector<size_t>> inequality_constraints_collection;
+      CollectionAdapter<std::vector<size_t>> linear_constraints_collection;
+      // scratch space for the operators
+      mutable Vector<double> point;
+      mutable std::vector<double> jacobian_values{};
+      mutable std::vector<double> hessian_values{};
+   };
+} // namespace
+
+#endif // UNO_BENCHMARKMODEL_H
@@ -0,0 +1,69 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <cmath>
+#include "BoundConstrainedQuadraticModel.hpp"
+#include "symbolic/Range.hpp"
+
+namespace uno {
+   BoundConstrainedQuadraticModel::BoundConstrainedQuadraticModel(size_t number_variables):
+         BenchmarkModel("bound_constrained_quadratic_" + std::to_string(number_variables), number_variables, 0),
+         linear_coefficients(number_variables) {
+      for (size_t variable_index: Range(number_variables)) {
+         this->variables_lower_bounds[variable_index] = -1.;
+         this->variables_upper_bounds[variable_index] = 1.;
+         this->linear_coefficients[variable_index] = 10. * std::sin(static_cast<double>(variable_index));
+         this->initial_point[variable_index] = 0.;
+      }
+      // lower triangle of Q: diagonal and subdiagonal
+      for (size_t variable_index: Range(number_variables)) {
+         this->hessian_row_indices.push_back(static_cast<int>(variable_index));
+         this->hessian_column_indices.push_back(static_cast<int>(variable_index));
+         if (0 < variable_index) {
+            this->hessian_row_indices.push_back(static_cast<int>(variable_index));
+            this->hessian_column_indices.push_back(static_cast<int>(variable_index - 1));
+         }
+      }
+      this->partition_model();
+   }
+
+   double BoundConstrainedQuadraticModel::evaluate_objective(const Vector<double>& x) const {
+      double objective = 0.;
+      for (size_t variable_index: Range(this->number_variables)) {
+         objective += (2. * x[variable_index] + this->linear_coefficients[variable_index]) * x[variable_index];
+         if (0 < variable_index) {
+            objective -= x[variable_index] * x[variable_index - 1];
+         }
+      }
+      return objective;
+   }
+
+   void BoundConstrainedQuadraticModel::evaluate_constraints(const Vector<double>& /*x*/, Vector<double>& /*constraints*/) const {
+   }
+
+   void BoundConstrainedQuadraticModel::evaluate_objective_gradient(const Vector<double>& x, Vector<double>& gradient) const {
+      for (size_t variable_index: Range(this->number_variables)) {
+         gradient[variable_index] = 4. * x[variable_index] + this->linear_coefficients[variable_index];
+         if (0 < variable_index) {
+            gradient[variable_index] -= x[variable_index - 1];
+         }
+         if (variable_index < this->number_variables - 1) {
+            gradient[variable_index] -= x[variable_index + 1];
+         }
+      }
+   }
+
+   void BoundConstrainedQuadraticModel::evaluate_constraint_jacobian(const Vector<double>& /*x*/, double* /*jacobian_values*/) const {
+   }
+
+   void BoundConstrainedQuadraticModel::evaluate_lagrangian_hessian(const Vector<double>& /*x*/, double objective_multiplier,
+         const Vector<double>& /*multipliers*/, double* hessian_values) const {
+      size_t nonzero_index = 0;
+      for (size_t variable_index: Range(this->number_variables)) {
+         hessian_values[nonzero_index++] = 4. * objective_multiplier;
+         if (0 < variable_index) {
+            hessian_values[nonzero_index++] = -objective_multiplier;
+         }
+      }
+   }
+} // namespace
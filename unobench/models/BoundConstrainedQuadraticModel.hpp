@@ -0,0 +1,28 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_BOUNDCONSTRAINEDQUADRATICMODEL_H
+#define UNO_BOUNDCONSTRAINEDQUADRATICMODEL_H
+
+#include "BenchmarkModel.hpp"
+
+namespace uno {
+   // min 1/2 x^T Q x + c^T x s.t. -1 <= x <= 1
+   // where Q is the tridiagonal matrix tridiag(-1, 4, -1) and c_i = 10 sin(i). About half of the bounds are active
+   class BoundConstrainedQuadraticModel: public BenchmarkModel {
+   public:
+      explicit BoundConstrainedQuadraticModel(size_t number_variables);
+
+      [[nodiscard]] double evaluate_objective(const Vector<double>& x) const override;
+      void evaluate_constraints(const Vector<double>& x, Vector<double>& constraints) const override;
+      void evaluate_objective_gradient(const Vector<double>& x, Vector<double>& gradient) const override;
+      void evaluate_constraint_jacobian(const Vector<double>& x, double* jacobian_values) const override;
+      void evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+         double* hessian_values) const override;
+
+   private:
+      Vector<double> linear_coefficients;
+   };
+} // namespace
+
+#endif // UNO_BOUNDCONSTRAINEDQUADRATICMODEL_H
@@ -0,0 +1,107 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <cmath>
+#include "OptimalControlModel.hpp"
+#include "symbolic/Range.hpp"
+
+namespace uno {
+   OptimalControlModel::OptimalControlModel(size_t number_variables):
+         BenchmarkModel("optimal_control_" + std::to_string(number_variables), 2 * std::max<size_t>(1, number_variables / 2) + 1,
+            std::max<size_t>(1, number_variables / 2) + 1),
+         number_steps(std::max<size_t>(1, number_variables / 2)),
+         step_size(1. / static_cast<double>(this->number_steps)),
+         target_states(this->number_steps + 1) {
+      const double pi = std::acos(-1.);
+      for (size_t step: Range(this->number_steps + 1)) {
+         const double time = static_cast<double>(step) * this->step_size;
+         this->target_states[step] = 1. + 0.5 * std::sin(4. * pi * time);
+         this->initial_point[this->state_index(step)] = 1.;
+      }
+      for (size_t step: Range(this->number_steps)) {
+         this->variables_lower_bounds[this->control_index(step)] = -1.;
+         this->variables_upper_bounds[this->control_index(step)] = 1.;
+         this->initial_point[this->control_index(step)] = 0.;
+      }
+
+      // dynamics
+      for (size_t step: Range(this->number_steps)) {
+         const int constraint_index = static_cast<int>(step);
+         this->jacobian_row_indices.insert(this->jacobian_row_indices.end(), {constraint_index, constraint_index, constraint_index});
+         this->jacobian_column_indices.insert(this->jacobian_column_indices.end(), {static_cast<int>(this->state_index(step)),
+            static_cast<int>(this->state_index(step + 1)), static_cast<int>(this->control_index(step))});
+         this->constraints_lower_bounds[step] = 0.;
+         this->constraints_upper_bounds[step] = 0.;
+      }
+      // initial condition
+      this->jacobian_row_indices.push_back(static_cast<int>(this->number_steps));
+      this->jacobian_column_indices.push_back(static_cast<int>(this->state_index(0)));
+      this->constraints_lower_bounds[this->number_steps] = 1.;
+      this->constraints_upper_bounds[this->number_steps] = 1.;
+      this->linear_constraints.push_back(this->number_steps);
+
+      // the Lagrangian Hessian is diagonal
+      for (size_t variable_index: Range(this->number_variables)) {
+         this->hessian_row_indices.push_back(static_cast<int>(variable_index));
+         this->hessian_column_indices.push_back(static_cast<int>(variable_index));
+      }
+      this->partition_model();
+   }
+
+   double OptimalControlModel::evaluate_objective(const Vector<double>& x) const {
+      double objective = 0.;
+      for (size_t step: Range(this->number_steps + 1)) {
+         const double deviation = x[this->state_index(step)] - this->target_states[step];
+         objective += 0.5 * deviation * deviation;
+      }
+      for (size_t step: Range(this->number_steps)) {
+         const double control = x[this->control_index(step)];
+         objective += 0.5 * OptimalControlModel::control_weight * control * control;
+      }
+      return this->step_size * objective;
+   }
+
+   void OptimalControlModel::evaluate_constraints(const Vector<double>& x, Vector<double>& constraints) const {
+      for (size_t step: Range(this->number_steps)) {
+         const double state = x[this->state_index(step)];
+         constraints[step] = x[this->state_index(step + 1)] - state - this->step_size * (-state * state * state + x[this->control_index(step)]);
+      }
+      constraints[this->number_steps] = x[this->state_index(0)];
+   }
+
+   void OptimalControlModel::evaluate_objective_gradient(const Vector<double>& x, Vector<double>& gradient) const {
+      for (size_t step: Range(this->number_steps + 1)) {
+         gradient[this->state_index(step)] = this->step_size * (x[this->state_index(step)] - this->target_states[step]);
+      }
+      for (size_t step: Range(this->number_steps)) {
+         gradient[this->control_index(step)] = this->step_size * OptimalControlModel::control_weight * x[this->control_index(step)];
+      }
+   }
+
+   void OptimalControlModel::evaluate_constraint_jacobian(const Vector<double>& x, double* jacobian_values) const {
+      size_t nonzero_index = 0;
+      for (size_t step: Range(this->number_steps)) {
+         const double state = x[this->state_index(step)];
+         jacobian_values[nonzero_index++] = -1. + 3. * this->step_size * state * state;
+         jacobian_values[nonzero_index++] = 1.;
+         jacobian_values[nonzero_index++] = -this->step_size;
+      }
+      jacobian_values[nonzero_index] = 1.;
+   }
+
+   void OptimalControlModel::evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier,
+         const Vector<double>& multipliers, double* hessian_values) const {
+      // the Lagrangian is objective_multiplier * f - multipliers^T c
+      for (size_t step: Range(this->number_steps + 1)) {
+         double value = objective_multiplier * this->step_size;
+         if (step < this->number_steps) {
+            value -= multipliers[step] * 6. * this->step_size * x[this->state_index(step)];
+         }
+         hessian_values[this->state_index(step)] = value;
+      }
+      for (size_t step: Range(this->number_steps)) {
+         hessian_values[this->control_index(step)] = objective_multiplier * this->step_size * OptimalControlModel::control_weight;
+      }
+   }
+} // namespace
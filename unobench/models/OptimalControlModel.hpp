@@ -0,0 +1,39 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_OPTIMALCONTROLMODEL_H
+#define UNO_OPTIMALCONTROLMODEL_H
+
+#include "BenchmarkModel.hpp"
+
+namespace uno {
+   // tracking problem for the nonlinear ODE y' = -y^3 + u on [0, 1], discretized with N explicit Euler steps (h = 1/N):
+   // min h sum_{k=0}^{N} 1/2 (y_k - y^_k)^2 + h alpha sum_{k=0}^{N-1} 1/2 u_k^2
+   // s.t. y_{k+1} - y_k - h (-y_k^3 + u_k) = 0, k = 0, ..., N-1
+   //      y_0 = 1
+   //      -1 <= u_k <= 1
+   // The variables are ordered as (y_0, ..., y_N, u_0, ..., u_{N-1}), that is 2N+1 variables and N+1 constraints
+   class OptimalControlModel: public BenchmarkModel {
+   public:
+      // the number of discretization steps is chosen such that the model has about number_variables variables
+      explicit OptimalControlModel(size_t number_variables);
+
+      [[nodiscard]] double evaluate_objective(const Vector<double>& x) const override;
+      void evaluate_constraints(const Vector<double>& x, Vector<double>& constraints) const override;
+      void evaluate_objective_gradient(const Vector<double>& x, Vector<double>& gradient) const override;
+      void evaluate_constraint_jacobian(const Vector<double>& x, double* jacobian_values) const override;
+      void evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+         double* hessian_values) const override;
+
+   private:
+      const size_t number_steps;
+      const double step_size;
+      static constexpr double control_weight{1e-2};
+      Vector<double> target_states;
+
+      [[nodiscard]] size_t state_index(size_t step) const { return step; }
+      [[nodiscard]] size_t control_index(size_t step) const { return this->number_steps + 1 + step; }
+   };
+} // namespace
+
+#endif // UNO_OPTIMALCONTROLMODEL_H
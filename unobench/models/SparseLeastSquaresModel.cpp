@@ -0,0 +1,82 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include "SparseLeastSquaresModel.hpp"
+#include "symbolic/Range.hpp"
+
+namespace uno {
+   SparseLeastSquaresModel::SparseLeastSquaresModel(size_t number_unknowns):
+         BenchmarkModel("sparse_least_squares_" + std::to_string(number_unknowns), 3 * number_unknowns, 2 * number_unknowns),
+         number_unknowns(number_unknowns), number_rows(2 * number_unknowns) {
+      // unknowns x >= 0, free residuals r
+      for (size_t variable_index: Range(this->number_unknowns)) {
+         this->variables_lower_bounds[variable_index] = 0.;
+         this->initial_point[variable_index] = 1.;
+      }
+      for (size_t row_index: Range(this->number_rows)) {
+         // A x - r = b
+         const std::array<size_t, 3> columns{row_index % this->number_unknowns, (row_index + 1) % this->number_unknowns,
+            (row_index + this->number_unknowns / 2) % this->number_unknowns};
+         const std::array<double, 3> coefficients{1. + static_cast<double>(row_index % 3), -0.5,
+            0.25 * (1. + static_cast<double>(row_index % 5))};
+         for (size_t term: Range(3)) {
+            this->jacobian_row_indices.push_back(static_cast<int>(row_index));
+            this->jacobian_column_indices.push_back(static_cast<int>(columns[term]));
+            this->matrix_values.push_back(coefficients[term]);
+         }
+         this->jacobian_row_indices.push_back(static_cast<int>(row_index));
+         this->jacobian_column_indices.push_back(static_cast<int>(this->number_unknowns + row_index));
+         this->matrix_values.push_back(-1.);
+
+         const double rhs = 1. + std::sin(static_cast<double>(row_index));
+         this->constraints_lower_bounds[row_index] = rhs;
+         this->constraints_upper_bounds[row_index] = rhs;
+         this->linear_constraints.push_back(row_index);
+      }
+      // the Hessian is the identity on the residuals
+      for (size_t row_index: Range(this->number_rows)) {
+         this->hessian_row_indices.push_back(static_cast<int>(this->number_unknowns + row_index));
+         this->hessian_column_indices.push_back(static_cast<int>(this->number_unknowns + row_index));
+      }
+      this->partition_model();
+   }
+
+   double SparseLeastSquaresModel::evaluate_objective(const Vector<double>& x) const {
+      double objective = 0.;
+      for (size_t row_index: Range(this->number_rows)) {
+         const double residual = x[this->number_unknowns + row_index];
+         objective += residual * residual;
+      }
+      return 0.5 * objective;
+   }
+
+   void SparseLeastSquaresModel::evaluate_constraints(const Vector<double>& x, Vector<double>& constraints) const {
+      constraints.fill(0.);
+      for (size_t nonzero_index: Range(this->matrix_values.size())) {
+         const size_t row_index = static_cast<size_t>(this->jacobian_row_indices[nonzero_index]);
+         const size_t column_index = static_cast<size_t>(this->jacobian_column_indices[nonzero_index]);
+         constraints[row_index] += this->matrix_values[nonzero_index] * x[column_index];
+      }
+   }
+
+   void SparseLeastSquaresModel::evaluate_objective_gradient(const Vector<double>& x, Vector<double>& gradient) const {
+      for (size_t variable_index: Range(this->number_unknowns)) {
+         gradient[variable_index] = 0.;
+      }
+      for (size_t row_index: Range(this->number_rows)) {
+         gradient[this->number_unknowns + row_index] = x[this->number_unknowns + row_index];
+      }
+   }
+
+   void SparseLeastSquaresModel::evaluate_constraint_jacobian(const Vector<double>& /*x*/, double* jacobian_values) const {
+      std::copy(this->matrix_values.begin(), this->matrix_values.end(), jacobian_values);
+   }
+
+   void SparseLeastSquaresModel::evaluate_lagrangian_hessian(const Vector<double>& /*x*/, double objective_multiplier,
+         const Vector<double>& /*multipliers*/, double* hessian_values) const {
+      std::fill_n(hessian_values, this->number_rows, objective_multiplier);
+   }
+} // namespace
@@ -0,0 +1,32 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_SPARSELEASTSQUARESMODEL_H
+#define UNO_SPARSELEASTSQUARESMODEL_H
+
+#include "BenchmarkModel.hpp"
+
+namespace uno {
+   // nonnegative sparse least squares in residual form:
+   // min 1/2 ||r||^2 s.t. A x - r = b, x >= 0
+   // where A has 2n rows and 3 nonzeros per row. The model has n + 2n variables and 2n linear equality constraints
+   class SparseLeastSquaresModel: public BenchmarkModel {
+   public:
+      explicit SparseLeastSquaresModel(size_t number_unknowns);
+
+      [[nodiscard]] double evaluate_objective(const Vector<double>& x) const override;
+      void evaluate_constraints(const Vector<double>& x, Vector<double>& constraints) const override;
+      void evaluate_objective_gradient(const Vector<double>& x, Vector<double>& gradient) const override;
+      void evaluate_constraint_jacobian(const Vector<double>& x, double* jacobian_values) const override;
+      void evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+         double* hessian_values) const override;
+
+   private:
+      const size_t number_unknowns;
+      const size_t number_rows;
+      // values of A (3 per row) followed by -1 for the residual
+      std::vector<double> matrix_values{};
+   };
+} // namespace
+
+#endif // UNO_SPARSELEASTSQUARESMODEL_H
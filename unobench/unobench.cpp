@@ -0,0 +1,121 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+// Benchmarks of the Uno presets and subproblem solvers on generated parametric models.
+// Run "uno_bench --benchmark_out=timings.json --benchmark_out_format=json" to obtain JSON timings that can be compared
+// between commits (e.g. with the compare.py tool of Google Benchmark), and "--benchmark_filter=<regex>" to select the
+// models, presets, solvers and sizes
+
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "Uno.hpp"
+#include "ingredients/subproblem_solvers/LPSolverFactory.hpp"
+#include "ingredients/subproblem_solvers/QPSolverFactory.hpp"
+#include "ingredients/subproblem_solvers/SymmetricIndefiniteLinearSolverFactory.hpp"
+#include "models/BoundConstrainedQuadraticModel.hpp"
+#include "models/OptimalControlModel.hpp"
+#include "models/SparseLeastSquaresModel.hpp"
+#include "options/DefaultOptions.hpp"
+#include "options/Options.hpp"
+#include "options/Presets.hpp"
+#include "tools/Logger.hpp"
+
+using namespace uno;
+
+namespace {
+   struct GeneratedModel {
+      std::string name;
+      std::function<std::unique_ptr<Model>(size_t)> create;
+   };
+
+   // sizes of the generated models: from 10^3 to 10^6 variables, and from 10 to 10^2 for the dense solvers
+   constexpr size_t smallest_size = 1000;
+   constexpr size_t largest_size = 1000000;
+   constexpr size_t smallest_dense_size = 10;
+   constexpr size_t largest_dense_size = 100;
+
+   // a preset combined with one of its subproblem solvers
+   struct SolverConfiguration {
+      std::string preset;
+      std::string solver_option;
+      std::string solver;
+      size_t minimum_size{smallest_size};
+      size_t maximum_size{largest_size};
+   };
+
+   std::vector<SolverConfiguration> available_configurations() {
+      std::vector<SolverConfiguration> configurations;
+      for (const std::string& linear_solver: SymmetricIndefiniteLinearSolverFactory::available_solvers()) {
+         if (linear_solver == "DenseLDL") {
+            // the dense factorization is cubic in the dimension
+            configurations.push_back({"ipopt", "linear_solver", linear_solver, smallest_dense_size, largest_dense_size});
+         }
+         // the generated models have no block-bordered structure: the Schur-complement decomposition does not apply
+         else if (linear_solver != "SchurComplement") {
+            configurations.push_back({"ipopt", "linear_solver", linear_solver});
+         }
+      }
+      for (const char* QP_solver: QPSolverFactory::available_solvers) {
+         configurations.push_back({"filtersqp", "QP_solver", QP_solver});
+         configurations.push_back({"funnelsqp", "QP_solver", QP_solver});
+      }
+      for (const char* LP_solver: LPSolverFactory::available_solvers) {
+         configurations.push_back({"filterslp", "LP_solver", LP_solver});
+      }
+      return configurations;
+   }
+
+   void solve_model(benchmark::State& state, const GeneratedModel& generated_model, const SolverConfiguration& configuration) {
+      const std::unique_ptr<Model> model = generated_model.create(static_cast<size_t>(state.range(0)));
+      Options options;
+      DefaultOptions::load(options);
+      Presets::set(options, configuration.preset);
+      options.set(configuration.solver_option, configuration.solver);
+      options.set("logger", "SILENT");
+      Logger::set_logger("SILENT");
+
+      Uno uno;
+      for (auto _: state) {
+         const Result result = uno.solve(*model, options);
+         state.counters["iterations"] = static_cast<double>(result.number_iterations);
+         state.counters["objective"] = result.solution_objective;
+         state.counters["primal_feasibility"] = result.solution_primal_feasibility;
+         state.counters["optimization_status"] = static_cast<double>(result.optimization_status);
+         state.counters["solution_status"] = static_cast<double>(result.solution_status);
+         state.counters["subproblems"] = static_cast<double>(result.number_subproblems_solved);
+      }
+      state.counters["variables"] = static_cast<double>(model->number_variables);
+      state.counters["constraints"] = static_cast<double>(model->number_constraints);
+   }
+} // namespace
+
+int main(int argc, char** argv) {
+   const std::vector<GeneratedModel> generated_models{
+      {"OptimalControl", [](size_t size) { return std::make_unique<OptimalControlModel>(size); }},
+      {"SparseLeastSquares", [](size_t size) { return std::make_unique<SparseLeastSquaresModel>(size); }},
+      {"BoundConstrainedQuadratic", [](size_t size) { return std::make_unique<BoundConstrainedQuadraticModel>(size); }}
+   };
+
+   benchmark::Initialize(&argc, argv);
+   const std::vector<SolverConfiguration> configurations = available_configurations();
+   if (configurations.empty()) {
+      std::cout << "No subproblem solver is available: Uno was compiled without QP, LP and linear solvers\n";
+   }
+   for (const GeneratedModel& generated_model: generated_models) {
+      for (const SolverConfiguration& configuration: configurations) {
+         const std::string name = generated_model.name + "/" + configuration.preset + "/" + configuration.solver;
+         benchmark::RegisterBenchmark(name.c_str(), solve_model, generated_model, configuration)
+            ->RangeMultiplier(10)->Range(static_cast<int64_t>(configuration.minimum_size), static_cast<int64_t>(configuration.maximum_size))
+            ->Unit(benchmark::kMillisecond)
+            ->UseRealTime();
+      }
+   }
+   benchmark::RunSpecifiedBenchmarks();
+   benchmark::Shutdown();
+   return 0;
+}
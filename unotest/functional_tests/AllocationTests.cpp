@@ -0,0 +1,282 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+#include <vector>
+#include "Uno.hpp"
+#include "linear_algebra/SparseVector.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "model/Model.hpp"
+#include "optimization/Multipliers.hpp"
+#include "options/DefaultOptions.hpp"
+#include "options/Options.hpp"
+#include "options/Presets.hpp"
+#include "symbolic/CollectionAdapter.hpp"
+#include "symbolic/Range.hpp"
+#include "tools/Infinity.hpp"
+#include "tools/Logger.hpp"
+#include "tools/UserCallbacks.hpp"
+
+// count the calls to the global operator new (the array and nothrow versions forward to it)
+namespace {
+   std::atomic<size_t> number_allocations{0};
+}
+
+void* operator new(std::size_t size) {
+   ++number_allocations;
+   if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+      return pointer;
+   }
+   throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept {
+   std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t /*size*/) noexcept {
+   std::free(pointer);
+}
+
+using namespace uno;
+
+namespace {
+   // min sum_i (x_i - 1)^4 + sum_i (x_i - x_{i+1})^2 s.t. -2 <= x <= 2 and, optionally, the equality constraint sum_i x_i^2 = n.
+   // The solution x = 1 is degenerate, which makes for a fair number of iterations
+   class ChainedQuarticModel: public Model {
+   public:
+      ChainedQuarticModel(size_t number_variables, bool constrained):
+            Model("chained_quartic", number_variables, constrained ? 1 : 0, 1.),
+            equality_constraints_collection(this->equality_constraints),
+            inequality_constraints_collection(this->inequality_constraints),
+            linear_constraints_collection(this->linear_constraints) {
+         if (constrained) {
+            this->equality_constraints.push_back(0);
+         }
+      }
+
+      [[nodiscard]] bool has_jacobian_operator() const override { return true; }
+      [[nodiscard]] bool has_jacobian_transposed_operator() const override { return true; }
+      [[nodiscard]] bool has_hessian_operator() const override { return true; }
+      [[nodiscard]] bool has_hessian_matrix() const override { return true; }
+
+      [[nodiscard]] double evaluate_objective(const Vector<double>& x) const override {
+         double objective = 0.;
+         for (size_t index: Range(this->number_variables)) {
+            objective += std::pow(x[index] - 1., 4);
+         }
+         for (size_t index: Range(this->number_variables - 1)) {
+            objective += std::pow(x[index] - x[index + 1], 2);
+         }
+         return objective;
+      }
+
+      void evaluate_constraints(const Vector<double>& x, Vector<double>& constraints) const override {
+         if (0 < this->number_constraints) {
+            constraints[0] = 0.;
+            for (size_t index: Range(this->number_variables)) {
+               constraints[0] += x[index] * x[index];
+            }
+         }
+      }
+
+      void evaluate_objective_gradient(const Vector<double>& x, Vector<double>& gradient) const override {
+         for (size_t index: Range(this->number_variables)) {
+            gradient[index] = 4. * std::pow(x[index] - 1., 3);
+         }
+         for (size_t index: Range(this->number_variables - 1)) {
+            const double difference = x[index] - x[index + 1];
+            gradient[index] += 2. * difference;
+            gradient[index + 1] -= 2. * difference;
+         }
+      }
+
+      void compute_constraint_jacobian_sparsity(int* row_indices, int* column_indices, int solver_indexing,
+            MatrixOrder /*matrix_order*/) const override {
+         for (size_t index: Range(this->number_jacobian_nonzeros())) {
+            row_indices[index] = solver_indexing;
+            column_indices[index] = static_cast<int>(index) + solver_indexing;
+         }
+      }
+
+      // lower triangle of the tridiagonal Hessian: diagonal entries first, then subdiagonal entries
+      void compute_hessian_sparsity(int* row_indices, int* column_indices, int solver_indexing) const override {
+         for (size_t index: Range(this->number_variables)) {
+            row_indices[index] = column_indices[index] = static_cast<int>(index) + solver_indexing;
+         }
+         for (size_t index: Range(this->number_variables - 1)) {
+            row_indices[this->number_variables + index] = static_cast<int>(index + 1) + solver_indexing;
+            column_indices[this->number_variables + index] = static_cast<int>(index) + solver_indexing;
+         }
+      }
+
+      void evaluate_constraint_jacobian(const Vector<double>& x, double* jacobian_values) const override {
+         for (size_t index: Range(this->number_jacobian_nonzeros())) {
+            jacobian_values[index] = 2. * x[index];
+         }
+      }
+
+      void evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+            double* hessian_values) const override {
+         for (size_t index: Range(this->number_variables)) {
+            hessian_values[index] = this->hessian_diagonal_term(x.data(), objective_multiplier, multipliers, index);
+         }
+         for (size_t index: Range(this->number_variables - 1)) {
+            hessian_values[this->number_variables + index] = -2. * objective_multiplier;
+         }
+      }
+
+      void compute_jacobian_vector_product(const double* x, const double* vector, double* result) const override {
+         if (0 < this->number_constraints) {
+            result[0] = 0.;
+            for (size_t index: Range(this->number_variables)) {
+               result[0] += 2. * x[index] * vector[index];
+            }
+         }
+      }
+
+      void compute_jacobian_transposed_vector_product(const double* x, const double* vector, double* result) const override {
+         for (size_t index: Range(this->number_variables)) {
+            result[index] = (0 < this->number_constraints) ? 2. * x[index] * vector[0] : 0.;
+         }
+      }
+
+      void compute_hessian_vector_product(const double* x, const double* vector, double objective_multiplier,
+            const Vector<double>& multipliers, double* result) const override {
+         for (size_t index: Range(this->number_variables)) {
+            result[index] = this->hessian_diagonal_term(x, objective_multiplier, multipliers, index) * vector[index];
+         }
+         for (size_t index: Range(this->number_variables - 1)) {
+            result[index + 1] -= 2. * objective_multiplier * vector[index];
+            result[index] -= 2. * objective_multiplier * vector[index + 1];
+         }
+      }
+
+      [[nodiscard]] double variable_lower_bound(size_t /*variable_index*/) const override { return -2.; }
+      [[nodiscard]] double variable_upper_bound(size_t /*variable_index*/) const override { return 2.; }
+      [[nodiscard]] const SparseVector<size_t>& get_slacks() const override { return this->slacks; }
+      [[nodiscard]] const Vector<size_t>& get_fixed_variables() const override { return this->fixed_variables; }
+
+      [[nodiscard]] double constraint_lower_bound(size_t /*constraint_index*/) const override {
+         return static_cast<double>(this->number_variables);
+      }
+      [[nodiscard]] double constraint_upper_bound(size_t /*constraint_index*/) const override {
+         return static_cast<double>(this->number_variables);
+      }
+      [[nodiscard]] const Collection<size_t>& get_equality_constraints() const override { return this->equality_constraints_collection; }
+      [[nodiscard]] const Collection<size_t>& get_inequality_constraints() const override { return this->inequality_constraints_collection; }
+      [[nodiscard]] const Collection<size_t>& get_linear_constraints() const override { return this->linear_constraints_collection; }
+
+      void initial_primal_point(Vector<double>& x) const override {
+         for (size_t index: Range(this->number_variables)) {
+            x[index] = 0.5;
+         }
+      }
+      void initial_dual_point(Vector<double>& multipliers) const override { multipliers.fill(0.); }
+      void postprocess_solution(Iterate& /*iterate*/) const override { }
+
+      [[nodiscard]] size_t number_jacobian_nonzeros() const override { return (0 < this->number_constraints) ? this->number_variables : 0; }
+      [[nodiscard]] size_t number_hessian_nonzeros() const override { return 2 * this->number_variables - 1; }
+
+   private:
+      const SparseVector<size_t> slacks{};
+      const Vector<size_t> fixed_variables{};
+      std::vector<size_t> equality_constraints{};
+      std::vector<size_t> inequality_constraints{};
+      std::vector<size_t> linear_constraints{};
+      CollectionAdapter<std::vector<size_t>> equality_constraints_collection;
+      CollectionAdapter<std::vector<size_t>> inequality_constraints_collection;
+      CollectionAdapter<std::vector<size_t>> linear_constraints_collection;
+
+      [[nodiscard]] double hessian_diagonal_term(const double* x, double objective_multiplier, const Vector<double>& multipliers,
+            size_t index) const {
+         const double number_neighbors = static_cast<double>((0 < index) + (index + 1 < this->number_variables));
+         const double constraint_term = (0 < this->number_constraints) ? -2. * multipliers[0] : 0.;
+         return objective_multiplier * (12. * std::pow(x[index] - 1., 2) + 2. * number_neighbors) + constraint_term;
+      }
+   };
+
+   // records the number of allocations performed during each major iteration
+   class AllocationCounter: public UserCallbacks {
+   public:
+      explicit AllocationCounter(size_t maximum_number_iterations) {
+         this->allocations_per_iteration.reserve(maximum_number_iterations);
+      }
+
+      void notify_acceptable_iterate(const Vector<double>& /*primals*/, const Multipliers& /*multipliers*/,
+         double /*objective_multiplier*/) override { }
+
+      // called once at the end of each major iteration
+      void notify_new_primals(const Vector<double>& /*primals*/) override {
+         const size_t current_number_allocations = number_allocations;
+         this->allocations_per_iteration.push_back(current_number_allocations - this->previous_number_allocations);
+         this->previous_number_allocations = current_number_allocations;
+      }
+
+      void notify_new_multipliers(const Multipliers& /*multipliers*/) override { }
+
+      void start() {
+         this->previous_number_allocations = number_allocations;
+      }
+
+      std::vector<size_t> allocations_per_iteration{};
+
+   protected:
+      size_t previous_number_allocations{0};
+   };
+
+   void check_steady_state_allocations(const Model& model, Options& options) {
+      constexpr size_t maximum_number_iterations = 200;
+      options.set("max_iterations", std::to_string(maximum_number_iterations));
+      // the messages and the statistics table are formatted into strings: they are not part of the steady state
+      const Level logger_level = Logger::level;
+      Logger::set_logger("SILENT");
+
+      AllocationCounter allocation_counter(maximum_number_iterations);
+      Uno uno;
+      allocation_counter.start();
+      const Result result = uno.solve(model, options, allocation_counter);
+      Logger::level = logger_level;
+      ASSERT_EQ(result.optimization_status, OptimizationStatus::SUCCESS);
+      ASSERT_EQ(result.solution_status, SolutionStatus::FEASIBLE_KKT_POINT);
+
+      // the first count includes the initialization of the solver and of its ingredients
+      const std::vector<size_t>& allocations = allocation_counter.allocations_per_iteration;
+      ASSERT_LT(2, allocations.size());
+      for (size_t iteration: Range(1, allocations.size())) {
+         EXPECT_EQ(allocations[iteration], 0) << "at iteration " << iteration + 1;
+      }
+   }
+} // namespace
+
+TEST(Allocations, BoundConstrainedTrustRegion) {
+   const ChainedQuarticModel model(10, false);
+   Options options;
+   DefaultOptions::load(options);
+   Presets::set(options, "ipopt");
+   options.set("inequality_handling_method", "inequality_constrained");
+   options.set("globalization_mechanism", "TR");
+   check_steady_state_allocations(model, options);
+}
+
+TEST(Allocations, EqualityConstrainedInteriorPoint) {
+   const ChainedQuarticModel model(10, true);
+   Options options;
+   DefaultOptions::load(options);
+   Presets::set(options, "ipopt");
+   options.set("linear_solver", "MINRES");
+   check_steady_state_allocations(model, options);
+}
+
+TEST(Allocations, EqualityConstrainedInteriorPointDenseLDL) {
+   const ChainedQuarticModel model(10, true);
+   Options options;
+   DefaultOptions::load(options);
+   Presets::set(options, "ipopt");
+   options.set("linear_solver", "DenseLDL");
+   check_steady_state_allocations(model, options);
+}
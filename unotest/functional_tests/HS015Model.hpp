@@ -0,0 +1,154 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_HS015MODEL_H
+#define UNO_HS015MODEL_H
+
+#include <cmath>
+#include <vector>
+#include "linear_algebra/SparseVector.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "model/Model.hpp"
+#include "symbolic/CollectionAdapter.hpp"
+#include "symbolic/Range.hpp"
+#include "tools/Infinity.hpp"
+
+namespace uno {
+   // problem 15 of the Hock-Schittkowski collection:
+   // min 100 (x1 - x0^2)^2 + (1 - x0)^2 s.t. x0 x1 >= 1, x0 + x1^2 >= 0, x0 <= 0.5.
+   // The solution is x* = (0.5, 2) with f(x*) = 306.5. The bounds of x0 and the lower bound of the first constraint can be
+   // changed to perturb the problem; with identical bounds on x0, the model has a fixed variable
+   class HS015Model: public Model {
+   public:
+      explicit HS015Model(double first_variable_lower_bound = -INF<double>, double first_variable_upper_bound = 0.5,
+            double first_constraint_lower_bound = 1.):
+            Model("hs015", 2, 2, 1.),
+            first_variable_lower_bound(first_variable_lower_bound),
+            first_variable_upper_bound(first_variable_upper_bound),
+            first_constraint_lower_bound(first_constraint_lower_bound),
+            equality_constraints_collection(this->equality_constraints),
+            inequality_constraints_collection(this->inequality_constraints),
+            linear_constraints_collection(this->linear_constraints) {
+         Model::find_fixed_variables(this->fixed_variables);
+         Model::partition_constraints(this->equality_constraints, this->inequality_constraints);
+      }
+
+      [[nodiscard]] bool has_jacobian_operator() const override { return true; }
+      [[nodiscard]] bool has_jacobian_transposed_operator() const override { return true; }
+      [[nodiscard]] bool has_hessian_operator() const override { return true; }
+      [[nodiscard]] bool has_hessian_matrix() const override { return true; }
+
+      [[nodiscard]] double evaluate_objective(const Vector<double>& x) const override {
+         return 100. * std::pow(x[1] - x[0] * x[0], 2) + std::pow(1. - x[0], 2);
+      }
+
+      void evaluate_constraints(const Vector<double>& x, Vector<double>& constraints) const override {
+         constraints[0] = x[0] * x[1];
+         constraints[1] = x[0] + x[1] * x[1];
+      }
+
+      void evaluate_objective_gradient(const Vector<double>& x, Vector<double>& gradient) const override {
+         gradient[0] = 400. * std::pow(x[0], 3) - 400. * x[0] * x[1] + 2. * x[0] - 2.;
+         gradient[1] = 200. * (x[1] - x[0] * x[0]);
+      }
+
+      // the Jacobian is dense (column-wise)
+      void compute_constraint_jacobian_sparsity(int* row_indices, int* column_indices, int solver_indexing,
+            MatrixOrder /*matrix_order*/) const override {
+         for (size_t index: Range(this->number_jacobian_nonzeros())) {
+            row_indices[index] = static_cast<int>(index % 2) + solver_indexing;
+            column_indices[index] = static_cast<int>(index / 2) + solver_indexing;
+         }
+      }
+
+      // lower triangle of the Hessian
+      void compute_hessian_sparsity(int* row_indices, int* column_indices, int solver_indexing) const override {
+         row_indices[0] = solver_indexing;
+         column_indices[0] = solver_indexing;
+         row_indices[1] = 1 + solver_indexing;
+         column_indices[1] = solver_indexing;
+         row_indices[2] = 1 + solver_indexing;
+         column_indices[2] = 1 + solver_indexing;
+      }
+
+      void evaluate_constraint_jacobian(const Vector<double>& x, double* jacobian_values) const override {
+         jacobian_values[0] = x[1];
+         jacobian_values[1] = 1.;
+         jacobian_values[2] = x[0];
+         jacobian_values[3] = 2. * x[1];
+      }
+
+      void evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+            double* hessian_values) const override {
+         HS015Model::evaluate_hessian(x.data(), objective_multiplier, multipliers, hessian_values);
+      }
+
+      void compute_jacobian_vector_product(const double* x, const double* vector, double* result) const override {
+         result[0] = x[1] * vector[0] + x[0] * vector[1];
+         result[1] = vector[0] + 2. * x[1] * vector[1];
+      }
+
+      void compute_jacobian_transposed_vector_product(const double* x, const double* vector, double* result) const override {
+         result[0] = x[1] * vector[0] + vector[1];
+         result[1] = x[0] * vector[0] + 2. * x[1] * vector[1];
+      }
+
+      void compute_hessian_vector_product(const double* x, const double* vector, double objective_multiplier,
+            const Vector<double>& multipliers, double* result) const override {
+         double hessian_values[3];
+         HS015Model::evaluate_hessian(x, objective_multiplier, multipliers, hessian_values);
+         result[0] = hessian_values[0] * vector[0] + hessian_values[1] * vector[1];
+         result[1] = hessian_values[1] * vector[0] + hessian_values[2] * vector[1];
+      }
+
+      [[nodiscard]] double variable_lower_bound(size_t variable_index) const override {
+         return (variable_index == 0) ? this->first_variable_lower_bound : -INF<double>;
+      }
+      [[nodiscard]] double variable_upper_bound(size_t variable_index) const override {
+         return (variable_index == 0) ? this->first_variable_upper_bound : INF<double>;
+      }
+      [[nodiscard]] const SparseVector<size_t>& get_slacks() const override { return this->slacks; }
+      [[nodiscard]] const Vector<size_t>& get_fixed_variables() const override { return this->fixed_variables; }
+
+      [[nodiscard]] double constraint_lower_bound(size_t constraint_index) const override {
+         return (constraint_index == 0) ? this->first_constraint_lower_bound : 0.;
+      }
+      [[nodiscard]] double constraint_upper_bound(size_t /*constraint_index*/) const override { return INF<double>; }
+      [[nodiscard]] const Collection<size_t>& get_equality_constraints() const override { return this->equality_constraints_collection; }
+      [[nodiscard]] const Collection<size_t>& get_inequality_constraints() const override { return this->inequality_constraints_collection; }
+      [[nodiscard]] const Collection<size_t>& get_linear_constraints() const override { return this->linear_constraints_collection; }
+
+      void initial_primal_point(Vector<double>& x) const override {
+         x[0] = -2.;
+         x[1] = 1.;
+      }
+      void initial_dual_point(Vector<double>& multipliers) const override { multipliers.fill(0.); }
+      void postprocess_solution(Iterate& /*iterate*/) const override { }
+
+      [[nodiscard]] size_t number_jacobian_nonzeros() const override { return 4; }
+      [[nodiscard]] size_t number_hessian_nonzeros() const override { return 3; }
+
+   private:
+      const double first_variable_lower_bound;
+      const double first_variable_upper_bound;
+      const double first_constraint_lower_bound;
+      const SparseVector<size_t> slacks{};
+      Vector<size_t> fixed_variables{};
+      std::vector<size_t> equality_constraints{};
+      std::vector<size_t> inequality_constraints{};
+      std::vector<size_t> linear_constraints{};
+      CollectionAdapter<std::vector<size_t>> equality_constraints_collection;
+      CollectionAdapter<std::vector<size_t>> inequality_constraints_collection;
+      CollectionAdapter<std::vector<size_t>> linear_constraints_collection;
+
+      // Lagrangian Hessian with the convention of Uno: objective_multiplier ∇²f(x) - sum_j y_j ∇²c_j(x)
+      static void evaluate_hessian(const double* x, double objective_multiplier, const Vector<double>& multipliers,
+            double* hessian_values) {
+         hessian_values[0] = objective_multiplier * (1200. * x[0] * x[0] - 400. * x[1] + 2.);
+         hessian_values[1] = -400. * objective_multiplier * x[0] - multipliers[0];
+         hessian_values[2] = 200. * objective_multiplier - 2. * multipliers[1];
+      }
+   };
+} // namespace
+
+#endif // UNO_HS015MODEL_H
@@ -0,0 +1,53 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include "HS015Model.hpp"
+#include "Uno.hpp"
+#include "options/DefaultOptions.hpp"
+#include "options/Options.hpp"
+#include "options/Presets.hpp"
+
+using namespace uno;
+
+namespace {
+   Options interior_point_options() {
+      Options options;
+      DefaultOptions::load(options);
+      Presets::set(options, "ipopt");
+      options.set("logger", "SILENT");
+      return options;
+   }
+} // namespace
+
+// the interior-point method reformulates the model with slacks (inequality constraints) and with constraints for the
+// fixed variables. The result must be expressed in the original model
+TEST(Result, DimensionsOfOriginalModel) {
+   // x0 is fixed at its optimal value 0.5
+   const HS015Model model(0.5, 0.5);
+   ASSERT_EQ(model.get_fixed_variables().size(), 1);
+   const Options options = interior_point_options();
+   Uno uno;
+   const Result result = uno.solve(model, options);
+   ASSERT_EQ(result.optimization_status, OptimizationStatus::SUCCESS);
+   EXPECT_EQ(result.number_variables, model.number_variables);
+   EXPECT_EQ(result.number_constraints, model.number_constraints);
+   EXPECT_NEAR(result.solution_objective, 306.5, 1e-4);
+   EXPECT_NEAR(result.primal_solution[0], 0.5, 1e-8);
+   EXPECT_NEAR(result.primal_solution[1], 2., 1e-6);
+   // the multiplier of the constraint of the fixed variable is moved back to its bounds
+   EXPECT_LT(1., std::abs(result.lower_bound_dual_solution[0]) + std::abs(result.upper_bound_dual_solution[0]));
+}
+
+// slacks only
+TEST(Result, DimensionsWithSlacks) {
+   const HS015Model model;
+   const Options options = interior_point_options();
+   Uno uno;
+   const Result result = uno.solve(model, options);
+   ASSERT_EQ(result.optimization_status, OptimizationStatus::SUCCESS);
+   EXPECT_EQ(result.number_variables, model.number_variables);
+   EXPECT_EQ(result.number_constraints, model.number_constraints);
+   EXPECT_NEAR(result.solution_objective, 306.5, 1e-4);
+}
@@ -0,0 +1,139 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include "HS015Model.hpp"
+#include "Uno.hpp"
+#include "optimization/Multipliers.hpp"
+#include "optimization/SensitivityAnalysis.hpp"
+#include "options/DefaultOptions.hpp"
+#include "options/Options.hpp"
+#include "options/Presets.hpp"
+#include "symbolic/Range.hpp"
+
+using namespace uno;
+
+namespace {
+   // the finite differences are only as accurate as the solutions of the perturbed problems
+   constexpr double perturbation_size = 1e-5;
+   constexpr double tolerance = 1e-3;
+
+   Options interior_point_options(bool sensitivity_analysis) {
+      Options options;
+      DefaultOptions::load(options);
+      Presets::set(options, "ipopt");
+      options.set("logger", "SILENT");
+      options.set("primal_tolerance", "1e-12");
+      options.set("dual_tolerance", "1e-12");
+      options.set("sensitivity_analysis", sensitivity_analysis ? "yes" : "no");
+      return options;
+   }
+
+   BoundPerturbation zero_perturbation(const Model& model) {
+      BoundPerturbation perturbation;
+      perturbation.variables_lower_bounds.resize(model.number_variables);
+      perturbation.variables_upper_bounds.resize(model.number_variables);
+      perturbation.constraints_lower_bounds.resize(model.number_constraints);
+      perturbation.constraints_upper_bounds.resize(model.number_constraints);
+      return perturbation;
+   }
+
+   Result solve(const Model& model) {
+      Uno uno;
+      Result result = uno.solve(model, interior_point_options(false));
+      EXPECT_EQ(result.optimization_status, OptimizationStatus::SUCCESS);
+      return result;
+   }
+
+   // compare the sensitivities with the central finite differences of the solutions of the perturbed problems
+   void check_against_finite_differences(const Vector<double>& primal_sensitivity, const Multipliers& dual_sensitivity,
+         const Result& forward_result, const Result& backward_result) {
+      for (size_t variable_index: Range(primal_sensitivity.size())) {
+         const double finite_difference = (forward_result.primal_solution[variable_index] -
+            backward_result.primal_solution[variable_index]) / (2. * perturbation_size);
+         EXPECT_NEAR(primal_sensitivity[variable_index], finite_difference, tolerance) << "for x" << variable_index;
+      }
+      for (size_t constraint_index: Range(dual_sensitivity.constraints.size())) {
+         const double finite_difference = (forward_result.constraint_dual_solution[constraint_index] -
+            backward_result.constraint_dual_solution[constraint_index]) / (2. * perturbation_size);
+         EXPECT_NEAR(dual_sensitivity.constraints[constraint_index], finite_difference, tolerance) << "for y" << constraint_index;
+      }
+   }
+} // namespace
+
+// perturbation of the lower bound of the active constraint x0 x1 >= 1
+TEST(SensitivityAnalysis, ConstraintBound) {
+   const HS015Model model;
+   Uno uno;
+   const Result result = uno.solve(model, interior_point_options(true));
+   ASSERT_EQ(result.optimization_status, OptimizationStatus::SUCCESS);
+
+   BoundPerturbation perturbation = zero_perturbation(model);
+   perturbation.constraints_lower_bounds[0] = 1.;
+   Vector<double> primal_sensitivity;
+   Multipliers dual_sensitivity;
+   uno.compute_sensitivity(perturbation, primal_sensitivity, dual_sensitivity);
+   // x0 is at its upper bound and x1 = cl/x0
+   EXPECT_NEAR(primal_sensitivity[0], 0., tolerance);
+   EXPECT_NEAR(primal_sensitivity[1], 2., tolerance);
+   EXPECT_NEAR(dual_sensitivity.constraints[0], 800., tolerance);
+
+   const Result forward_result = solve(HS015Model(-INF<double>, 0.5, 1. + perturbation_size));
+   const Result backward_result = solve(HS015Model(-INF<double>, 0.5, 1. - perturbation_size));
+   check_against_finite_differences(primal_sensitivity, dual_sensitivity, forward_result, backward_result);
+}
+
+// perturbation of the active upper bound x0 <= 0.5
+TEST(SensitivityAnalysis, VariableBound) {
+   const HS015Model model;
+   Uno uno;
+   const Result result = uno.solve(model, interior_point_options(true));
+   ASSERT_EQ(result.optimization_status, OptimizationStatus::SUCCESS);
+
+   BoundPerturbation perturbation = zero_perturbation(model);
+   perturbation.variables_upper_bounds[0] = 1.;
+   Vector<double> primal_sensitivity;
+   Multipliers dual_sensitivity;
+   uno.compute_sensitivity(perturbation, primal_sensitivity, dual_sensitivity);
+   EXPECT_NEAR(primal_sensitivity[0], 1., tolerance);
+   EXPECT_NEAR(primal_sensitivity[1], -4., tolerance);
+
+   const Result forward_result = solve(HS015Model(-INF<double>, 0.5 + perturbation_size));
+   const Result backward_result = solve(HS015Model(-INF<double>, 0.5 - perturbation_size));
+   check_against_finite_differences(primal_sensitivity, dual_sensitivity, forward_result, backward_result);
+}
+
+// perturbation of a fixed variable (parameter): it is perturbed through its lower bound
+TEST(SensitivityAnalysis, FixedVariable) {
+   const HS015Model model(0.5, 0.5);
+   Uno uno;
+   const Result result = uno.solve(model, interior_point_options(true));
+   ASSERT_EQ(result.optimization_status, OptimizationStatus::SUCCESS);
+
+   BoundPerturbation perturbation = zero_perturbation(model);
+   perturbation.variables_lower_bounds[0] = 1.;
+   Vector<double> primal_sensitivity;
+   Multipliers dual_sensitivity;
+   uno.compute_sensitivity(perturbation, primal_sensitivity, dual_sensitivity);
+   EXPECT_NEAR(primal_sensitivity[0], 1., tolerance);
+   EXPECT_NEAR(primal_sensitivity[1], -4., tolerance);
+
+   const double forward_value = 0.5 + perturbation_size;
+   const double backward_value = 0.5 - perturbation_size;
+   const Result forward_result = solve(HS015Model(forward_value, forward_value));
+   const Result backward_result = solve(HS015Model(backward_value, backward_value));
+   check_against_finite_differences(primal_sensitivity, dual_sensitivity, forward_result, backward_result);
+}
+
+TEST(SensitivityAnalysis, NotAvailableWithoutOption) {
+   const HS015Model model;
+   Uno uno;
+   const Result result = uno.solve(model, interior_point_options(false));
+   ASSERT_EQ(result.optimization_status, OptimizationStatus::SUCCESS);
+
+   const BoundPerturbation perturbation = zero_perturbation(model);
+   Vector<double> primal_sensitivity;
+   Multipliers dual_sensitivity;
+   EXPECT_THROW(uno.compute_sensitivity(perturbation, primal_sensitivity, dual_sensitivity), std::runtime_error);
+}
@@ -0,0 +1,45 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include "HS015Model.hpp"
+#include "Uno.hpp"
+#include "options/DefaultOptions.hpp"
+#include "options/Options.hpp"
+#include "options/Presets.hpp"
+#include "symbolic/Range.hpp"
+
+using namespace uno;
+
+namespace {
+   Result solve(const Model& model, bool condense_slacks) {
+      Options options;
+      DefaultOptions::load(options);
+      Presets::set(options, "ipopt");
+      options.set("logger", "SILENT");
+      options.set("barrier_condense_slacks", condense_slacks ? "yes" : "no");
+      Uno uno;
+      return uno.solve(model, options);
+   }
+} // namespace
+
+// the condensation of the slacks eliminates them from the augmented system. The reduced system is equivalent, so the
+// interior-point method converges to the same solution
+TEST(SlackCondensation, SameSolutionOnInequalityConstrainedModel) {
+   const HS015Model model;
+   ASSERT_EQ(model.get_inequality_constraints().size(), model.number_constraints);
+   const Result result = solve(model, false);
+   const Result condensed_result = solve(model, true);
+   ASSERT_EQ(result.optimization_status, OptimizationStatus::SUCCESS);
+   ASSERT_EQ(condensed_result.optimization_status, OptimizationStatus::SUCCESS);
+   // on hs015, 20 iterations with condensation and 21 without
+   EXPECT_LE(condensed_result.number_iterations, result.number_iterations);
+   EXPECT_NEAR(condensed_result.solution_objective, result.solution_objective, 1e-6);
+   EXPECT_NEAR(condensed_result.solution_objective, 306.5, 1e-4);
+   for (size_t variable_index: Range(model.number_variables)) {
+      EXPECT_NEAR(condensed_result.primal_solution[variable_index], result.primal_solution[variable_index], 1e-6);
+   }
+   for (size_t constraint_index: Range(model.number_constraints)) {
+      EXPECT_NEAR(condensed_result.constraint_dual_solution[constraint_index], result.constraint_dual_solution[constraint_index], 1e-4);
+   }
+}
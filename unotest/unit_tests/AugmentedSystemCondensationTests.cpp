@@ -0,0 +1,128 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <utility>
+#include <vector>
+#include "ingredients/subproblem_solvers/AugmentedSystemCondensation.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "symbolic/Range.hpp"
+
+using namespace uno;
+
+namespace {
+   // augmented system with 5 variables (x0, x1, and the elastic variables e0, e1, e2) and 2 constraints c0 and c1.
+   // Rows: x0 = 0, x1 = 1, e0 = 2, e1 = 3, e2 = 4, c0 = 5, c1 = 6
+   constexpr size_t number_variables = 5;
+   constexpr size_t number_constraints = 2;
+   constexpr size_t dimension = number_variables + number_constraints;
+   // Hessian (the diagonal term of e1 is split into two entries), Jacobian and regularization entries (Fortran indexing)
+   const std::vector<int> row_indices{1, 1, 2, 3, 4, 4, 5, 1, 2, 3, 1, 4, 5, 1, 2, 6, 7};
+   const std::vector<int> column_indices{1, 2, 2, 3, 4, 4, 5, 6, 6, 6, 7, 7, 7, 1, 2, 6, 7};
+   const Vector<double> matrix_values{4., 1., 3., 2., 1., 0.5, 5., 1., 2., -1., 3., 1., -1., 0.1, 0.1, -0.01, -0.01};
+   constexpr size_t number_unregularized_nonzeros = 13;
+   const Vector<double> rhs{1., -2., 3., 0.5, -1., 2., 4.};
+
+   using DenseMatrix = std::vector<std::vector<double>>;
+
+   DenseMatrix assemble_dense_matrix(size_t size, const std::vector<int>& rows, const std::vector<int>& columns,
+         const Vector<double>& values) {
+      DenseMatrix matrix(size, std::vector<double>(size, 0.));
+      for (size_t nonzero_index: Range(rows.size())) {
+         const size_t row_index = static_cast<size_t>(rows[nonzero_index] - 1);
+         const size_t column_index = static_cast<size_t>(columns[nonzero_index] - 1);
+         matrix[row_index][column_index] += values[nonzero_index];
+         if (row_index != column_index) {
+            matrix[column_index][row_index] += values[nonzero_index];
+         }
+      }
+      return matrix;
+   }
+
+   // Gaussian elimination with partial pivoting
+   Vector<double> solve_dense_system(DenseMatrix matrix, const Vector<double>& rhs) {
+      const size_t size = matrix.size();
+      Vector<double> result = rhs;
+      for (size_t column_index: Range(size)) {
+         size_t pivot_index = column_index;
+         for (size_t row_index: Range(column_index + 1, size)) {
+            if (std::abs(matrix[pivot_index][column_index]) < std::abs(matrix[row_index][column_index])) {
+               pivot_index = row_index;
+            }
+         }
+         std::swap(matrix[column_index], matrix[pivot_index]);
+         std::swap(result[column_index], result[pivot_index]);
+         for (size_t row_index: Range(column_index + 1, size)) {
+            const double factor = matrix[row_index][column_index] / matrix[column_index][column_index];
+            for (size_t index: Range(column_index, size)) {
+               matrix[row_index][index] -= factor * matrix[column_index][index];
+            }
+            result[row_index] -= factor * result[column_index];
+         }
+      }
+      for (size_t row_index = size; 0 < row_index--;) {
+         for (size_t index: Range(row_index + 1, size)) {
+            result[row_index] -= matrix[row_index][index] * result[index];
+         }
+         result[row_index] /= matrix[row_index][row_index];
+      }
+      return result;
+   }
+
+   size_t number_condensed_variables(const Collection<size_t>& candidate_variables) {
+      AugmentedSystemCondensation condensation;
+      condensation.initialize(candidate_variables, number_variables, number_constraints, row_indices, column_indices,
+         number_unregularized_nonzeros);
+      return condensation.number_condensed_variables();
+   }
+} // namespace
+
+TEST(AugmentedSystemCondensation, ElasticVariablesAreCondensed) {
+   // x1 is coupled to x0 in the Hessian and cannot be eliminated
+   AugmentedSystemCondensation condensation;
+   condensation.initialize(ForwardRange(1, number_variables), number_variables, number_constraints, row_indices,
+      column_indices, number_unregularized_nonzeros);
+   ASSERT_TRUE(condensation.is_active());
+   EXPECT_EQ(condensation.number_condensed_variables(), 3);
+   EXPECT_EQ(condensation.dimension(), dimension - 3);
+   // 6 kept entries, 2 constraint diagonal entries and 4 regularization entries
+   EXPECT_EQ(condensation.number_unregularized_nonzeros(), 8);
+   EXPECT_EQ(condensation.number_nonzeros(), 12);
+}
+
+TEST(AugmentedSystemCondensation, CondensedSolutionMatchesAugmentedSolution) {
+   AugmentedSystemCondensation condensation;
+   condensation.initialize(ForwardRange(1, number_variables), number_variables, number_constraints, row_indices,
+      column_indices, number_unregularized_nonzeros);
+
+   // condensed matrix and regularization entries
+   Vector<double> condensed_matrix_values(condensation.number_nonzeros());
+   condensation.condense_matrix(matrix_values, condensed_matrix_values);
+   for (size_t index: Range(condensation.number_nonzeros() - condensation.number_unregularized_nonzeros())) {
+      condensed_matrix_values[condensation.number_unregularized_nonzeros() + index] =
+         matrix_values[number_unregularized_nonzeros + index];
+   }
+   Vector<double> condensed_rhs(condensation.dimension());
+   condensation.condense_rhs(matrix_values, rhs, condensed_rhs);
+   const Vector<double> condensed_solution = solve_dense_system(assemble_dense_matrix(condensation.dimension(),
+      condensation.row_indices, condensation.column_indices, condensed_matrix_values), condensed_rhs);
+   Vector<double> solution(dimension);
+   condensation.expand_solution(matrix_values, rhs, condensed_solution, solution);
+
+   const Vector<double> reference_solution = solve_dense_system(assemble_dense_matrix(dimension, row_indices,
+      column_indices, matrix_values), rhs);
+   for (size_t index: Range(dimension)) {
+      EXPECT_NEAR(solution[index], reference_solution[index], 1e-12);
+   }
+}
+
+TEST(AugmentedSystemCondensation, InvalidCandidatesAreKept) {
+   // x0 appears in two constraints and is regularized
+   EXPECT_EQ(number_condensed_variables(ForwardRange(1)), 0);
+   // x1 is coupled to x0 in the Hessian and is regularized
+   EXPECT_EQ(number_condensed_variables(ForwardRange(1, 2)), 0);
+   // constraints are not variables
+   EXPECT_EQ(number_condensed_variables(ForwardRange(number_variables, dimension)), 0);
+   EXPECT_EQ(number_condensed_variables(ForwardRange(2, 3)), 1);
+}
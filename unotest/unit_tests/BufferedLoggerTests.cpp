@@ -0,0 +1,88 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include <thread>
+#include "tools/BufferedLogger.hpp"
+#include "tools/Logger.hpp"
+
+using namespace uno;
+
+TEST(BufferedLogger, CallbackSink) {
+   std::string messages;
+   {
+      BufferedLogger logger(std::make_unique<CallbackLogSink>([&](std::string_view new_messages) {
+         messages.append(new_messages);
+      }));
+      ASSERT_EQ(BufferedLogger::current(), &logger);
+      for (int index = 0; index < 1000; index++) {
+         DISCRETE << "line " << index << '\n';
+      }
+   }
+   ASSERT_EQ(BufferedLogger::current(), nullptr);
+   ASSERT_EQ(messages.substr(0, 14), "line 0\nline 1\n");
+   ASSERT_EQ(messages.substr(messages.size() - 9), "line 999\n");
+}
+
+TEST(BufferedLogger, Flush) {
+   std::string messages;
+   BufferedLogger logger(std::make_unique<CallbackLogSink>([&](std::string_view new_messages) {
+      messages.append(new_messages);
+   }));
+   DISCRETE << "message";
+   logger.flush();
+   ASSERT_EQ(messages, "message");
+}
+
+TEST(BufferedLogger, ShortLogIsWrittenByCurrentThread) {
+   // a few messages do not start the writer thread
+   std::thread::id writing_thread{};
+   {
+      BufferedLogger logger(std::make_unique<CallbackLogSink>([&](std::string_view /*new_messages*/) {
+         writing_thread = std::this_thread::get_id();
+      }));
+      DISCRETE << "message\n";
+   }
+   ASSERT_EQ(writing_thread, std::this_thread::get_id());
+}
+
+TEST(BufferedLogger, LongLogIsWrittenByWriterThread) {
+   // the messages exceed the capacity of the buffer
+   std::string messages;
+   std::thread::id writing_thread{};
+   {
+      BufferedLogger logger(std::make_unique<CallbackLogSink>([&](std::string_view new_messages) {
+         messages.append(new_messages);
+         writing_thread = std::this_thread::get_id();
+      }));
+      for (int index = 0; index < 20000; index++) {
+         DISCRETE << "line " << index << '\n';
+      }
+   }
+   ASSERT_NE(writing_thread, std::this_thread::get_id());
+   ASSERT_EQ(messages.substr(messages.size() - 11), "line 19999\n");
+}
+
+TEST(BufferedLogger, DisabledLevelIsNotEvaluated) {
+   const Level current_level = Logger::level;
+   Logger::level = INFO;
+   bool evaluated = false;
+   UNO_LOG(DEBUG) << [&]() { evaluated = true; return 1; }();
+   Logger::level = current_level;
+   ASSERT_FALSE(evaluated);
+}
+
+TEST(BufferedLogger, LevelIsPerThread) {
+   const Level current_level = Logger::level;
+   Logger::set_logger("DEBUG");
+   Level other_thread_level = SILENT;
+   std::thread other_thread([&]() {
+      other_thread_level = Logger::level;
+      Logger::set_logger("SILENT");
+   });
+   other_thread.join();
+   const Level level = Logger::level;
+   Logger::level = current_level;
+   ASSERT_EQ(other_thread_level, INFO);
+   ASSERT_EQ(level, DEBUG);
+}
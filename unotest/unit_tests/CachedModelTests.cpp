@@ -0,0 +1,155 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+#include "linear_algebra/SparseVector.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "model/CachedModel.hpp"
+#include "symbolic/CollectionAdapter.hpp"
+
+using namespace uno;
+
+namespace {
+   // min x0^2 + x1^2 s.t. x0*x1 = 1. Counts the number of evaluations
+   class CountingModel: public Model {
+   public:
+      CountingModel(): Model("counting", 2, 1, 1.), equality_constraints_collection(this->equality_constraints),
+            inequality_constraints_collection(this->inequality_constraints), linear_constraints_collection(this->linear_constraints) { }
+
+      [[nodiscard]] bool has_jacobian_operator() const override { return false; }
+      [[nodiscard]] bool has_jacobian_transposed_operator() const override { return false; }
+      [[nodiscard]] bool has_hessian_operator() const override { return false; }
+      [[nodiscard]] bool has_hessian_matrix() const override { return true; }
+
+      [[nodiscard]] double evaluate_objective(const Vector<double>& x) const override {
+         ++this->number_objective_evaluations;
+         if (this->fail) {
+            throw std::runtime_error("evaluation error");
+         }
+         return x[0]*x[0] + x[1]*x[1];
+      }
+      void evaluate_constraints(const Vector<double>& x, Vector<double>& constraints) const override {
+         ++this->number_constraint_evaluations;
+         constraints[0] = x[0]*x[1];
+      }
+      void evaluate_objective_gradient(const Vector<double>& x, Vector<double>& gradient) const override {
+         ++this->number_gradient_evaluations;
+         gradient[0] = 2.*x[0];
+         gradient[1] = 2.*x[1];
+      }
+      void evaluate_constraint_jacobian(const Vector<double>& x, double* jacobian_values) const override {
+         ++this->number_jacobian_evaluations;
+         jacobian_values[0] = x[1];
+         jacobian_values[1] = x[0];
+      }
+      void compute_constraint_jacobian_sparsity(int* row_indices, int* column_indices, int solver_indexing,
+            MatrixOrder /*matrix_order*/) const override {
+         row_indices[0] = row_indices[1] = solver_indexing;
+         column_indices[0] = solver_indexing;
+         column_indices[1] = 1 + solver_indexing;
+      }
+      void compute_hessian_sparsity(int* /*row_indices*/, int* /*column_indices*/, int /*solver_indexing*/) const override { }
+      void evaluate_lagrangian_hessian(const Vector<double>& /*x*/, double /*objective_multiplier*/,
+         const Vector<double>& /*multipliers*/, double* /*hessian_values*/) const override { }
+      void compute_jacobian_vector_product(const double* /*x*/, const double* /*vector*/, double* /*result*/) const override { }
+      void compute_jacobian_transposed_vector_product(const double* /*x*/, const double* /*vector*/, double* /*result*/) const override { }
+      void compute_hessian_vector_product(const double* /*x*/, const double* /*vector*/, double /*objective_multiplier*/,
+         const Vector<double>& /*multipliers*/, double* /*result*/) const override { }
+
+      [[nodiscard]] double variable_lower_bound(size_t /*variable_index*/) const override { return -10.; }
+      [[nodiscard]] double variable_upper_bound(size_t /*variable_index*/) const override { return 10.; }
+      [[nodiscard]] const SparseVector<size_t>& get_slacks() const override { return this->slacks; }
+      [[nodiscard]] const Vector<size_t>& get_fixed_variables() const override { return this->fixed_variables; }
+      [[nodiscard]] double constraint_lower_bound(size_t /*constraint_index*/) const override { return 1.; }
+      [[nodiscard]] double constraint_upper_bound(size_t /*constraint_index*/) const override { return 1.; }
+      [[nodiscard]] const Collection<size_t>& get_equality_constraints() const override { return this->equality_constraints_collection; }
+      [[nodiscard]] const Collection<size_t>& get_inequality_constraints() const override { return this->inequality_constraints_collection; }
+      [[nodiscard]] const Collection<size_t>& get_linear_constraints() const override { return this->linear_constraints_collection; }
+      void initial_primal_point(Vector<double>& x) const override { x.fill(1.); }
+      void initial_dual_point(Vector<double>& multipliers) const override { multipliers.fill(0.); }
+      void postprocess_solution(Iterate& /*iterate*/) const override { }
+      [[nodiscard]] size_t number_jacobian_nonzeros() const override { return 2; }
+      [[nodiscard]] size_t number_hessian_nonzeros() const override { return 0; }
+
+      mutable size_t number_objective_evaluations{0};
+      mutable size_t number_constraint_evaluations{0};
+      mutable size_t number_gradient_evaluations{0};
+      mutable size_t number_jacobian_evaluations{0};
+      bool fail{false};
+
+   private:
+      const SparseVector<size_t> slacks{};
+      const Vector<size_t> fixed_variables{};
+      std::vector<size_t> equality_constraints{0};
+      std::vector<size_t> inequality_constraints{};
+      std::vector<size_t> linear_constraints{};
+      CollectionAdapter<std::vector<size_t>> equality_constraints_collection;
+      CollectionAdapter<std::vector<size_t>> inequality_constraints_collection;
+      CollectionAdapter<std::vector<size_t>> linear_constraints_collection;
+   };
+} // namespace
+
+TEST(CachedModel, SamePoint) {
+   const CountingModel model;
+   const CachedModel cached_model(model, 2);
+   const Vector<double> x{2., 3.};
+   Vector<double> constraints(1);
+   Vector<double> gradient(2);
+   std::vector<double> jacobian(2);
+   for (size_t evaluation = 0; evaluation < 3; ++evaluation) {
+      ASSERT_EQ(cached_model.evaluate_objective(x), 13.);
+      cached_model.evaluate_constraints(x, constraints);
+      ASSERT_EQ(constraints[0], 6.);
+      cached_model.evaluate_objective_gradient(x, gradient);
+      ASSERT_EQ(gradient[1], 6.);
+      cached_model.evaluate_constraint_jacobian(x, jacobian.data());
+      ASSERT_EQ(jacobian[0], 3.);
+   }
+   ASSERT_EQ(model.number_objective_evaluations, 1);
+   ASSERT_EQ(model.number_constraint_evaluations, 1);
+   ASSERT_EQ(model.number_gradient_evaluations, 1);
+   ASSERT_EQ(model.number_jacobian_evaluations, 1);
+   ASSERT_EQ(cached_model.get_number_hits(), 8);
+   ASSERT_EQ(cached_model.get_number_misses(), 4);
+}
+
+// the additional variables of a reformulation (e.g. slacks or elastics) are not part of the key
+TEST(CachedModel, AdditionalVariables) {
+   const CountingModel model;
+   const CachedModel cached_model(model, 1);
+   ASSERT_EQ(cached_model.evaluate_objective(Vector<double>{2., 3.}), 13.);
+   ASSERT_EQ(cached_model.evaluate_objective(Vector<double>{2., 3., 5., 7.}), 13.);
+   ASSERT_EQ(model.number_objective_evaluations, 1);
+}
+
+TEST(CachedModel, RoundRobinEviction) {
+   const CountingModel model;
+   const CachedModel cached_model(model, 2);
+   const Vector<double> x1{1., 2.};
+   const Vector<double> x2{3., 4.};
+   const Vector<double> x3{5., 6.};
+   ASSERT_EQ(cached_model.evaluate_objective(x1), 5.);
+   ASSERT_EQ(cached_model.evaluate_objective(x2), 25.);
+   ASSERT_EQ(cached_model.evaluate_objective(x1), 5.);
+   ASSERT_EQ(model.number_objective_evaluations, 2);
+   // x3 replaces x1, the oldest entry
+   ASSERT_EQ(cached_model.evaluate_objective(x3), 61.);
+   ASSERT_EQ(cached_model.evaluate_objective(x2), 25.);
+   ASSERT_EQ(model.number_objective_evaluations, 3);
+   ASSERT_EQ(cached_model.evaluate_objective(x1), 5.);
+   ASSERT_EQ(model.number_objective_evaluations, 4);
+}
+
+// a failed evaluation is not stored
+TEST(CachedModel, FailedEvaluation) {
+   CountingModel model;
+   const CachedModel cached_model(model, 2);
+   const Vector<double> x{2., 3.};
+   model.fail = true;
+   ASSERT_THROW((void)cached_model.evaluate_objective(x), std::runtime_error);
+   model.fail = false;
+   ASSERT_EQ(cached_model.evaluate_objective(x), 13.);
+   ASSERT_EQ(model.number_objective_evaluations, 2);
+}
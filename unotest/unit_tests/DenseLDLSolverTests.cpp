@@ -0,0 +1,125 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "ingredients/subproblem_solvers/COOEvaluationSpace.hpp"
+#include "ingredients/subproblem_solvers/DenseLDL/DenseLDLSolver.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "options/DefaultOptions.hpp"
+#include "options/Options.hpp"
+#include "symbolic/Range.hpp"
+
+using namespace uno;
+
+namespace {
+   // set the sparsity pattern (Fortran indexing) of the matrix and factorize it
+   void factorize(DenseLDLSolver& solver, size_t dimension, const std::vector<int>& row_indices,
+         const std::vector<int>& column_indices, const Vector<double>& matrix_values) {
+      auto& evaluation_space = dynamic_cast<COOEvaluationSpace&>(solver.get_evaluation_space());
+      evaluation_space.dimension = dimension;
+      evaluation_space.number_matrix_nonzeros = row_indices.size();
+      evaluation_space.matrix_row_indices = row_indices;
+      evaluation_space.matrix_column_indices = column_indices;
+      solver.do_symbolic_analysis();
+      solver.do_numerical_factorization(matrix_values.data());
+   }
+
+   Options default_options() {
+      Options options;
+      DefaultOptions::load(options);
+      return options;
+   }
+} // namespace
+
+TEST(DenseLDLSolver, SystemSize5) {
+   const size_t n = 5;
+   // upper triangle of the matrix
+   const std::vector<int> row_indices{1, 1, 2, 2, 3, 3, 5};
+   const std::vector<int> column_indices{1, 2, 3, 5, 3, 4, 5};
+   const Vector<double> matrix_values{2., 3., 4., 6., 1., 5., 1.};
+   const Vector<double> rhs{8., 45., 31., 15., 17.};
+   const Vector<double> reference{1., 2., 3., 4., 5.};
+
+   const Options options = default_options();
+   DenseLDLSolver solver(options);
+   factorize(solver, n, row_indices, column_indices, matrix_values);
+   Vector<double> result(n);
+   solver.solve_indefinite_system(matrix_values, rhs, result);
+
+   for (size_t index: Range(n)) {
+      EXPECT_NEAR(result[index], reference[index], 1e-12);
+   }
+   const auto [number_positive, number_negative, number_zero] = solver.get_inertia();
+   EXPECT_EQ(number_positive, 3);
+   EXPECT_EQ(number_negative, 2);
+   EXPECT_EQ(number_zero, 0);
+}
+
+TEST(DenseLDLSolver, AugmentedSystemWithZeroDiagonal) {
+   // [H  A^T] with H = diag(0.1, 2, 3) and A = [1 1 0; 0 1 1]: the small diagonal of H and the zero diagonal of the
+   // [A  0  ] constraint block require a 2x2 pivot. Lower triangle of the matrix, with a duplicate entry
+   const size_t n = 5;
+   const std::vector<int> row_indices{1, 2, 3, 3, 4, 4, 5, 5};
+   const std::vector<int> column_indices{1, 2, 3, 3, 1, 2, 2, 3};
+   const Vector<double> matrix_values{0.1, 2., 1., 2., 1., 1., 1., 1.};
+   const Vector<double> reference{1., -1., 2., 3., -4.};
+   // rhs = K reference
+   const Vector<double> rhs{3.1, -3., 2., 0., 1.};
+
+   const Options options = default_options();
+   DenseLDLSolver solver(options);
+   factorize(solver, n, row_indices, column_indices, matrix_values);
+   Vector<double> result(n);
+   solver.solve_indefinite_system(matrix_values, rhs, result);
+
+   for (size_t index: Range(n)) {
+      EXPECT_NEAR(result[index], reference[index], 1e-12);
+   }
+   const auto [number_positive, number_negative, number_zero] = solver.get_inertia();
+   EXPECT_EQ(number_positive, 3);
+   EXPECT_EQ(number_negative, 2);
+   EXPECT_EQ(number_zero, 0);
+   EXPECT_FALSE(solver.matrix_is_singular());
+}
+
+TEST(DenseLDLSolver, SingularMatrix) {
+   // comes from hs015 solved with byrd preset
+   const size_t n = 4;
+   const std::vector<int> row_indices{1, 1, 1, 2, 2, 3, 4};
+   const std::vector<int> column_indices{1, 1, 2, 2, 2, 3, 4};
+   const Vector<double> matrix_values{-0.0198, 0.625075, -0.277512, -0.624975, 0.625075, 0., 0.};
+
+   const Options options = default_options();
+   DenseLDLSolver solver(options);
+   factorize(solver, n, row_indices, column_indices, matrix_values);
+
+   const auto [number_positive, number_negative, number_zero] = solver.get_inertia();
+   EXPECT_EQ(number_positive, 1);
+   EXPECT_EQ(number_negative, 1);
+   EXPECT_EQ(number_zero, 2);
+   EXPECT_TRUE(solver.matrix_is_singular());
+   EXPECT_EQ(solver.rank(), 2);
+}
+
+TEST(DenseLDLSolver, SolveAugmentedSystemWithAnotherRightHandSide) {
+   // the last factorization is reused for a new right-hand side (e.g. a sensitivity analysis)
+   const size_t n = 5;
+   const std::vector<int> row_indices{1, 1, 2, 2, 3, 3, 5};
+   const std::vector<int> column_indices{1, 2, 3, 5, 3, 4, 5};
+   const Vector<double> matrix_values{2., 3., 4., 6., 1., 5., 1.};
+   // rhs = K reference
+   const Vector<double> rhs{-1., 3., 6., 0., -6.};
+   const Vector<double> reference{1., -1., 0., 2., 0.};
+
+   const Options options = default_options();
+   DenseLDLSolver solver(options);
+   factorize(solver, n, row_indices, column_indices, matrix_values);
+   auto& evaluation_space = dynamic_cast<COOEvaluationSpace&>(solver.get_evaluation_space());
+   evaluation_space.matrix_values = matrix_values;
+   Vector<double> result(n);
+   solver.solve_augmented_system(rhs, result);
+   for (size_t index: Range(n)) {
+      EXPECT_NEAR(result[index], reference[index], 1e-12);
+   }
+}
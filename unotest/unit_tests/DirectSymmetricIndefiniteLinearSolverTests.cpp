@@ -0,0 +1,244 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <utility>
+#include <vector>
+#include "ingredients/subproblem_solvers/COOEvaluationSpace.hpp"
+#include "ingredients/subproblem_solvers/DirectSymmetricIndefiniteLinearSolver.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "options/DefaultOptions.hpp"
+#include "options/Options.hpp"
+#include "symbolic/Range.hpp"
+
+using namespace uno;
+
+namespace {
+   constexpr size_t n = 5;
+   const std::array<double, n> reference{1., 2., 3., 4., 5.};
+
+   // dense solver whose "factorization" is that of the matrix shifted by a multiple of the identity, which mimics an
+   // inaccurate factorization. Tightening the pivoting removes the shift
+   class ShiftedDenseSolver: public DirectSymmetricIndefiniteLinearSolver<double> {
+   public:
+      ShiftedDenseSolver(const Options& options, double shift): DirectSymmetricIndefiniteLinearSolver(options),
+            configured_shift(shift), shift(shift) {
+         // upper triangle of the matrix (Fortran indexing). Its eigenvalues are -7.83, -3.51, 1.79, 4.61 and 8.94
+         this->evaluation_space.matrix_row_indices = {1, 1, 2, 2, 3, 3, 5};
+         this->evaluation_space.matrix_column_indices = {1, 2, 3, 5, 3, 4, 5};
+      }
+
+      void initialize_hessian(const Subproblem& /*subproblem*/) override { }
+      void initialize_augmented_system(const Subproblem& /*subproblem*/) override { }
+      void solve_indefinite_system(Statistics& /*statistics*/, const Subproblem& /*subproblem*/, Direction& /*direction*/,
+         const WarmstartInformation& /*warmstart_information*/) override { }
+      using DirectSymmetricIndefiniteLinearSolver<double>::solve_indefinite_system;
+
+      void do_symbolic_analysis() override { }
+
+      void do_numerical_factorization(const double* matrix_values) override {
+         ++this->number_factorizations;
+         for (auto& row: this->factor) {
+            row.fill(0.);
+         }
+         for (size_t nonzero_index: Range(this->evaluation_space.matrix_row_indices.size())) {
+            const size_t row_index = static_cast<size_t>(this->evaluation_space.matrix_row_indices[nonzero_index] - 1);
+            const size_t column_index = static_cast<size_t>(this->evaluation_space.matrix_column_indices[nonzero_index] - 1);
+            this->factor[row_index][column_index] += matrix_values[nonzero_index];
+            if (row_index != column_index) {
+               this->factor[column_index][row_index] += matrix_values[nonzero_index];
+            }
+         }
+         for (size_t index: Range(n)) {
+            this->factor[index][index] += this->shift;
+         }
+      }
+
+      [[nodiscard]] Inertia get_inertia() const override { return {3, 2, 0}; }
+      [[nodiscard]] size_t number_negative_eigenvalues() const override { return 2; }
+      [[nodiscard]] bool matrix_is_singular() const override { return false; }
+      [[nodiscard]] size_t rank() const override { return n; }
+      [[nodiscard]] EvaluationSpace& get_evaluation_space() override { return this->evaluation_space; }
+
+      size_t number_factorizations{0};
+      size_t number_pivoting_tightenings{0};
+      size_t number_pivoting_restorations{0};
+
+   protected:
+      COOEvaluationSpace evaluation_space{};
+      const double configured_shift;
+      double shift;
+      std::array<std::array<double, n>, n> factor{};
+
+      // Gaussian elimination with partial pivoting
+      void solve_with_factorization(const Vector<double>& /*matrix_values*/, const Vector<double>& rhs,
+            Vector<double>& result) override {
+         auto matrix = this->factor;
+         result = rhs;
+         for (size_t column_index: Range(n)) {
+            size_t pivot_index = column_index;
+            for (size_t row_index: Range(column_index + 1, n)) {
+               if (std::abs(matrix[pivot_index][column_index]) < std::abs(matrix[row_index][column_index])) {
+                  pivot_index = row_index;
+               }
+            }
+            std::swap(matrix[column_index], matrix[pivot_index]);
+            std::swap(result[column_index], result[pivot_index]);
+            for (size_t row_index: Range(column_index + 1, n)) {
+               const double factor = matrix[row_index][column_index] / matrix[column_index][column_index];
+               for (size_t index: Range(column_index, n)) {
+                  matrix[row_index][index] -= factor * matrix[column_index][index];
+               }
+               result[row_index] -= factor * result[column_index];
+            }
+         }
+         for (size_t row_index = n; 0 < row_index--;) {
+            for (size_t index: Range(row_index + 1, n)) {
+               result[row_index] -= matrix[row_index][index] * result[index];
+            }
+            result[row_index] /= matrix[row_index][row_index];
+         }
+      }
+
+      void compute_residual(const Vector<double>& matrix_values, const Vector<double>& rhs, const Vector<double>& solution,
+            Vector<double>& residual, Vector<double>& scaling) const override {
+         this->evaluation_space.compute_residual(matrix_values, rhs, solution, residual, scaling);
+      }
+
+      [[nodiscard]] bool tighten_pivoting() override {
+         ++this->number_pivoting_tightenings;
+         this->shift = 0.;
+         return true;
+      }
+
+      void restore_pivoting() override {
+         ++this->number_pivoting_restorations;
+         this->shift = this->configured_shift;
+      }
+   };
+
+   // same solver whose shifted "factorization" is interpreted as a low-precision factorization
+   class LowPrecisionSolver: public ShiftedDenseSolver {
+   public:
+      using ShiftedDenseSolver::ShiftedDenseSolver;
+
+      size_t number_precision_increases{0};
+
+   protected:
+      [[nodiscard]] bool increase_precision() override {
+         if (this->shift == 0.) {
+            return false;
+         }
+         ++this->number_precision_increases;
+         this->shift = 0.;
+         return true;
+      }
+   };
+
+   Options default_options() {
+      Options options;
+      DefaultOptions::load(options);
+      return options;
+   }
+
+   void solve(ShiftedDenseSolver& solver, Vector<double>& result) {
+      const Vector<double> matrix_values{2., 3., 4., 6., 1., 5., 1.};
+      const Vector<double> rhs{8., 45., 31., 15., 17.};
+      solver.do_symbolic_analysis();
+      solver.do_numerical_factorization(matrix_values.data());
+      solver.solve_indefinite_system(matrix_values, rhs, result);
+   }
+
+   double error(const Vector<double>& result) {
+      double error = 0.;
+      for (size_t index: Range(n)) {
+         error = std::max(error, std::abs(result[index] - reference[index]));
+      }
+      return error;
+   }
+} // namespace
+
+TEST(DirectSymmetricIndefiniteLinearSolver, AccurateFactorizationIsNotRefined) {
+   const Options options = default_options();
+   ShiftedDenseSolver solver(options, 0.);
+   Vector<double> result(n);
+   solve(solver, result);
+   EXPECT_EQ(solver.get_number_refinement_steps(), 0);
+   EXPECT_LE(solver.get_backward_error(), options.get_double("linear_solver_refinement_tolerance"));
+   EXPECT_LT(error(result), 1e-10);
+}
+
+TEST(DirectSymmetricIndefiniteLinearSolver, InaccurateFactorizationIsRefined) {
+   const Options options = default_options();
+   ShiftedDenseSolver solver(options, 1e-2);
+   Vector<double> result(n);
+   solve(solver, result);
+   EXPECT_LT(0, solver.get_number_refinement_steps());
+   EXPECT_LE(solver.get_backward_error(), options.get_double("linear_solver_refinement_tolerance"));
+   EXPECT_LT(error(result), 1e-8);
+   EXPECT_EQ(solver.number_pivoting_tightenings, 0);
+   EXPECT_EQ(solver.number_factorizations, 1);
+}
+
+TEST(DirectSymmetricIndefiniteLinearSolver, StalledRefinementRefactorizes) {
+   // the refinement diverges with this shift (the spectral radius of shift * (K + shift I)^{-1} is 2)
+   const Options options = default_options();
+   ShiftedDenseSolver solver(options, -1.2);
+   Vector<double> result(n);
+   solve(solver, result);
+   EXPECT_EQ(solver.number_pivoting_tightenings, 1);
+   EXPECT_EQ(solver.number_factorizations, 2);
+   EXPECT_LE(solver.get_backward_error(), options.get_double("linear_solver_refinement_tolerance"));
+   EXPECT_LT(error(result), 1e-10);
+}
+
+TEST(DirectSymmetricIndefiniteLinearSolver, RefactorizationRestoresPivoting) {
+   // the tighter pivoting only serves the recovery factorization: the next system is factorized with the configured
+   // pivoting and recovers again
+   const Options options = default_options();
+   ShiftedDenseSolver solver(options, -1.2);
+   Vector<double> result(n);
+   solve(solver, result);
+   EXPECT_EQ(solver.number_pivoting_restorations, 1);
+   solve(solver, result);
+   EXPECT_EQ(solver.number_pivoting_tightenings, 2);
+   EXPECT_EQ(solver.number_pivoting_restorations, 2);
+   EXPECT_EQ(solver.number_factorizations, 4);
+   EXPECT_LT(error(result), 1e-10);
+}
+
+TEST(DirectSymmetricIndefiniteLinearSolver, RefinementDisabled) {
+   Options options = default_options();
+   options.set("linear_solver_max_refinement_steps", "0");
+   ShiftedDenseSolver solver(options, 1e-2);
+   Vector<double> result(n);
+   solve(solver, result);
+   EXPECT_EQ(solver.get_number_refinement_steps(), 0);
+   EXPECT_LT(1e-6, error(result));
+}
+
+TEST(DirectSymmetricIndefiniteLinearSolver, ExhaustedRefinementRefactorizes) {
+   // the refinement converges slowly with this shift (the spectral radius of shift * (K + shift I)^{-1} is 0.39)
+   Options options = default_options();
+   options.set("linear_solver_max_refinement_steps", "3");
+   ShiftedDenseSolver solver(options, -0.5);
+   Vector<double> result(n);
+   solve(solver, result);
+   EXPECT_EQ(solver.number_pivoting_tightenings, 1);
+   EXPECT_EQ(solver.number_factorizations, 2);
+   EXPECT_LE(solver.get_backward_error(), options.get_double("linear_solver_refinement_tolerance"));
+}
+
+TEST(DirectSymmetricIndefiniteLinearSolver, StalledRefinementIncreasesPrecision) {
+   const Options options = default_options();
+   LowPrecisionSolver solver(options, -1.2);
+   Vector<double> result(n);
+   solve(solver, result);
+   EXPECT_EQ(solver.number_precision_increases, 1);
+   EXPECT_EQ(solver.number_pivoting_tightenings, 0);
+   EXPECT_EQ(solver.number_factorizations, 2);
+   EXPECT_LT(error(result), 1e-10);
+}
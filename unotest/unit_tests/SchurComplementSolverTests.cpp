@@ -0,0 +1,216 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "ingredients/subproblem_solvers/COOEvaluationSpace.hpp"
+#include "ingredients/subproblem_solvers/SchurComplement/BorderedBlockPartition.hpp"
+#include "ingredients/subproblem_solvers/SchurComplement/SchurComplementSolver.hpp"
+#include "ingredients/subproblem_solvers/SymmetricIndefiniteLinearSolverFactory.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "options/DefaultOptions.hpp"
+#include "options/Options.hpp"
+#include "symbolic/Range.hpp"
+
+using namespace uno;
+
+namespace {
+   // two scenarios (rows 1-3 and 4-6) coupled by the linking row 7, lower triangle in Fortran indexing:
+   // [ 4  1  0  0  0  0  1]
+   // [ 1 -3  2  0  0  0  1]
+   // [ 0  2  5  0  0  0  1]
+   // [ 0  0  0  2  1  0  1]
+   // [ 0  0  0  1  6 -1  1]
+   // [ 0  0  0  0 -1 -4  1]
+   // [ 1  1  1  1  1  1 -1]
+   const size_t n = 7;
+   const std::vector<int> row_indices{1, 2, 2, 3, 3, 4, 5, 5, 6, 6, 7, 7, 7, 7, 7, 7, 7};
+   const std::vector<int> column_indices{1, 1, 2, 2, 3, 4, 4, 5, 5, 6, 1, 2, 3, 4, 5, 6, 7};
+   const size_t border = BorderedBlockPartition::border;
+   const size_t undeclared = BorderedBlockPartition::undeclared;
+
+   double default_linking_degree_ratio() {
+      Options options;
+      DefaultOptions::load(options);
+      return options.get_double("SchurComplement_linking_degree_ratio");
+   }
+
+   bool has_sparse_solver() {
+      const auto linear_solvers = SymmetricIndefiniteLinearSolverFactory::available_solvers();
+      return std::any_of(linear_solvers.begin(), linear_solvers.end(), [](const std::string& linear_solver) {
+         return linear_solver != "DenseLDL" && linear_solver != "SchurComplement" && linear_solver != "MINRES";
+      });
+   }
+} // namespace
+
+TEST(SchurComplementSolver, DetectedPartition) {
+   // the linking row has 6 off-diagonal entries, the average is 20/7: the default ratio detects it
+   BorderedBlockPartition partition;
+   partition.compute(n, row_indices, column_indices, row_indices.size(), {}, default_linking_degree_ratio());
+
+   EXPECT_EQ(partition.number_blocks, 2);
+   EXPECT_EQ(partition.border_dimension, 1);
+   const std::vector<size_t> reference_row_blocks{0, 0, 0, 1, 1, 1, border};
+   const std::vector<size_t> reference_local_indices{0, 1, 2, 0, 1, 2, 0};
+   EXPECT_EQ(partition.row_blocks, reference_row_blocks);
+   EXPECT_EQ(partition.local_indices, reference_local_indices);
+}
+
+TEST(SchurComplementSolver, DeclaredPartition) {
+   // the undeclared rows 2 and 5 follow the rows to which they are coupled
+   const double linking_degree_ratio = default_linking_degree_ratio();
+   BorderedBlockPartition partition;
+   partition.compute(n, row_indices, column_indices, row_indices.size(), {0, undeclared, 0, 1, undeclared, 1, border}, linking_degree_ratio);
+   EXPECT_EQ(partition.number_blocks, 2);
+   EXPECT_EQ(partition.border_dimension, 1);
+   const std::vector<size_t> reference_row_blocks{0, 0, 0, 1, 1, 1, border};
+   EXPECT_EQ(partition.row_blocks, reference_row_blocks);
+
+   // the rows declared in the same block are merged, even if they are not coupled
+   partition.compute(n, row_indices, column_indices, row_indices.size(), {0, 0, 0, 0, undeclared, 0, border}, linking_degree_ratio);
+   EXPECT_EQ(partition.number_blocks, 1);
+   EXPECT_EQ(partition.block_dimensions, std::vector<size_t>{6});
+}
+
+TEST(SchurComplementSolver, TwoScenarios) {
+   const Vector<double> matrix_values{4., 1., -3., 2., 5., 2., 1., 6., -1., -4., 1., 1., 1., 1., 1., 1., -1.};
+   const Vector<double> reference{1., 2., 3., 4., 5., 6., 7.};
+   // rhs = K reference
+   const Vector<double> rhs{13., 8., 26., 20., 35., -22., 14.};
+
+   Options options;
+   DefaultOptions::load(options);
+   options.set("SchurComplement_number_threads", "2");
+   SchurComplementSolver solver(options);
+   auto& evaluation_space = dynamic_cast<COOEvaluationSpace&>(solver.get_evaluation_space());
+   evaluation_space.dimension = n;
+   evaluation_space.number_hessian_nonzeros = row_indices.size();
+   evaluation_space.number_matrix_nonzeros = row_indices.size();
+   evaluation_space.matrix_row_indices = row_indices;
+   evaluation_space.matrix_column_indices = column_indices;
+   solver.do_symbolic_analysis();
+   solver.do_numerical_factorization(matrix_values.data());
+   EXPECT_EQ(solver.get_partition().number_blocks, 2);
+
+   Vector<double> result(n);
+   solver.solve_indefinite_system(matrix_values, rhs, result);
+   for (size_t index: Range(n)) {
+      EXPECT_NEAR(result[index], reference[index], 1e-12);
+   }
+   // the inertia of the matrix is the sum of the inertias of the blocks and of the Schur complement
+   const auto [number_positive, number_negative, number_zero] = solver.get_inertia();
+   EXPECT_EQ(number_positive, 4);
+   EXPECT_EQ(number_negative, 3);
+   EXPECT_EQ(number_zero, 0);
+}
+
+TEST(SchurComplementSolver, LargeBlocksRequireSparseSolver) {
+   // the blocks of dimension 3 exceed DenseLDL_max_dimension: each is factorized by its own sparse solver
+   const Vector<double> matrix_values{4., 1., -3., 2., 5., 2., 1., 6., -1., -4., 1., 1., 1., 1., 1., 1., -1.};
+   const Vector<double> reference{1., 2., 3., 4., 5., 6., 7.};
+   const Vector<double> rhs{13., 8., 26., 20., 35., -22., 14.};
+
+   Options options;
+   DefaultOptions::load(options);
+   options.set("SchurComplement_number_threads", "2");
+   options.set("DenseLDL_max_dimension", "2");
+   SchurComplementSolver solver(options);
+   auto& evaluation_space = dynamic_cast<COOEvaluationSpace&>(solver.get_evaluation_space());
+   evaluation_space.dimension = n;
+   evaluation_space.number_hessian_nonzeros = row_indices.size();
+   evaluation_space.number_matrix_nonzeros = row_indices.size();
+   evaluation_space.matrix_row_indices = row_indices;
+   evaluation_space.matrix_column_indices = column_indices;
+   if (!has_sparse_solver()) {
+      EXPECT_THROW(solver.do_symbolic_analysis(), std::runtime_error);
+      return;
+   }
+   solver.do_symbolic_analysis();
+   solver.do_numerical_factorization(matrix_values.data());
+   EXPECT_EQ(solver.get_partition().number_blocks, 2);
+   Vector<double> result(n);
+   solver.solve_indefinite_system(matrix_values, rhs, result);
+   for (size_t index: Range(n)) {
+      EXPECT_NEAR(result[index], reference[index], 1e-10);
+   }
+   const auto [number_positive, number_negative, number_zero] = solver.get_inertia();
+   EXPECT_EQ(number_positive, 4);
+   EXPECT_EQ(number_negative, 3);
+   EXPECT_EQ(number_zero, 0);
+}
+
+TEST(SchurComplementSolver, SingletonWithoutDiagonalMovedToBorder) {
+   // row 8 (e.g. an equality constraint) is only coupled to the linking row 7 and its diagonal entry is a regularization
+   // entry: as a 1x1 block, it would be structurally singular
+   std::vector<int> extended_row_indices = row_indices;
+   std::vector<int> extended_column_indices = column_indices;
+   extended_row_indices.insert(extended_row_indices.end(), {8, 8});
+   extended_column_indices.insert(extended_column_indices.end(), {7, 8});
+   const size_t number_unregularized_nonzeros = extended_row_indices.size() - 1;
+   BorderedBlockPartition partition;
+   partition.compute(n + 1, extended_row_indices, extended_column_indices, number_unregularized_nonzeros, {},
+      default_linking_degree_ratio());
+   EXPECT_EQ(partition.number_blocks, 2);
+   EXPECT_EQ(partition.border_dimension, 2);
+   EXPECT_EQ(partition.row_blocks[7], border);
+
+   // with a structural diagonal entry, the row remains a block
+   partition.compute(n + 1, extended_row_indices, extended_column_indices, extended_row_indices.size(), {},
+      default_linking_degree_ratio());
+   EXPECT_EQ(partition.number_blocks, 3);
+   EXPECT_EQ(partition.border_dimension, 1);
+}
+
+TEST(SchurComplementSolver, NoBlockStructure) {
+   // tridiagonal matrix: a single block and no border
+   const std::vector<int> tridiagonal_row_indices{1, 2, 2, 3, 3, 4, 4};
+   const std::vector<int> tridiagonal_column_indices{1, 1, 2, 2, 3, 3, 4};
+   const Vector<double> matrix_values{2., -1., 2., -1., 2., -1., 2.};
+   const Vector<double> reference{1., 2., 3., 4.};
+   // rhs = K reference
+   const Vector<double> rhs{0., 0., 0., 5.};
+   const size_t dimension = 4;
+
+   const auto set_up = [&](SchurComplementSolver& solver) {
+      auto& evaluation_space = dynamic_cast<COOEvaluationSpace&>(solver.get_evaluation_space());
+      evaluation_space.dimension = dimension;
+      evaluation_space.number_hessian_nonzeros = tridiagonal_row_indices.size();
+      evaluation_space.number_matrix_nonzeros = tridiagonal_row_indices.size();
+      evaluation_space.matrix_row_indices = tridiagonal_row_indices;
+      evaluation_space.matrix_column_indices = tridiagonal_column_indices;
+   };
+   const auto check_solution = [&](SchurComplementSolver& solver) {
+      solver.do_numerical_factorization(matrix_values.data());
+      Vector<double> result(dimension);
+      solver.solve_indefinite_system(matrix_values, rhs, result);
+      for (size_t index: Range(dimension)) {
+         EXPECT_NEAR(result[index], reference[index], 1e-12);
+      }
+      EXPECT_EQ(solver.get_inertia().positive, dimension);
+   };
+
+   // small system: factorized as a single dense block
+   Options options;
+   DefaultOptions::load(options);
+   {
+      SchurComplementSolver solver(options);
+      set_up(solver);
+      solver.do_symbolic_analysis();
+      check_solution(solver);
+   }
+
+   // larger system: a sparse direct solver is required
+   options.set("DenseLDL_max_dimension", "2");
+   SchurComplementSolver solver(options);
+   set_up(solver);
+   if (has_sparse_solver()) {
+      solver.do_symbolic_analysis();
+      check_solution(solver);
+   }
+   else {
+      EXPECT_THROW(solver.do_symbolic_analysis(), std::runtime_error);
+   }
+}
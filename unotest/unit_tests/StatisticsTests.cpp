@@ -0,0 +1,86 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include <fstream>
+#include <stdexcept>
+#include "tools/IterationSink.hpp"
+#include "tools/Statistics.hpp"
+
+using namespace uno;
+
+TEST(Statistics, ColumnOrderAndFormatting) {
+   Statistics statistics{};
+   statistics.add_column("objective", 12, 100);
+   const Statistics::ColumnHandle iter_column = statistics.add_column("iter", 7, 1);
+   statistics.start_new_line();
+   statistics.set(iter_column, size_t(3));
+   statistics.set("objective", 1.5);
+   testing::internal::CaptureStdout();
+   statistics.print_current_line();
+   ASSERT_EQ(testing::internal::GetCapturedStdout(), " 3      1.5000e+00 \n");
+}
+
+TEST(Statistics, EmptyValues) {
+   Statistics statistics{};
+   statistics.add_column("iter", 7, 1);
+   statistics.add_column("status", 8, 2);
+   statistics.start_new_line();
+   statistics.set("status", "ok");
+   statistics.start_new_line();
+   testing::internal::CaptureStdout();
+   statistics.print_current_line();
+   ASSERT_EQ(testing::internal::GetCapturedStdout(), " -      -      \n");
+}
+
+TEST(Statistics, DuplicateColumn) {
+   Statistics statistics{};
+   const Statistics::ColumnHandle first_handle = statistics.add_column("regulariz", 13, 21);
+   const Statistics::ColumnHandle second_handle = statistics.add_column("regulariz", 13, 21);
+   ASSERT_EQ(first_handle, second_handle);
+}
+
+TEST(Statistics, Disabled) {
+   Statistics statistics(false);
+   statistics.add_column("iter", 7, 1);
+   statistics.start_new_line();
+   statistics.set("iter", 3);
+   testing::internal::CaptureStdout();
+   statistics.print_current_line();
+   ASSERT_EQ(testing::internal::GetCapturedStdout(), "");
+}
+
+TEST(Statistics, CSVSink) {
+   const std::string file_name = testing::TempDir() + "uno_statistics_sink.csv";
+   {
+      Statistics statistics(false);
+      statistics.set_sink(std::make_unique<IterationSink>(file_name, IterationSink::Format::CSV));
+      statistics.add_column("iter", 7, 1);
+      statistics.add_column("objective", 12, 100);
+      statistics.add_column("status", 8, 200);
+      statistics.start_new_line();
+      statistics.set("iter", 1);
+      statistics.set("objective", 0.5);
+      statistics.set("status", "a, b");
+      statistics.print_current_line();
+   }
+   std::ifstream file(file_name);
+   std::string header, record;
+   std::getline(file, header);
+   std::getline(file, record);
+   ASSERT_EQ(header, "iter,objective,status,time");
+   ASSERT_EQ(record.rfind("1,0.5,\"a, b\",", 0), 0);
+}
+
+TEST(Statistics, ColumnAddedAfterSinkHeader) {
+   const std::string file_name = testing::TempDir() + "uno_statistics_late_column.csv";
+   Statistics statistics(false);
+   statistics.set_sink(std::make_unique<IterationSink>(file_name, IterationSink::Format::JSON));
+   const Statistics::ColumnHandle iter_column = statistics.add_column("iter", 7, 1);
+   statistics.start_new_line();
+   statistics.set(iter_column, 1);
+   statistics.print_current_line();
+   // an existing column can be added again, a new column would not match the header
+   ASSERT_EQ(statistics.add_column("iter", 7, 1), iter_column);
+   ASSERT_THROW(statistics.add_column("objective", 12, 100), std::logic_error);
+}
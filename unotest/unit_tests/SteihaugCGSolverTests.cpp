@@ -0,0 +1,193 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include <array>
+#include <vector>
+#include "ingredients/hessian_models/ExactHessian.hpp"
+#include "ingredients/regularization_strategies/NoRegularization.hpp"
+#include "ingredients/subproblem/Subproblem.hpp"
+#include "ingredients/subproblem_solvers/SteihaugCGSolver.hpp"
+#include "linear_algebra/SparseVector.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "model/Model.hpp"
+#include "optimization/Direction.hpp"
+#include "optimization/Iterate.hpp"
+#include "optimization/OptimizationProblem.hpp"
+#include "optimization/WarmstartInformation.hpp"
+#include "options/DefaultOptions.hpp"
+#include "options/Options.hpp"
+#include "symbolic/CollectionAdapter.hpp"
+#include "symbolic/Range.hpp"
+#include "tools/Infinity.hpp"
+#include "tools/Statistics.hpp"
+
+using namespace uno;
+
+namespace {
+   const double tolerance = 1e-10;
+
+   // min 1/2 x^T Q x + c^T x s.t. lower <= x <= upper with 2 variables and a dense symmetric Q
+   class BoxQuadraticModel: public Model {
+   public:
+      BoxQuadraticModel(std::array<double, 3> hessian, std::array<double, 2> linear_coefficients, std::array<double, 2> lower_bounds,
+            std::array<double, 2> upper_bounds):
+            Model("box QP", 2, 0, 1.),
+            hessian(hessian),
+            linear_coefficients(linear_coefficients),
+            lower_bounds(lower_bounds),
+            upper_bounds(upper_bounds),
+            constraints_collection(this->constraints) {
+      }
+
+      [[nodiscard]] bool has_jacobian_operator() const override { return true; }
+      [[nodiscard]] bool has_jacobian_transposed_operator() const override { return true; }
+      [[nodiscard]] bool has_hessian_operator() const override { return true; }
+      [[nodiscard]] bool has_hessian_matrix() const override { return true; }
+
+      [[nodiscard]] double evaluate_objective(const Vector<double>& x) const override {
+         return 0.5 * (this->hessian[0] * x[0] * x[0] + 2. * this->hessian[1] * x[0] * x[1] + this->hessian[2] * x[1] * x[1]) +
+            this->linear_coefficients[0] * x[0] + this->linear_coefficients[1] * x[1];
+      }
+      void evaluate_constraints(const Vector<double>& /*x*/, Vector<double>& /*constraints*/) const override { }
+      void evaluate_objective_gradient(const Vector<double>& x, Vector<double>& gradient) const override {
+         gradient[0] = this->hessian[0] * x[0] + this->hessian[1] * x[1] + this->linear_coefficients[0];
+         gradient[1] = this->hessian[1] * x[0] + this->hessian[2] * x[1] + this->linear_coefficients[1];
+      }
+      void compute_constraint_jacobian_sparsity(int* /*row_indices*/, int* /*column_indices*/, int /*solver_indexing*/,
+         MatrixOrder /*matrix_order*/) const override { }
+      // lower triangle of the Hessian
+      void compute_hessian_sparsity(int* row_indices, int* column_indices, int solver_indexing) const override {
+         row_indices[0] = solver_indexing;
+         column_indices[0] = solver_indexing;
+         row_indices[1] = 1 + solver_indexing;
+         column_indices[1] = solver_indexing;
+         row_indices[2] = 1 + solver_indexing;
+         column_indices[2] = 1 + solver_indexing;
+      }
+      void evaluate_constraint_jacobian(const Vector<double>& /*x*/, double* /*jacobian_values*/) const override { }
+      void evaluate_lagrangian_hessian(const Vector<double>& /*x*/, double objective_multiplier, const Vector<double>& /*multipliers*/,
+            double* hessian_values) const override {
+         for (size_t index: Range(3)) {
+            hessian_values[index] = objective_multiplier * this->hessian[index];
+         }
+      }
+      void compute_jacobian_vector_product(const double* /*x*/, const double* /*vector*/, double* /*result*/) const override { }
+      void compute_jacobian_transposed_vector_product(const double* /*x*/, const double* /*vector*/, double* result) const override {
+         result[0] = 0.;
+         result[1] = 0.;
+      }
+      void compute_hessian_vector_product(const double* /*x*/, const double* vector, double objective_multiplier,
+            const Vector<double>& /*multipliers*/, double* result) const override {
+         result[0] = objective_multiplier * (this->hessian[0] * vector[0] + this->hessian[1] * vector[1]);
+         result[1] = objective_multiplier * (this->hessian[1] * vector[0] + this->hessian[2] * vector[1]);
+      }
+
+      [[nodiscard]] double variable_lower_bound(size_t variable_index) const override { return this->lower_bounds[variable_index]; }
+      [[nodiscard]] double variable_upper_bound(size_t variable_index) const override { return this->upper_bounds[variable_index]; }
+      [[nodiscard]] const SparseVector<size_t>& get_slacks() const override { return this->slacks; }
+      [[nodiscard]] const Vector<size_t>& get_fixed_variables() const override { return this->fixed_variables; }
+
+      [[nodiscard]] double constraint_lower_bound(size_t /*constraint_index*/) const override { return -INF<double>; }
+      [[nodiscard]] double constraint_upper_bound(size_t /*constraint_index*/) const override { return INF<double>; }
+      [[nodiscard]] const Collection<size_t>& get_equality_constraints() const override { return this->constraints_collection; }
+      [[nodiscard]] const Collection<size_t>& get_inequality_constraints() const override { return this->constraints_collection; }
+      [[nodiscard]] const Collection<size_t>& get_linear_constraints() const override { return this->constraints_collection; }
+
+      void initial_primal_point(Vector<double>& x) const override { x.fill(0.); }
+      void initial_dual_point(Vector<double>& /*multipliers*/) const override { }
+      void postprocess_solution(Iterate& /*iterate*/) const override { }
+
+      [[nodiscard]] size_t number_jacobian_nonzeros() const override { return 0; }
+      [[nodiscard]] size_t number_hessian_nonzeros() const override { return 3; }
+
+   private:
+      // lower triangle (Q00, Q10, Q11)
+      const std::array<double, 3> hessian;
+      const std::array<double, 2> linear_coefficients;
+      const std::array<double, 2> lower_bounds;
+      const std::array<double, 2> upper_bounds;
+      const SparseVector<size_t> slacks{};
+      const Vector<size_t> fixed_variables{};
+      std::vector<size_t> constraints{};
+      CollectionAdapter<std::vector<size_t>> constraints_collection;
+   };
+
+   // solve the box QP at x = 0 (the direction is the solution of the QP) with an exact CG
+   Direction solve(const Model& model, double trust_region_radius) {
+      Options options;
+      DefaultOptions::load(options);
+      options.set("SteihaugCG_forcing_term_max", "0");
+      const OptimizationProblem problem{model};
+      Iterate current_iterate(model.number_variables, model.number_constraints);
+      ExactHessian hessian_model;
+      hessian_model.initialize(model);
+      NoRegularization<double> regularization_strategy;
+      Subproblem subproblem{problem, current_iterate, hessian_model, regularization_strategy, trust_region_radius};
+
+      SteihaugCGSolver solver(options);
+      solver.initialize_memory(subproblem);
+      Statistics statistics;
+      solver.initialize_statistics(statistics, options);
+      Direction direction(model.number_variables, model.number_constraints);
+      const WarmstartInformation warmstart_information{};
+      solver.solve(statistics, subproblem, current_iterate.primals, direction, warmstart_information);
+      return direction;
+   }
+} // namespace
+
+// Q = [4 1; 1 3], c = (-1, -2): the unconstrained minimizer (1/11, 7/11) lies inside the box
+TEST(SteihaugCGSolver, InteriorSolution) {
+   const BoxQuadraticModel model({4., 1., 3.}, {-1., -2.}, {-10., -10.}, {10., 10.});
+   const Direction direction = solve(model, INF<double>);
+   ASSERT_EQ(direction.status, SubproblemStatus::OPTIMAL);
+   EXPECT_NEAR(direction.primals[0], 1. / 11., tolerance);
+   EXPECT_NEAR(direction.primals[1], 7. / 11., tolerance);
+   EXPECT_NEAR(direction.subproblem_objective, model.evaluate_objective(direction.primals), tolerance);
+   for (size_t variable_index: Range(model.number_variables)) {
+      EXPECT_EQ(direction.multipliers.lower_bounds[variable_index], 0.);
+      EXPECT_EQ(direction.multipliers.upper_bounds[variable_index], 0.);
+   }
+}
+
+// same QP with a trust region of radius 0.1: the first CG step leaves the trust region along x1, CG is restarted on x0
+// which then hits the trust region. The solution (0.1, 0.1) is a corner of the trust region with model gradient (-0.5, -1.6)
+TEST(SteihaugCGSolver, TrustRegionBoundary) {
+   const BoxQuadraticModel model({4., 1., 3.}, {-1., -2.}, {-10., -10.}, {10., 10.});
+   const Direction direction = solve(model, 0.1);
+   ASSERT_EQ(direction.status, SubproblemStatus::OPTIMAL);
+   EXPECT_NEAR(direction.primals[0], 0.1, tolerance);
+   EXPECT_NEAR(direction.primals[1], 0.1, tolerance);
+   EXPECT_NEAR(direction.subproblem_objective, model.evaluate_objective(direction.primals), tolerance);
+   EXPECT_NEAR(direction.multipliers.upper_bounds[0], -0.5, tolerance);
+   EXPECT_NEAR(direction.multipliers.upper_bounds[1], -1.6, tolerance);
+   EXPECT_EQ(direction.multipliers.lower_bounds[0], 0.);
+   EXPECT_EQ(direction.multipliers.lower_bounds[1], 0.);
+}
+
+// Q = [-2 0; 0 1], c = (-1, 0) on [-1, 1]^2: the steepest-descent direction (1, 0) has negative curvature and is
+// followed up to the bound x0 = 1, the global minimizer with objective -2
+TEST(SteihaugCGSolver, NegativeCurvature) {
+   const BoxQuadraticModel model({-2., 0., 1.}, {-1., 0.}, {-1., -1.}, {1., 1.});
+   const Direction direction = solve(model, INF<double>);
+   ASSERT_EQ(direction.status, SubproblemStatus::OPTIMAL);
+   EXPECT_NEAR(direction.primals[0], 1., tolerance);
+   EXPECT_NEAR(direction.primals[1], 0., tolerance);
+   EXPECT_NEAR(direction.subproblem_objective, -2., tolerance);
+   EXPECT_NEAR(direction.multipliers.upper_bounds[0], -3., tolerance);
+}
+
+// Q = 2I, c = (2, -2) with 0.5 <= x0: the starting point 0 is projected onto the bound x0 = 0.5, where the model gradient
+// pushes x0 outwards. CG runs on x1 only and the solution is (0.5, 1) with lower bound multiplier 3
+TEST(SteihaugCGSolver, BoundProjection) {
+   const BoxQuadraticModel model({2., 0., 2.}, {2., -2.}, {0.5, -10.}, {2., 10.});
+   const Direction direction = solve(model, INF<double>);
+   ASSERT_EQ(direction.status, SubproblemStatus::OPTIMAL);
+   EXPECT_NEAR(direction.primals[0], 0.5, tolerance);
+   EXPECT_NEAR(direction.primals[1], 1., tolerance);
+   EXPECT_NEAR(direction.subproblem_objective, 0.25, tolerance);
+   EXPECT_NEAR(direction.multipliers.lower_bounds[0], 3., tolerance);
+   EXPECT_EQ(direction.multipliers.upper_bounds[0], 0.);
+   EXPECT_EQ(direction.multipliers.lower_bounds[1], 0.);
+   EXPECT_EQ(direction.multipliers.upper_bounds[1], 0.);
+}
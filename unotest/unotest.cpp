@@ -3,22 +3,30 @@
 
 #if defined(HAS_MPI) && defined(MUMPS_PARALLEL)
 #include "mpi.h"
+#include "ingredients/subproblem_solvers/MUMPS/MUMPSSolver.hpp"
 #endif
 #include <gtest/gtest.h>
 
 // https://www.eriksmistad.no/getting-started-with-google-test-on-ubuntu/
 int main(int argc, char **argv) {
 #if defined(HAS_MPI) && defined(MUMPS_PARALLEL)
-   int myid , ierr;
-   ierr = MPI_Init(&argc , &argv);
-   ierr = MPI_Comm_rank(MPI_COMM_WORLD, &myid);
+   // mpirun -np 4 ./run_unotest: the tests run on the host, the other processes only take part in MUMPS
+   MPI_Init(&argc, &argv);
+   int rank;
+   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+   if (rank != 0) {
+      uno::MUMPSSolver::run_worker_loop();
+      MPI_Finalize();
+      return 0;
+   }
 #endif
 
     testing::InitGoogleTest(&argc, argv);
     auto result = RUN_ALL_TESTS();
 
 #if defined(HAS_MPI) && defined(MUMPS_PARALLEL)
-   ierr = MPI_Finalize() ;
+   uno::MUMPSSolver::release_workers();
+   MPI_Finalize();
 #endif
    return result;
-}
\ No newline at end of file
+}